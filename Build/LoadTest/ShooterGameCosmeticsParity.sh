@@ -0,0 +1,95 @@
+#!/bin/bash
+# Gameplay parity check between a build with cosmetics (SHOOTER_WITH_COSMETICS=1) and the dedicated server build (=0).
+#
+# Runs the same seeded BotSim match (see FShooterBotMatchSimulator) with both binaries and compares the match
+# summaries: total kills, hits and damage, team scores and every bot's kills, deaths and score. Frame timings and
+# wall time are ignored. Exits with 1 if anything differs, 2 if either run didn't write a summary.
+# Both summaries and a diff are kept in Reports/CosmeticsParity-<date> next to this script.
+#
+# Usage: ShooterGameCosmeticsParity.sh [seed] [bots] [round seconds] [map]
+#   SERVER_BIN      packaged LinuxServer binary (default: ../../Binaries/Linux/ShooterGameServer)
+#   COSMETICS_BIN   packaged LinuxNoEditor binary (default: ../../Binaries/Linux/ShooterGame)
+#   COSMETICS_ARGS  extra arguments for COSMETICS_BIN, e.g. "ShooterGame.uproject -server" when it is UE4Editor,
+#                   which runs the match as a dedicated server with cosmetics compiled in
+#   SERVER_SAVED / COSMETICS_SAVED  Saved folder each binary writes BotSim reports to (default: ../../Saved)
+#   GAME_MODE       FFA or TDM (default: FFA)
+
+set -u
+
+SEED=${1:-42}
+BOTS=${2:-8}
+ROUND_TIME=${3:-180}
+MAP=${4:-/Game/Maps/Sanctuary}
+
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+SERVER_BIN=${SERVER_BIN:-$SCRIPT_DIR/../../Binaries/Linux/ShooterGameServer}
+COSMETICS_BIN=${COSMETICS_BIN:-$SCRIPT_DIR/../../Binaries/Linux/ShooterGame}
+COSMETICS_ARGS=${COSMETICS_ARGS:-}
+SERVER_SAVED=${SERVER_SAVED:-$SCRIPT_DIR/../../Saved}
+COSMETICS_SAVED=${COSMETICS_SAVED:-$SCRIPT_DIR/../../Saved}
+GAME_MODE=${GAME_MODE:-FFA}
+REPORT_DIR=$SCRIPT_DIR/Reports/CosmeticsParity-$(date +%Y%m%d-%H%M%S)
+
+# a standalone client logs in a local player, SpectatorOnly keeps it out of the match
+URL="$MAP?game=$GAME_MODE?Bots=$BOTS?BotSim?Seed=$SEED?SimFPS=30?RoundTime=$ROUND_TIME?SpectatorOnly=1"
+
+mkdir -p "$REPORT_DIR"
+
+# runs one binary and copies the summary it wrote to $REPORT_DIR/<name>.json
+run_sim()
+{
+	local NAME=$1
+	local SAVED=$2
+	shift 2
+
+	echo "=== $NAME: $URL"
+	rm -f "$SAVED"/BotSim/*-Seed$SEED-Summary.json
+	"$@" "$URL" -log -nosteam -unattended -nullrhi -nosound > "$REPORT_DIR/$NAME.log" 2>&1
+
+	local SUMMARY
+	SUMMARY=$(ls -t "$SAVED"/BotSim/*-Seed$SEED-Summary.json 2>/dev/null | head -1)
+	if [ -z "$SUMMARY" ]; then
+		echo "$NAME: no BotSim summary written, see $REPORT_DIR/$NAME.log"
+		exit 2
+	fi
+	cp "$SUMMARY" "$REPORT_DIR/$NAME.json"
+}
+
+run_sim Server "$SERVER_SAVED" "$SERVER_BIN"
+run_sim Cosmetics "$COSMETICS_SAVED" "$COSMETICS_BIN" $COSMETICS_ARGS
+
+python3 - "$REPORT_DIR/Server.json" "$REPORT_DIR/Cosmetics.json" > "$REPORT_DIR/Diff.txt" <<'EOF'
+import json, sys
+
+def load(path):
+	with open(path) as f:
+		summary = json.load(f)
+	# only bots play, the spectating local player of a standalone client has no counterpart on the server
+	players = {p["Name"]: (p["Kills"], p["Deaths"], p["Score"]) for p in summary.get("Players", []) if p["Name"].startswith("Bot ")}
+	return summary, players
+
+server, server_players = load(sys.argv[1])
+cosmetics, cosmetics_players = load(sys.argv[2])
+
+differences = 0
+for field in ("Kills", "Hits", "Damage", "TeamScores"):
+	if server.get(field) != cosmetics.get(field):
+		print("%s: server %s, cosmetics %s" % (field, server.get(field), cosmetics.get(field)))
+		differences += 1
+
+for name in sorted(set(server_players) | set(cosmetics_players)):
+	if server_players.get(name) != cosmetics_players.get(name):
+		print("%s kills/deaths/score: server %s, cosmetics %s" % (name, server_players.get(name), cosmetics_players.get(name)))
+		differences += 1
+
+print("%d differences (%d kills, %d hits, %.1f damage on the server)" % (differences, server.get("Kills", 0), server.get("Hits", 0), server.get("Damage", 0)))
+sys.exit(1 if differences else 0)
+EOF
+RESULT=$?
+
+cat "$REPORT_DIR/Diff.txt"
+if [ $RESULT -ne 0 ]; then
+	echo "Gameplay differs between the server and cosmetics builds (seed $SEED), see $REPORT_DIR"
+	exit 1
+fi
+echo "Server and cosmetics builds agree (seed $SEED)"
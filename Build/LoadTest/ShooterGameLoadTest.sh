@@ -0,0 +1,100 @@
+#!/bin/bash
+# Headless server load test for Linux machines without a GPU.
+#
+# Starts a local dedicated server and N -nullrhi clients connected over loopback. Clients are driven by the
+# -LoadTestBot autopilot in AShooterPlayerController; the server appends one CSV row per connection per second
+# (frame time, bandwidth, ping, hit registration, CPU) to Reports/<report>.csv next to this script.
+#
+# Usage: ShooterGameLoadTest.sh <2|8|32|64> [duration seconds] [map]
+#   SERVER_BIN  packaged LinuxServer binary (default: ../../Binaries/Linux/ShooterGameServer)
+#   CLIENT_BIN  packaged LinuxNoEditor binary (default: ../../Binaries/Linux/ShooterGame)
+#   GAME_MODE   FFA or TDM (default: TDM)
+#   REPORT      absolute path of the CSV report (default: Reports/LoadTest-<mode>-<players>-<date>.csv)
+#   EXTRA_SERVER_ARGS  appended to the server command line (e.g. -PktLag=50)
+#   EXTRA_CLIENT_ARGS  appended to every client command line (e.g. -PktLoss=2)
+#   SERVER_TIMEOUT     seconds the server may take to load the map, and to exit after the duration (default: 120)
+#
+# Exits with 1 if the server doesn't load the map or finish the run in time, or exits with an error.
+
+set -u
+
+PROFILE=${1:-8}
+DURATION=${2:-120}
+MAP=${3:-/Game/Maps/Sanctuary}
+
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+SERVER_BIN=${SERVER_BIN:-$SCRIPT_DIR/../../Binaries/Linux/ShooterGameServer}
+CLIENT_BIN=${CLIENT_BIN:-$SCRIPT_DIR/../../Binaries/Linux/ShooterGame}
+GAME_MODE=${GAME_MODE:-TDM}
+EXTRA_SERVER_ARGS=${EXTRA_SERVER_ARGS:-}
+EXTRA_CLIENT_ARGS=${EXTRA_CLIENT_ARGS:-}
+PORT=${PORT:-7777}
+SERVER_TIMEOUT=${SERVER_TIMEOUT:-120}
+
+case "$PROFILE" in
+	2|8|32|64) ;;
+	*) echo "Unknown profile '$PROFILE', expected 2, 8, 32 or 64"; exit 1 ;;
+esac
+
+REPORT=${REPORT:-$SCRIPT_DIR/Reports/LoadTest-$GAME_MODE-$PROFILE-$(date +%Y%m%d-%H%M%S).csv}
+mkdir -p "$(dirname "$REPORT")"
+LOG_DIR=$SCRIPT_DIR/Logs/$PROFILE
+mkdir -p "$LOG_DIR"
+
+PIDS=()
+cleanup()
+{
+	for PID in "${PIDS[@]}"; do
+		kill "$PID" 2>/dev/null
+	done
+	wait 2>/dev/null
+}
+trap cleanup EXIT INT TERM
+
+echo "Starting server: $MAP ($GAME_MODE, $PROFILE players, ${DURATION}s)"
+"$SERVER_BIN" "$MAP?game=$GAME_MODE?MaxPlayers=$PROFILE" -log -nosteam -unattended -port=$PORT \
+	-LoadTestReport="$REPORT" -LoadTestDuration="$DURATION" $EXTRA_SERVER_ARGS > "$LOG_DIR/Server.log" 2>&1 &
+SERVER_PID=$!
+PIDS+=($SERVER_PID)
+
+# clients start connecting once the server has loaded the map (the engine logs "Took N seconds to LoadMap")
+for (( i = 0; i < SERVER_TIMEOUT * 10; i++ )); do
+	if grep -q "seconds to LoadMap" "$LOG_DIR/Server.log" 2>/dev/null; then
+		break
+	fi
+	if ! kill -0 $SERVER_PID 2>/dev/null; then
+		echo "Server exited during startup, see $LOG_DIR/Server.log"
+		exit 1
+	fi
+	sleep 0.1
+done
+if (( i >= SERVER_TIMEOUT * 10 )); then
+	echo "Server didn't load the map within $SERVER_TIMEOUT s, see $LOG_DIR/Server.log"
+	exit 1
+fi
+
+for (( i = 0; i < PROFILE; i++ )); do
+	"$CLIENT_BIN" 127.0.0.1:$PORT -nullrhi -nosound -nosteam -unattended -windowed -ResX=64 -ResY=64 \
+		-LoadTestBot $EXTRA_CLIENT_ARGS > "$LOG_DIR/Client$i.log" 2>&1 &
+	PIDS+=($!)
+	# stagger logins so the join spike doesn't dominate the first samples
+	sleep 0.25
+done
+
+# the server exits on its own after the duration
+DEADLINE=$(( $(date +%s) + DURATION + SERVER_TIMEOUT ))
+while kill -0 $SERVER_PID 2>/dev/null; do
+	if (( $(date +%s) >= DEADLINE )); then
+		echo "Server still running $SERVER_TIMEOUT s after the ${DURATION}s run, see $LOG_DIR/Server.log"
+		exit 1
+	fi
+	sleep 1
+done
+
+wait $SERVER_PID
+SERVER_RESULT=$?
+if [ $SERVER_RESULT -ne 0 ]; then
+	echo "Server exited with $SERVER_RESULT, see $LOG_DIR/Server.log"
+	exit 1
+fi
+echo "Report written to $REPORT"
@@ -0,0 +1,121 @@
+#!/bin/bash
+# Network emulation regression suite for hit registration.
+#
+# Runs a scripted duel (two -LoadTestBot clients, FFA) against a local dedicated server for every packet
+# simulation profile below and summarizes confirmed/rejected client hits, hit report RPC volume and server
+# CPU cost. Results are compared to NetEmulationBaseline.csv and the script exits with 1 on a regression, when a
+# profile confirmed no hits at all (the duel didn't run or hit registration is broken), or when the baseline is
+# missing, lacks a profile or has an empty or zero column for one (a baseline that can't gate anything).
+# Packet simulation is compiled out of Shipping builds, run this against Development or Test binaries.
+#
+# Usage: ShooterGameNetEmulation.sh [duration seconds] [--update-baseline | --no-compare]
+#   --update-baseline  write this run's summary to NetEmulationBaseline.csv
+#   --no-compare       only check that every profile confirmed hits, e.g. on machines without a baseline
+#   SERVER_BIN / CLIENT_BIN as for ShooterGameLoadTest.sh
+
+set -u
+
+DURATION=90
+UPDATE_BASELINE=0
+NO_COMPARE=0
+for ARG in "$@"; do
+	case "$ARG" in
+		--update-baseline) UPDATE_BASELINE=1 ;;
+		--no-compare) NO_COMPARE=1 ;;
+		*) DURATION=$ARG ;;
+	esac
+done
+
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+REPORT_DIR=$SCRIPT_DIR/Reports/NetEmulation-$(date +%Y%m%d-%H%M%S)
+SUMMARY=$REPORT_DIR/Summary.csv
+BASELINE=$SCRIPT_DIR/NetEmulationBaseline.csv
+
+# allowed change against the baseline before a profile is flagged
+MAX_ACCURACY_DROP=0.05
+MAX_RPC_INCREASE=1.25
+MAX_FRAME_INCREASE=1.20
+MAX_CPU_INCREASE=1.20
+
+# name|packet simulation settings, applied on the server and on both clients
+PROFILES=(
+	"Clean|"
+	"Lag100|-PktLag=50"
+	"Lag250|-PktLag=125"
+	"Jitter|-PktLag=50 -PktJitter=30"
+	"Loss2|-PktLoss=2"
+	"Lag100Loss5|-PktLag=50 -PktLoss=5"
+	"Lag250Jitter|-PktLag=125 -PktJitter=60"
+)
+
+mkdir -p "$REPORT_DIR"
+echo "Profile,HitsConfirmed,HitsRejected,HitAccuracy,HitRPCsPerSec,AvgFrameMs,CpuPct" > "$SUMMARY"
+
+for ENTRY in "${PROFILES[@]}"; do
+	NAME=${ENTRY%%|*}
+	SETTINGS=${ENTRY#*|}
+	REPORT=$REPORT_DIR/$NAME.csv
+
+	echo "=== $NAME ($SETTINGS)"
+	REPORT="$REPORT" GAME_MODE=FFA EXTRA_SERVER_ARGS="$SETTINGS" EXTRA_CLIENT_ARGS="$SETTINGS" \
+		"$SCRIPT_DIR/ShooterGameLoadTest.sh" 2 "$DURATION" > "$REPORT_DIR/$NAME.log" 2>&1
+
+	if [ ! -s "$REPORT" ]; then
+		echo "$NAME: no report written, see $REPORT_DIR/$NAME.log"
+		echo "$NAME,0,0,0,0,0,0" >> "$SUMMARY"
+		continue
+	fi
+
+	# hit counters are cumulative, take them from the last ALL row; frame time and CPU are averaged over all samples
+	awk -F, -v Name="$NAME" '
+		$2 == "ALL" && $3 != "0 players" { Rows++; FrameMs += $4; Cpu += $13; Time = $1; Confirmed = $9; Rejected = $10; Misses = $11; Accuracy = $12 }
+		END {
+			if (Rows == 0) { printf "%s,0,0,0,0,0,0\n", Name; exit }
+			printf "%s,%d,%d,%.4f,%.2f,%.3f,%.1f\n", Name, Confirmed, Rejected, Accuracy, (Confirmed + Rejected + Misses) / Time, FrameMs / Rows, Cpu / Rows
+		}' "$REPORT" >> "$SUMMARY"
+done
+
+column -s, -t < "$SUMMARY"
+
+# a profile without confirmed hits means the run is broken, whatever the baseline says
+awk -F, '
+	FNR == 1 { next }
+	$2 == 0 { printf "FAILED %s: no confirmed hits\n", $1; Failed = 1 }
+	END { exit Failed }' "$SUMMARY" || exit 1
+
+if [ $UPDATE_BASELINE -eq 1 ]; then
+	cp "$SUMMARY" "$BASELINE"
+	echo "Baseline updated: $BASELINE"
+	exit 0
+fi
+
+if [ $NO_COMPARE -eq 1 ]; then
+	echo "Every profile confirmed hits, baseline comparison skipped"
+	exit 0
+fi
+
+if [ ! -f "$BASELINE" ]; then
+	echo "No baseline at $BASELINE, rerun with --update-baseline to create one or --no-compare to skip the comparison"
+	exit 1
+fi
+
+awk -F, -v AccDrop=$MAX_ACCURACY_DROP -v RpcInc=$MAX_RPC_INCREASE -v FrameInc=$MAX_FRAME_INCREASE -v CpuInc=$MAX_CPU_INCREASE '
+	FNR == 1 { next }
+	NR == FNR { Acc[$1] = $4; Rpc[$1] = $5; Frame[$1] = $6; Cpu[$1] = $7; next }
+	!($1 in Acc) { print "FAILED " $1 ": not in baseline, rerun with --update-baseline"; Failed = 1; next }
+	Acc[$1] + 0 <= 0 || Rpc[$1] + 0 <= 0 || Frame[$1] + 0 <= 0 || Cpu[$1] + 0 <= 0 {
+		printf "FAILED %s: baseline has an empty or zero column, rerun with --update-baseline\n", $1; Failed = 1; next
+	}
+	{
+		if ($4 < Acc[$1] - AccDrop)      { printf "REGRESSION %s: hit accuracy %.4f (baseline %.4f)\n", $1, $4, Acc[$1]; Failed = 1 }
+		if ($5 > Rpc[$1] * RpcInc)       { printf "REGRESSION %s: hit RPCs/s %.2f (baseline %.2f)\n", $1, $5, Rpc[$1]; Failed = 1 }
+		if ($6 > Frame[$1] * FrameInc)   { printf "REGRESSION %s: frame %.3fms (baseline %.3fms)\n", $1, $6, Frame[$1]; Failed = 1 }
+		if ($7 > Cpu[$1] * CpuInc)       { printf "REGRESSION %s: CPU %.1f%% (baseline %.1f%%)\n", $1, $7, Cpu[$1]; Failed = 1 }
+	}
+	END { exit Failed }' "$BASELINE" "$SUMMARY"
+RESULT=$?
+
+if [ $RESULT -eq 0 ]; then
+	echo "No regressions against $BASELINE"
+fi
+exit $RESULT
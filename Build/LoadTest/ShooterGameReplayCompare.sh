@@ -0,0 +1,91 @@
+#!/bin/bash
+# Replay recording cost: frame time spikes and replay size with the compressed ShooterReplayStreaming backend
+# against the engine's uncompressed NullNetworkReplayStreaming.
+#
+# Runs the same seeded BotSim match (see FShooterBotMatchSimulator) three times on a dedicated server: without
+# recording, recording with -REPLAYSTREAMER=NullNetworkReplayStreaming and recording with the default streamer from
+# DefaultEngine.ini. Each run's -Frames.csv is kept, and one row per run (frame time percentiles, frames over
+# SPIKE_MS, replay bytes) is written to Reports/ReplayCompare-<date>/Summary.csv next to this script.
+#
+# Usage: ShooterGameReplayCompare.sh [seed] [bots] [round seconds] [map]
+#   SERVER_BIN  packaged LinuxServer binary (default: ../../Binaries/Linux/ShooterGameServer)
+#   SAVED       Saved folder the server writes BotSim reports and demos to (default: ../../Saved)
+#   GAME_MODE   FFA or TDM (default: TDM)
+#   SPIKE_MS    frame time counted as a spike (default: 33.3, the frame budget at the simulated 30 Hz)
+
+set -u
+
+SEED=${1:-42}
+BOTS=${2:-32}
+ROUND_TIME=${3:-300}
+MAP=${4:-/Game/Maps/Sanctuary}
+
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+SERVER_BIN=${SERVER_BIN:-$SCRIPT_DIR/../../Binaries/Linux/ShooterGameServer}
+SAVED=${SAVED:-$SCRIPT_DIR/../../Saved}
+GAME_MODE=${GAME_MODE:-TDM}
+SPIKE_MS=${SPIKE_MS:-33.3}
+REPORT_DIR=$SCRIPT_DIR/Reports/ReplayCompare-$(date +%Y%m%d-%H%M%S)
+
+if [ ! -x "$SERVER_BIN" ]; then
+	echo "No server binary at $SERVER_BIN"
+	exit 1
+fi
+
+URL="$MAP?game=$GAME_MODE?Bots=$BOTS?BotSim?Seed=$SEED?SimFPS=30?RoundTime=$ROUND_TIME"
+
+mkdir -p "$REPORT_DIR"
+echo "Run,Frames,P50FrameMs,P95FrameMs,P99FrameMs,MaxFrameMs,Spikes,ReplayBytes" > "$REPORT_DIR/Summary.csv"
+
+# runs one match and appends its row to Summary.csv
+# $1 run name, $2 demo name or "" to not record, remaining arguments are added to the command line
+run_match()
+{
+	local NAME=$1
+	local DEMO=$2
+	shift 2
+
+	local RUN_URL=$URL
+	if [ -n "$DEMO" ]; then
+		RUN_URL="$URL?DemoRec=$DEMO"
+		# the local file streamer writes <demo>.replay, the null streamer a <demo> folder
+		rm -rf "$SAVED/Demos/$DEMO" "$SAVED/Demos/$DEMO.replay"
+	fi
+
+	echo "=== $NAME: $RUN_URL $*"
+	rm -f "$SAVED"/BotSim/*-Seed$SEED-Frames.csv
+	"$SERVER_BIN" "$RUN_URL" -log -nosteam -unattended "$@" > "$REPORT_DIR/$NAME.log" 2>&1
+
+	local FRAMES
+	FRAMES=$(ls -t "$SAVED"/BotSim/*-Seed$SEED-Frames.csv 2>/dev/null | head -1)
+	if [ -z "$FRAMES" ]; then
+		echo "$NAME: no BotSim frame timings written, see $REPORT_DIR/$NAME.log"
+		exit 2
+	fi
+	cp "$FRAMES" "$REPORT_DIR/$NAME-Frames.csv"
+
+	local REPLAY_BYTES=0
+	if [ -n "$DEMO" ]; then
+		REPLAY_BYTES=$(find "$SAVED/Demos/$DEMO" "$SAVED/Demos/$DEMO.replay" -type f -printf '%s\n' 2>/dev/null | awk '{ Sum += $1 } END { print Sum + 0 }')
+		if [ "$REPLAY_BYTES" -eq 0 ]; then
+			echo "$NAME: no replay written to $SAVED/Demos, see $REPORT_DIR/$NAME.log"
+			exit 2
+		fi
+	fi
+
+	# percentiles of the FrameMs column, nearest rank like the BotSim summary
+	sort -t, -k3 -g <(tail -n +2 "$REPORT_DIR/$NAME-Frames.csv") | awk -F, -v Name="$NAME" -v Spike="$SPIKE_MS" -v Bytes="$REPLAY_BYTES" '
+		{ Ms[NR] = $3; if ($3 > Spike) Spikes++ }
+		function Rank(P) { I = int(NR * P / 100) + 1; return Ms[I > NR ? NR : I] }
+		END { printf "%s,%d,%.2f,%.2f,%.2f,%.2f,%d,%d\n", Name, NR, Rank(50), Rank(95), Rank(99), Ms[NR], Spikes, Bytes }' >> "$REPORT_DIR/Summary.csv"
+}
+
+run_match NoReplay ""
+run_match NullStreamer ReplayCompare-Null -REPLAYSTREAMER=NullNetworkReplayStreaming
+run_match ShooterStreamer ReplayCompare-Shooter
+
+# the shooter streamer logs its raw and compressed chunk totals when it is released
+grep -h "Replay chunks:" "$REPORT_DIR/ShooterStreamer.log"
+
+cat "$REPORT_DIR/Summary.csv"
+echo "Report written to $REPORT_DIR"
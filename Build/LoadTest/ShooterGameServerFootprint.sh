@@ -0,0 +1,71 @@
+#!/bin/bash
+# Dedicated server footprint: binary size, startup time and resident memory of an idle server.
+#
+# Starts the server on a map with no players, waits for the map to load (startup time is the wall time until the
+# engine logs "Took N seconds to LoadMap"), samples /proc after the settle time and appends one row to
+# Reports/ServerFootprint.csv next to this script. Run it against a build from before and after a change (e.g. moving
+# the menus and HUD to the ClientOnly ShooterGameUI module) and compare the rows.
+#
+# Usage: ShooterGameServerFootprint.sh [label] [settle seconds] [map]
+#   SERVER_BIN  packaged LinuxServer binary (default: ../../Binaries/Linux/ShooterGameServer)
+
+set -u
+
+LABEL=${1:-$(date +%Y%m%d-%H%M%S)}
+SETTLE=${2:-30}
+MAP=${3:-/Game/Maps/Sanctuary}
+
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+SERVER_BIN=${SERVER_BIN:-$SCRIPT_DIR/../../Binaries/Linux/ShooterGameServer}
+PORT=${PORT:-7777}
+REPORT=$SCRIPT_DIR/Reports/ServerFootprint.csv
+LOG_DIR=$SCRIPT_DIR/Logs/Footprint
+mkdir -p "$(dirname "$REPORT")" "$LOG_DIR"
+
+if [ ! -x "$SERVER_BIN" ]; then
+	echo "No server binary at $SERVER_BIN"
+	exit 1
+fi
+
+# the binary may be a launcher script, measure the executable next to it as well when there is one
+BINARY_BYTES=$(stat -L -c %s "$SERVER_BIN")
+BINARY_DIR=$(dirname "$(readlink -f "$SERVER_BIN")")
+SHOOTER_BYTES=$(find "$BINARY_DIR" -maxdepth 1 -type f \( -name 'ShooterGameServer*' -o -name 'libUE4Server-ShooterGame*.so' \) \
+	! -name '*.debug' ! -name '*.sym' -printf '%s\n' | awk '{ Sum += $1 } END { print Sum + 0 }')
+
+"$SERVER_BIN" "$MAP" -log -nosteam -unattended -port=$PORT > "$LOG_DIR/$LABEL.log" 2>&1 &
+SERVER_PID=$!
+START_TIME=$(date +%s.%N)
+trap 'kill $SERVER_PID 2>/dev/null; wait 2>/dev/null' EXIT INT TERM
+
+STARTUP_SECONDS=
+for (( i = 0; i < SETTLE * 10; i++ )); do
+	if [ -z "$STARTUP_SECONDS" ] && grep -q "seconds to LoadMap" "$LOG_DIR/$LABEL.log" 2>/dev/null; then
+		STARTUP_SECONDS=$(echo "$(date +%s.%N) $START_TIME" | awk '{ printf "%.1f", $1 - $2 }')
+	fi
+	sleep 0.1
+done
+
+if [ -z "$STARTUP_SECONDS" ]; then
+	echo "Map not loaded after $SETTLE s, see $LOG_DIR/$LABEL.log"
+	exit 1
+fi
+
+if [ ! -r /proc/$SERVER_PID/status ]; then
+	echo "Server exited early, see $LOG_DIR/$LABEL.log"
+	exit 1
+fi
+
+# VmHWM is the peak, covering map load; VmRSS is what an idle server keeps
+RSS_KB=$(awk '/^VmRSS:/ { print $2 }' /proc/$SERVER_PID/status)
+PEAK_KB=$(awk '/^VmHWM:/ { print $2 }' /proc/$SERVER_PID/status)
+# Slate and Noesis show up as mapped libraries in modular builds, a server without UI maps neither
+UI_LIBS=$(grep -c -E 'Noesis|ShooterGameUI|Slate' /proc/$SERVER_PID/maps)
+
+if [ ! -s "$REPORT" ]; then
+	echo "Label,BinaryBytes,ShooterBinaryBytes,StartupSeconds,RssKB,PeakRssKB,UIMappings" > "$REPORT"
+fi
+echo "$LABEL,$BINARY_BYTES,$SHOOTER_BYTES,$STARTUP_SECONDS,$RSS_KB,$PEAK_KB,$UI_LIBS" >> "$REPORT"
+
+echo "$LABEL: binary $BINARY_BYTES bytes, startup $STARTUP_SECONDS s, RSS $RSS_KB KB, peak $PEAK_KB KB, $UI_LIBS UI mappings"
+echo "Report written to $REPORT"
@@ -0,0 +1,44 @@
+#!/bin/bash
+# Replay driven client CPU benchmark.
+#
+# Plays back a recorded match headless on a fixed timestep and compares the summary against
+# Baselines/<replay>.json next to this script. Exits with 1 on a regression, when the baseline is missing or when a
+# compared value is only in one of the two summaries, 2 if the replay couldn't be played.
+# Timings, summary and CSV stat capture are written to the game's Saved/ReplayBenchmark folder.
+#
+# Usage: ShooterGameReplayBenchmark.sh <replay name> [--update-baseline]
+#   CLIENT_BIN  packaged LinuxNoEditor binary (default: ../../Binaries/Linux/ShooterGame)
+#   TOLERANCE   allowed increase against the baseline in percent (default: 10)
+
+set -u
+
+if [ $# -lt 1 ]; then
+	echo "Usage: $0 <replay name> [--update-baseline]"
+	exit 2
+fi
+
+REPLAY=$1
+SCRIPT_DIR=$(cd "$(dirname "$0")" && pwd)
+CLIENT_BIN=${CLIENT_BIN:-$SCRIPT_DIR/../../Binaries/Linux/ShooterGame}
+TOLERANCE=${TOLERANCE:-10}
+BASELINE=$SCRIPT_DIR/Baselines/$REPLAY.json
+
+EXTRA_ARGS=""
+if [ "${2:-}" == "--update-baseline" ]; then
+	mkdir -p "$SCRIPT_DIR/Baselines"
+	EXTRA_ARGS="-ReplayBenchmarkUpdateBaseline"
+elif [ ! -f "$BASELINE" ]; then
+	echo "No baseline at $BASELINE, rerun with --update-baseline to create one"
+	exit 1
+fi
+
+"$CLIENT_BIN" -ReplayBenchmark="$REPLAY" -ReplayBenchmarkBaseline="$BASELINE" -ReplayBenchmarkTolerance=$TOLERANCE \
+	-nullrhi -nosteam -unattended -log $EXTRA_ARGS
+RESULT=$?
+
+case $RESULT in
+	0) echo "Replay benchmark of $REPLAY passed" ;;
+	1) echo "Replay benchmark of $REPLAY regressed against $BASELINE" ;;
+	*) echo "Replay benchmark of $REPLAY failed ($RESULT)" ;;
+esac
+exit $RESULT
@@ -8,6 +8,7 @@
 #include "Bots/ShooterBot.h"
 #include "Bots/ShooterAIController.h"
 #include "Online/ShooterPlayerState.h"
+#include "ShooterVisibilityMap.h"
 
 UBTDecorator_HasLoSTo::UBTDecorator_HasLoSTo(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -115,8 +116,13 @@ bool UBTDecorator_HasLoSTo::LOSTrace(AActor* InActor, AActor* InEnemyActor, cons
 			TraceParams.bReturnPhysicalMaterial = true;
 			TraceParams.AddIgnoredActor(MyBot);
 			const FVector StartLocation = MyBot->GetActorLocation();
+			if (!FShooterVisibilityMap::MayBeVisible(GetWorld(), StartLocation, EndLocation))
+			{
+				return false;
+			}
 			FHitResult Hit(ForceInit);
 			GetWorld()->LineTraceSingleByChannel(Hit, StartLocation, EndLocation, COLLISION_WEAPON, TraceParams);
+			SHOOTER_INC_COUNTER(Traces);
 			if (Hit.bBlockingHit == true)
 			{
 				// We hit something. If we have an actor supplied, just check if the hit actor is an enemy. If it is consider that 'has LOS'
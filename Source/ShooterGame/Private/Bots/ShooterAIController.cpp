@@ -3,7 +3,9 @@
 #include "ShooterGame.h"
 #include "Bots/ShooterAIController.h"
 #include "Bots/ShooterBot.h"
+#include "Bots/ShooterBotMatchSimulator.h"
 #include "Online/ShooterPlayerState.h"
+#include "ShooterVisibilityMap.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
@@ -97,6 +99,8 @@ void AShooterAIController::FindClosestEnemy()
 
 bool AShooterAIController::FindClosestEnemyWithLOS(AShooterCharacter* ExcludeEnemy)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(FindClosestEnemyWithLOS);
+
 	bool bGotEnemy = false;
 	APawn* MyBot = GetPawn();
 	if (MyBot != NULL)
@@ -145,7 +149,12 @@ bool AShooterAIController::HasWeaponLOSToEnemy(AActor* InEnemyActor, const bool
 	
 	FHitResult Hit(ForceInit);
 	const FVector EndLocation = InEnemyActor->GetActorLocation();
+	if (!FShooterVisibilityMap::MayBeVisible(GetWorld(), StartLocation, EndLocation))
+	{
+		return false;
+	}
 	GetWorld()->LineTraceSingleByChannel(Hit, StartLocation, EndLocation, COLLISION_WEAPON, TraceParams);
+	SHOOTER_INC_COUNTER(Traces);
 	if (Hit.bBlockingHit == true)
 	{
 		// Theres a blocking hit - check if its our enemy actor
@@ -264,6 +273,26 @@ void AShooterAIController::UpdateControlRotation(float DeltaTime, bool bUpdatePa
 	}
 }
 
+void AShooterAIController::FindPathForMoveRequest(const FAIMoveRequest& MoveRequest, FPathFindingQuery& Query, FNavPathSharedPtr& OutPath) const
+{
+	Super::FindPathForMoveRequest(MoveRequest, Query, OutPath);
+
+	if (!OutPath.IsValid() || !OutPath->IsValid())
+	{
+		FShooterBotMatchSimulator::NotifyPathFailure();
+	}
+}
+
+void AShooterAIController::OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult& Result)
+{
+	Super::OnMoveCompleted(RequestID, Result);
+
+	if (Result.IsFailure() && !Result.IsInterrupted())
+	{
+		FShooterBotMatchSimulator::NotifyPathFailure();
+	}
+}
+
 void AShooterAIController::GameHasEnded(AActor* EndGameFocus, bool bIsWinner)
 {
 	// Stop the behaviour tree/logic
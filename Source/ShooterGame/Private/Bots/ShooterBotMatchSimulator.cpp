@@ -0,0 +1,213 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Bots/ShooterBotMatchSimulator.h"
+#include "Online/ShooterPlayerState.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+FShooterBotMatchSimulator* FShooterBotMatchSimulator::ActiveSimulator = nullptr;
+
+FShooterBotMatchSimulator::FShooterBotMatchSimulator(AShooterGameMode* InGameMode, int32 InSeed, float InSimFPS)
+	: GameMode(InGameMode)
+	, Seed(InSeed)
+	, SimFPS(FMath::Max(1.0f, InSimFPS))
+	, LastFrameTime(0.0)
+	, StartTime(0.0)
+	, NumPathFailures(0)
+	, NumHits(0)
+	, TotalDamage(0.0f)
+	, bFinished(false)
+{
+	check(ActiveSimulator == nullptr);
+	ActiveSimulator = this;
+
+	// every random stream in gameplay code derives from these
+	FMath::RandInit(Seed);
+	FMath::SRandInit(Seed);
+
+	// step the world by a fixed amount and don't wait for real time to catch up
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / SimFPS);
+
+	FrameTimesMs.Reserve(FMath::CeilToInt(SimFPS) * 600);
+	StartTime = LastFrameTime = FPlatformTime::Seconds();
+
+#if CSV_PROFILER
+	// trace, RPC and spawn counts come from the stat ShooterGame counters, per frame
+	const FString BaseName = GetReportBaseName();
+	FCsvProfiler::Get()->BeginCapture(-1, FPaths::GetPath(BaseName), FPaths::GetCleanFilename(BaseName) + TEXT("-Stats.csv"));
+#endif
+
+	UE_LOG(LogShooter, Log, TEXT("Bot match simulation started (seed %d, %.1f fps fixed timestep)"), Seed, SimFPS);
+}
+
+FShooterBotMatchSimulator::~FShooterBotMatchSimulator()
+{
+	if (ActiveSimulator == this)
+	{
+		ActiveSimulator = nullptr;
+	}
+}
+
+FString FShooterBotMatchSimulator::GetSimOptionName()
+{
+	return FString(TEXT("BotSim"));
+}
+
+FShooterBotMatchSimulator* FShooterBotMatchSimulator::Get()
+{
+	return ActiveSimulator;
+}
+
+void FShooterBotMatchSimulator::NotifyPathFailure()
+{
+	if (ActiveSimulator)
+	{
+		ActiveSimulator->NumPathFailures++;
+	}
+}
+
+void FShooterBotMatchSimulator::NotifyDamageDealt(float Damage)
+{
+	if (ActiveSimulator)
+	{
+		ActiveSimulator->NumHits++;
+		ActiveSimulator->TotalDamage += Damage;
+	}
+}
+
+void FShooterBotMatchSimulator::Tick(float DeltaTime)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	FrameTimesMs.Add((float)((CurrentTime - LastFrameTime) * 1000.0));
+	LastFrameTime = CurrentTime;
+}
+
+bool FShooterBotMatchSimulator::IsTickable() const
+{
+	return !bFinished && GameMode.IsValid();
+}
+
+bool FShooterBotMatchSimulator::IsTickableWhenPaused() const
+{
+	return false;
+}
+
+TStatId FShooterBotMatchSimulator::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FShooterBotMatchSimulator, STATGROUP_Tickables);
+}
+
+void FShooterBotMatchSimulator::FinishSimulation()
+{
+	if (bFinished)
+	{
+		return;
+	}
+	bFinished = true;
+
+#if CSV_PROFILER
+	FCsvProfiler::Get()->EndCapture();
+#endif
+
+	const FString BaseName = GetReportBaseName();
+	WriteFrameTimings(BaseName + TEXT("-Frames.csv"));
+	WriteSummary(BaseName + TEXT("-Summary.json"));
+
+	UE_LOG(LogShooter, Log, TEXT("Bot match simulation finished: %d frames in %.2fs, %d path failures. Report: %s"),
+		FrameTimesMs.Num(), FPlatformTime::Seconds() - StartTime, NumPathFailures, *BaseName);
+
+	FPlatformMisc::RequestExit(false);
+}
+
+FString FShooterBotMatchSimulator::GetReportBaseName() const
+{
+	const AShooterGameMode* MyGameMode = GameMode.Get();
+	const FString MapName = (MyGameMode && MyGameMode->GetWorld()) ? MyGameMode->GetWorld()->GetMapName() : FString(TEXT("Unknown"));
+	const FString ModeName = MyGameMode ? MyGameMode->GetClass()->GetName() : FString(TEXT("Unknown"));
+
+	return FPaths::ProjectSavedDir() / TEXT("BotSim") / FString::Printf(TEXT("%s-%s-Seed%d"), *MapName, *ModeName, Seed);
+}
+
+void FShooterBotMatchSimulator::WriteFrameTimings(const FString& Filename) const
+{
+	const float FixedDeltaMs = 1000.0f / SimFPS;
+
+	FString Csv = TEXT("Frame,SimTimeSeconds,FrameMs\n");
+	for (int32 i = 0; i < FrameTimesMs.Num(); ++i)
+	{
+		Csv += FString::Printf(TEXT("%d,%.4f,%.4f\n"), i, (i + 1) * FixedDeltaMs / 1000.0f, FrameTimesMs[i]);
+	}
+
+	FFileHelper::SaveStringToFile(Csv, *Filename);
+}
+
+void FShooterBotMatchSimulator::WriteSummary(const FString& Filename) const
+{
+	const AShooterGameMode* MyGameMode = GameMode.Get();
+	const AShooterGameState* MyGameState = MyGameMode ? MyGameMode->GetGameState<AShooterGameState>() : nullptr;
+
+	TArray<float> SortedFrameTimes = FrameTimesMs;
+	SortedFrameTimes.Sort();
+
+	float TotalFrameMs = 0.0f;
+	for (float FrameMs : SortedFrameTimes)
+	{
+		TotalFrameMs += FrameMs;
+	}
+
+	const int32 NumFrames = SortedFrameTimes.Num();
+	TSharedRef<FJsonObject> Summary = MakeShareable(new FJsonObject());
+	Summary->SetStringField(TEXT("Map"), (MyGameMode && MyGameMode->GetWorld()) ? MyGameMode->GetWorld()->GetMapName() : FString());
+	Summary->SetStringField(TEXT("GameMode"), MyGameMode ? MyGameMode->GetClass()->GetName() : FString());
+	Summary->SetNumberField(TEXT("Seed"), Seed);
+	Summary->SetNumberField(TEXT("SimFPS"), SimFPS);
+	Summary->SetNumberField(TEXT("Frames"), NumFrames);
+	Summary->SetNumberField(TEXT("WallSeconds"), FPlatformTime::Seconds() - StartTime);
+	Summary->SetNumberField(TEXT("AvgFrameMs"), NumFrames > 0 ? TotalFrameMs / NumFrames : 0.0f);
+	Summary->SetNumberField(TEXT("MinFrameMs"), NumFrames > 0 ? SortedFrameTimes[0] : 0.0f);
+	Summary->SetNumberField(TEXT("P95FrameMs"), NumFrames > 0 ? SortedFrameTimes[FMath::Min(NumFrames - 1, (NumFrames * 95) / 100)] : 0.0f);
+	Summary->SetNumberField(TEXT("MaxFrameMs"), NumFrames > 0 ? SortedFrameTimes.Last() : 0.0f);
+	Summary->SetNumberField(TEXT("PathFailures"), NumPathFailures);
+	Summary->SetNumberField(TEXT("Hits"), NumHits);
+	Summary->SetNumberField(TEXT("Damage"), TotalDamage);
+
+	int32 TotalKills = 0;
+	TArray<TSharedPtr<FJsonValue>> Players;
+	if (MyGameState)
+	{
+		for (APlayerState* PlayerState : MyGameState->PlayerArray)
+		{
+			const AShooterPlayerState* ShooterPlayerState = Cast<AShooterPlayerState>(PlayerState);
+			if (ShooterPlayerState)
+			{
+				TSharedRef<FJsonObject> PlayerEntry = MakeShareable(new FJsonObject());
+				PlayerEntry->SetStringField(TEXT("Name"), ShooterPlayerState->GetPlayerName());
+				PlayerEntry->SetNumberField(TEXT("Team"), ShooterPlayerState->GetTeamNum());
+				PlayerEntry->SetNumberField(TEXT("Kills"), ShooterPlayerState->GetKills());
+				PlayerEntry->SetNumberField(TEXT("Deaths"), ShooterPlayerState->GetDeaths());
+				PlayerEntry->SetNumberField(TEXT("Score"), ShooterPlayerState->GetScore());
+				Players.Add(MakeShareable(new FJsonValueObject(PlayerEntry)));
+
+				TotalKills += ShooterPlayerState->GetKills();
+			}
+		}
+
+		TArray<TSharedPtr<FJsonValue>> TeamScores;
+		for (int32 TeamScore : MyGameState->TeamScores)
+		{
+			TeamScores.Add(MakeShareable(new FJsonValueNumber(TeamScore)));
+		}
+		Summary->SetArrayField(TEXT("TeamScores"), TeamScores);
+	}
+	Summary->SetNumberField(TEXT("Kills"), TotalKills);
+	Summary->SetArrayField(TEXT("Players"), Players);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Summary, Writer);
+
+	FFileHelper::SaveStringToFile(Json, *Filename);
+}
@@ -0,0 +1,92 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Tickable.h"
+
+class AShooterGameMode;
+
+/**
+ * Headless bot-vs-bot match simulation.
+ *
+ * Enabled with the BotSim URL option on a map that uses a ShooterGame game mode, e.g.
+ *   ShooterGameServer /Game/Maps/Sanctuary?game=FFA?Bots=16?BotSim?Seed=42?SimFPS=30 -nullrhi -nosound
+ *
+ * The engine is switched to a fixed timestep so the match runs as fast as the CPU allows, the random
+ * generators are seeded from the Seed option so runs are repeatable, and remote logins are refused.
+ * When the match ends, per-frame timings and a match summary are written to Saved/BotSim and the process exits.
+ * When the engine CSV profiler is compiled in, a CSV capture of the same frames is recorded next to them, with the
+ * stat ShooterGame counters (traces, RPCs sent, actors spawned) per frame.
+ */
+class FShooterBotMatchSimulator : public FTickableGameObject
+{
+public:
+
+	FShooterBotMatchSimulator(AShooterGameMode* InGameMode, int32 InSeed, float InSimFPS);
+	virtual ~FShooterBotMatchSimulator();
+
+	/** get the name of the URL option that enables bot simulation */
+	static FString GetSimOptionName();
+
+	/** returns the simulator running in this process, if any */
+	static FShooterBotMatchSimulator* Get();
+
+	/** count a bot move request that couldn't find or follow a path */
+	static void NotifyPathFailure();
+
+	/** count a hit that dealt damage to a pawn */
+	static void NotifyDamageDealt(float Damage);
+
+	/** write out the report and request engine exit */
+	void FinishSimulation();
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+
+	/** write per-frame timings as CSV */
+	void WriteFrameTimings(const FString& Filename) const;
+
+	/** write match summary as JSON */
+	void WriteSummary(const FString& Filename) const;
+
+	/** base name for the report files */
+	FString GetReportBaseName() const;
+
+	/** owning game mode */
+	TWeakObjectPtr<AShooterGameMode> GameMode;
+
+	/** seed used for all random streams */
+	int32 Seed;
+
+	/** fixed simulation rate */
+	float SimFPS;
+
+	/** wall clock duration of each simulated frame, in milliseconds */
+	TArray<float> FrameTimesMs;
+
+	/** wall clock time of the previous tick */
+	double LastFrameTime;
+
+	/** wall clock time when the simulation started */
+	double StartTime;
+
+	/** failed bot path requests during the match */
+	int32 NumPathFailures;
+
+	/** hits that dealt damage during the match */
+	int32 NumHits;
+
+	/** damage dealt by those hits */
+	float TotalDamage;
+
+	/** report was already written */
+	bool bFinished;
+
+	/** simulator running in this process */
+	static FShooterBotMatchSimulator* ActiveSimulator;
+};
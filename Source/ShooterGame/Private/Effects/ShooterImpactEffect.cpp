@@ -2,12 +2,27 @@
 
 #include "ShooterGame.h"
 #include "Effects/ShooterImpactEffect.h"
+#include "ShooterAssetManager.h"
 
 AShooterImpactEffect::AShooterImpactEffect(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	SetAutoDestroyWhenFinished(true);
 }
 
+FPrimaryAssetId AShooterImpactEffect::GetPrimaryAssetId() const
+{
+	return UShooterAssetManager::GetBlueprintPrimaryAssetId(this, UShooterAssetManager::ImpactEffectType);
+}
+
+#if WITH_EDITOR
+void AShooterImpactEffect::PreSave(const ITargetPlatform* TargetPlatform)
+{
+	Super::PreSave(TargetPlatform);
+
+	UShooterAssetManager::UpdateAssetBundleData(this, AssetBundleData);
+}
+#endif
+
 void AShooterImpactEffect::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
@@ -43,7 +58,7 @@ void AShooterImpactEffect::PostInitializeComponents()
 
 UParticleSystem* AShooterImpactEffect::GetImpactFX(TEnumAsByte<EPhysicalSurface> SurfaceType) const
 {
-	UParticleSystem* ImpactFX = NULL;
+	TSoftObjectPtr<UParticleSystem> ImpactFX;
 
 	switch (SurfaceType)
 	{
@@ -58,12 +73,12 @@ UParticleSystem* AShooterImpactEffect::GetImpactFX(TEnumAsByte<EPhysicalSurface>
 		default:						ImpactFX = DefaultFX; break;
 	}
 
-	return ImpactFX;
+	return UShooterAssetManager::GetClientAsset(ImpactFX);
 }
 
 USoundCue* AShooterImpactEffect::GetImpactSound(TEnumAsByte<EPhysicalSurface> SurfaceType) const
 {
-	USoundCue* ImpactSound = NULL;
+	TSoftObjectPtr<USoundCue> ImpactSound;
 
 	switch (SurfaceType)
 	{
@@ -78,5 +93,5 @@ USoundCue* AShooterImpactEffect::GetImpactSound(TEnumAsByte<EPhysicalSurface> Su
 		default:						ImpactSound = DefaultSound; break;
 	}
 
-	return ImpactSound;
+	return UShooterAssetManager::GetClientAsset(ImpactSound);
 }
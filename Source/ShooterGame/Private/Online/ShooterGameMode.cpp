@@ -2,14 +2,19 @@
 
 #include "ShooterGame.h"
 #include "ShooterGameInstance.h"
-#include "UI/ShooterHUD.h"
+#include "ShooterGameUIInterface.h"
 #include "Player/ShooterSpectatorPawn.h"
 #include "Player/ShooterDemoSpectator.h"
 #include "Online/ShooterGameMode.h"
 #include "Online/ShooterPlayerState.h"
 #include "Online/ShooterGameSession.h"
 #include "Bots/ShooterAIController.h"
+#include "Bots/ShooterBotMatchSimulator.h"
+#include "Online/ShooterLoadTestRecorder.h"
 #include "ShooterTeamStart.h"
+#include "ShooterReplayIndex.h"
+#include "ShooterVisibilityMap.h"
+#include "Engine/DemoNetDriver.h"
 
 
 AShooterGameMode::AShooterGameMode(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -20,7 +25,6 @@ AShooterGameMode::AShooterGameMode(const FObjectInitializer& ObjectInitializer)
 	static ConstructorHelpers::FClassFinder<APawn> BotPawnOb(TEXT("/Game/Blueprints/Pawns/BotPawn"));
 	BotPawnClass = BotPawnOb.Class;
 
-	HUDClass = AShooterHUD::StaticClass();
 	PlayerControllerClass = AShooterPlayerController::StaticClass();
 	PlayerStateClass = AShooterPlayerState::StaticClass();
 	SpectatorClass = AShooterSpectatorPawn::StaticClass();
@@ -32,6 +36,11 @@ AShooterGameMode::AShooterGameMode(const FObjectInitializer& ObjectInitializer)
 	bAllowBots = true;	
 	bNeedsBotCreation = true;
 	bUseSeamlessTravel = true;	
+
+	MaxChatMessagesPerTick = 16;
+	MaxPendingChatMessages = 64;
+	ReplayCheckpointInterval = 10.0f;
+	PrimaryActorTick.bCanEverTick = true;
 }
 
 FString AShooterGameMode::GetBotsCountOptionName()
@@ -45,6 +54,27 @@ void AShooterGameMode::InitGame(const FString& MapName, const FString& Options,
 	SetAllowBots(BotsCountOptionValue > 0 ? true : false, BotsCountOptionValue);	
 	Super::InitGame(MapName, Options, ErrorMessage);
 
+	if (UGameplayStatics::HasOption(Options, FShooterBotMatchSimulator::GetSimOptionName()))
+	{
+		const int32 Seed = UGameplayStatics::GetIntOption(Options, TEXT("Seed"), 0);
+		const int32 SimFPS = UGameplayStatics::GetIntOption(Options, TEXT("SimFPS"), 30);
+		RoundTime = UGameplayStatics::GetIntOption(Options, TEXT("RoundTime"), RoundTime);
+		BotMatchSimulator = MakeShareable(new FShooterBotMatchSimulator(this, Seed, SimFPS));
+	}
+
+	LoadTestRecorder = FShooterLoadTestRecorder::CreateFromCommandLine(this);
+	VisibilityMap = FShooterVisibilityMap::LoadForMap(UWorld::RemovePIEPrefix(MapName));
+
+	if (UGameplayStatics::HasOption(Options, TEXT("DemoRec")) && ReplayCheckpointInterval > 0.0f)
+	{
+		// seeking replays from the closest checkpoint, the engine default of 30s makes long matches slow to scrub
+		static IConsoleVariable* CheckpointDelayCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("demo.CheckpointUploadDelayInSeconds"));
+		if (CheckpointDelayCVar)
+		{
+			CheckpointDelayCVar->Set(ReplayCheckpointInterval, ECVF_SetByGameSetting);
+		}
+	}
+
 	const UGameInstance* GameInstance = GetGameInstance();
 	if (GameInstance && Cast<UShooterGameInstance>(GameInstance)->GetOnlineMode() != EOnlineMode::Offline)
 	{
@@ -52,6 +82,16 @@ void AShooterGameMode::InitGame(const FString& MapName, const FString& Options,
 	}
 }
 
+bool AShooterGameMode::IsBotMatchSimulation() const
+{
+	return BotMatchSimulator.IsValid();
+}
+
+const FShooterVisibilityMap* AShooterGameMode::GetVisibilityMap() const
+{
+	return VisibilityMap.Get();
+}
+
 void AShooterGameMode::SetAllowBots(bool bInAllowBots, int32 InMaxBots)
 {
 	bAllowBots = bInAllowBots;
@@ -71,6 +111,39 @@ void AShooterGameMode::PreInitializeComponents()
 	GetWorldTimerManager().SetTimer(TimerHandle_DefaultTimer, this, &AShooterGameMode::DefaultTimer, GetWorldSettings()->GetEffectiveTimeDilation(), true);
 }
 
+void AShooterGameMode::QueueChatMessage(APlayerController* Sender, const FString& Msg)
+{
+	if (PendingChatMessages.Num() >= MaxPendingChatMessages)
+	{
+		PendingChatMessages.RemoveAt(0, PendingChatMessages.Num() - MaxPendingChatMessages + 1, false);
+		SHOOTER_INC_COUNTER(ChatMessagesDropped);
+	}
+
+	PendingChatMessages.Emplace(Sender ? Sender->PlayerState : NULL, Msg);
+}
+
+void AShooterGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (PendingChatMessages.Num() > 0)
+	{
+		// one reliable RPC per player for everything said since the last tick
+		const int32 NumToSend = FMath::Min(PendingChatMessages.Num(), MaxChatMessagesPerTick);
+		TArray<FShooterChatMessage> ChatBatch(PendingChatMessages.GetData(), NumToSend);
+		PendingChatMessages.RemoveAt(0, NumToSend, false);
+
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			AShooterPlayerController* PC = Cast<AShooterPlayerController>(*It);
+			if (PC)
+			{
+				PC->ClientReceiveChat(ChatBatch);
+			}
+		}
+	}
+}
+
 void AShooterGameMode::DefaultTimer()
 {
 	// don't update timers for Play In Editor mode, it's not real match
@@ -84,6 +157,13 @@ void AShooterGameMode::DefaultTimer()
 		return;
 	}
 
+	// bot simulation doesn't wait for anyone to join
+	if (IsBotMatchSimulation() && GetMatchState() == MatchState::WaitingToStart)
+	{
+		StartMatch();
+		return;
+	}
+
 	AShooterGameState* const MyGameState = Cast<AShooterGameState>(GameState);
 	if (MyGameState && MyGameState->RemainingTime > 0 && !MyGameState->bTimerPaused)
 	{
@@ -168,6 +248,8 @@ void AShooterGameMode::HandleMatchHasStarted()
 			PC->ClientGameStarted();
 		}
 	}
+
+	AddReplayEvent(ShooterReplayEvents::Round, TEXT("Start"));
 }
 
 void AShooterGameMode::FinishMatch()
@@ -177,6 +259,8 @@ void AShooterGameMode::FinishMatch()
 	{
 		EndMatch();
 		DetermineMatchWinner();		
+		AddReplayEvent(ShooterReplayEvents::Round, TEXT("End"));
+		IndexRecordedReplay();
 
 		// notify players
 		for (FConstControllerIterator It = GetWorld()->GetControllerIterator(); It; ++It)
@@ -197,9 +281,90 @@ void AShooterGameMode::FinishMatch()
 
 		// set up to restart the match
 		MyGameState->RemainingTime = TimeBetweenMatches;
+
+		// everyone loads the next map while the scoreboard is up instead of after travel
+		if (!IsBotMatchSimulation())
+		{
+			MyGameState->SetNextMapName(GetNextMapName());
+		}
+
+		if (IsBotMatchSimulation())
+		{
+			BotMatchSimulator->FinishSimulation();
+		}
 	}
 }
 
+void AShooterGameMode::AddReplayEvent(const TCHAR* Group, const FString& Meta)
+{
+	// events are stored next to the stream, so the demo HUD can list them without scrubbing the replay
+	UDemoNetDriver* const DemoDriver = GetWorld()->DemoNetDriver;
+	if (DemoDriver && DemoDriver->IsRecording())
+	{
+		DemoDriver->AddEvent(Group, Meta, TArray<uint8>());
+	}
+}
+
+FString AShooterGameMode::GetNextMapName() const
+{
+	if (MapRotation.Num() == 0)
+	{
+		return FString();
+	}
+
+	const FString CurrentMapName = GetWorld()->GetOutermost()->GetName();
+	const int32 CurrentIndex = MapRotation.IndexOfByPredicate([&CurrentMapName](const FString& MapName)
+	{
+		return MapName.Equals(CurrentMapName, ESearchCase::IgnoreCase);
+	});
+
+	// maps outside the rotation continue with its first map
+	return MapRotation[(CurrentIndex + 1) % MapRotation.Num()];
+}
+
+void AShooterGameMode::IndexRecordedReplay()
+{
+	UDemoNetDriver* const DemoDriver = GetWorld()->DemoNetDriver;
+	UShooterGameInstance* const GameInstance = Cast<UShooterGameInstance>(GetGameInstance());
+	TSharedPtr<FShooterReplayIndex> ReplayIndex = GameInstance ? GameInstance->GetReplayIndex() : nullptr;
+	if (DemoDriver == nullptr || !DemoDriver->IsRecording() || !ReplayIndex.IsValid())
+	{
+		return;
+	}
+
+	// the demo browser shows this without opening the replay
+	FShooterReplayInfo ReplayInfo;
+	ReplayInfo.Name = DemoDriver->GetActiveReplayName();
+	ReplayInfo.FriendlyName = ReplayInfo.Name;
+	ReplayInfo.LengthInMS = FMath::TruncToInt(DemoDriver->GetDemoTotalTime() * 1000.0f);
+	ReplayInfo.Timestamp = FDateTime::UtcNow() - FTimespan::FromMilliseconds(ReplayInfo.LengthInMS);
+	ReplayInfo.MapName = GetWorld()->GetMapName();
+	ReplayInfo.MapName.RemoveFromStart(GetWorld()->StreamingLevelsPrefix);
+	ReplayInfo.GameType = UGameplayStatics::ParseOption(OptionsString, TEXT("game"));
+
+	int32 TopScore = MIN_int32;
+	for (APlayerState* PlayerState : GameState->PlayerArray)
+	{
+		AShooterPlayerState* const ShooterPlayerState = Cast<AShooterPlayerState>(PlayerState);
+		if (ShooterPlayerState == nullptr)
+		{
+			continue;
+		}
+
+		ReplayInfo.NumKills += ShooterPlayerState->GetKills();
+
+		const int32 Score = FMath::TruncToInt(ShooterPlayerState->GetScore());
+		if (Score > TopScore)
+		{
+			TopScore = Score;
+			ReplayInfo.TopPlayerName = ShooterPlayerState->GetShortPlayerName();
+			ReplayInfo.TopPlayerScore = Score;
+		}
+	}
+
+	ReplayIndex->AddRecordedReplay(ReplayInfo);
+}
+
 void AShooterGameMode::RequestFinishAndExitToMainMenu()
 {
 	FinishMatch();
@@ -256,6 +421,10 @@ void AShooterGameMode::PreLogin(const FString& Options, const FString& Address,
 	{
 		ErrorMessage = TEXT("Match is over!");
 	}
+	else if (IsBotMatchSimulation())
+	{
+		ErrorMessage = TEXT("Server is running a bot simulation!");
+	}
 	else
 	{
 		// GameSession can be NULL if the match is over
@@ -298,6 +467,8 @@ void AShooterGameMode::Killed(AController* Killer, AController* KilledPlayer, AP
 	{
 		VictimPlayerState->ScoreDeath(KillerPlayerState, DeathScore);
 		VictimPlayerState->BroadcastDeath(KillerPlayerState, DamageType, VictimPlayerState);
+
+		AddReplayEvent(ShooterReplayEvents::Kill, FString::Printf(TEXT("%s > %s"), KillerPlayerState ? *KillerPlayerState->GetShortPlayerName() : TEXT(""), *VictimPlayerState->GetShortPlayerName()));
 	}
 }
 
@@ -354,6 +525,8 @@ UClass* AShooterGameMode::GetDefaultPawnClassForController_Implementation(AContr
 
 AActor* AShooterGameMode::ChoosePlayerStart_Implementation(AController* Player)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(ChoosePlayerStart);
+
 	TArray<APlayerStart*> PreferredSpawns;
 	TArray<APlayerStart*> FallbackSpawns;
 
@@ -524,17 +697,29 @@ void AShooterGameMode::RestartGame()
 	for (FConstControllerIterator It = GetWorld()->GetControllerIterator(); It; ++It)
 	{
 		AShooterPlayerController* PlayerController = Cast<AShooterPlayerController>(*It);
-		if (PlayerController != nullptr)
+		IShooterPlayerUI* PlayerUI = PlayerController ? PlayerController->GetPlayerUI() : nullptr;
+		if (PlayerUI != nullptr)
 		{
-			AShooterHUD* ShooterHUD = Cast<AShooterHUD>(PlayerController->GetHUD());
-			if (ShooterHUD != nullptr)
-			{
-				// Passing true to bFocus here ensures that focus is returned to the game viewport.
-				ShooterHUD->ShowScoreboard(false, true);
-			}
+			// Passing true to bFocus here ensures that focus is returned to the game viewport.
+			PlayerUI->ShowScoreboard(false, true);
 		}
 	}
 
-	Super::RestartGame();
+	UShooterGameInstance* const GameInstance = Cast<UShooterGameInstance>(GetGameInstance());
+	if (GameInstance)
+	{
+		GameInstance->NotifyMapTravelStarted();
+	}
+
+	AShooterGameState* const MyGameState = Cast<AShooterGameState>(GameState);
+	const FString NextMapName = MyGameState ? MyGameState->NextMapName : FString();
+	if (NextMapName.IsEmpty() || GetMatchState() == MatchState::LeavingMap || !GameSession->CanRestartGame())
+	{
+		Super::RestartGame();
+		return;
+	}
+
+	// relative travel keeps the options of the current URL (game type, bots, listen)
+	GetWorld()->ServerTravel(NextMapName);
 }
 
@@ -4,6 +4,7 @@
 #include "Online/ShooterGameSession.h"
 #include "Online/ShooterOnlineGameSettings.h"
 #include "OnlineSubsystemSessionSettings.h"
+#include "Icmp.h"
 
 namespace
 {
@@ -23,6 +24,16 @@ AShooterGameSession::AShooterGameSession(const FObjectInitializer& ObjectInitial
 
 		OnStartSessionCompleteDelegate = FOnStartSessionCompleteDelegate::CreateUObject(this, &AShooterGameSession::OnStartOnlineGameComplete);
 	}
+
+	MaxConcurrentQosPings = 16;
+	QosPingTimeout = 1.0f;
+	MatchmakingPingWeight = 1.0f;
+	MatchmakingFillWeight = 100.0f;
+	QosSearchId = 0;
+	NextQosPingIdx = 0;
+	NumQosPingsInFlight = 0;
+
+	PrimaryActorTick.bCanEverTick = true;
 }
 
 /**
@@ -267,19 +278,113 @@ void AShooterGameSession::OnFindSessionsComplete(bool bWasSuccessful)
 void AShooterGameSession::ResetBestSessionVars()
 {
 	CurrentSessionParams.BestSessionIdx = -1;
+	TriedSessionIdxs.Reset();
+}
+
+float AShooterGameSession::GetMatchmakingScore(const FOnlineSessionSearchResult& SearchResult) const
+{
+	const int32 MaxPlayers = SearchResult.Session.SessionSettings.NumPublicConnections + SearchResult.Session.SessionSettings.NumPrivateConnections;
+	const int32 NumPlayers = MaxPlayers - SearchResult.Session.NumOpenPublicConnections - SearchResult.Session.NumOpenPrivateConnections;
+	const float Fill = MaxPlayers > 0 ? (float)NumPlayers / MaxPlayers : 0.0f;
+
+	// prefer close servers, and between those the ones with players to play against
+	return SearchResult.PingInMs * MatchmakingPingWeight - Fill * MatchmakingFillWeight;
+}
+
+int32 AShooterGameSession::FindBestSessionIdx() const
+{
+	int32 BestIdx = -1;
+	float BestScore = 0.0f;
+
+	if (SearchSettings.IsValid())
+	{
+		for (int32 SessionIndex = 0; SessionIndex < SearchSettings->SearchResults.Num(); SessionIndex++)
+		{
+			const FOnlineSessionSearchResult& SearchResult = SearchSettings->SearchResults[SessionIndex];
+			if (TriedSessionIdxs.Contains(SessionIndex) || SearchResult.Session.NumOpenPublicConnections + SearchResult.Session.NumOpenPrivateConnections <= 0)
+			{
+				continue;
+			}
+
+			const float Score = GetMatchmakingScore(SearchResult);
+			if (BestIdx == -1 || Score < BestScore)
+			{
+				BestIdx = SessionIndex;
+				BestScore = Score;
+			}
+		}
+	}
+
+	return BestIdx;
 }
 
 void AShooterGameSession::ChooseBestSession()
 {
-	// Start searching from where we left off
-	for (int32 SessionIndex = CurrentSessionParams.BestSessionIdx+1; SessionIndex < SearchSettings->SearchResults.Num(); SessionIndex++)
+	// Sessions that failed to join are not tried again
+	CurrentSessionParams.BestSessionIdx = FindBestSessionIdx();
+	if (CurrentSessionParams.BestSessionIdx >= 0)
+	{
+		TriedSessionIdxs.Add(CurrentSessionParams.BestSessionIdx);
+	}
+}
+
+void AShooterGameSession::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (SearchSettings.IsValid())
+	{
+		StartQosPings();
+	}
+}
+
+void AShooterGameSession::StartQosPings()
+{
+	IOnlineSubsystem* const OnlineSub = IOnlineSubsystem::Get();
+	IOnlineSessionPtr Sessions = OnlineSub ? OnlineSub->GetSessionInterface() : NULL;
+	if (!Sessions.IsValid())
 	{
-		// Found the match that we want
-		CurrentSessionParams.BestSessionIdx = SessionIndex;
 		return;
 	}
 
-	CurrentSessionParams.BestSessionIdx = -1;
+	// results stream in while the search is running, ping them as they arrive with a few pings in parallel
+	while (NumQosPingsInFlight < MaxConcurrentQosPings && NextQosPingIdx < SearchSettings->SearchResults.Num())
+	{
+		const int32 SearchResultIdx = NextQosPingIdx++;
+
+		FString ConnectString, HostAddress;
+		if (Sessions->GetResolvedConnectString(SearchSettings->SearchResults[SearchResultIdx], NAME_GamePort, ConnectString))
+		{
+			if (!ConnectString.Split(TEXT(":"), &HostAddress, NULL, ESearchCase::IgnoreCase, ESearchDir::FromEnd))
+			{
+				HostAddress = ConnectString;
+			}
+
+			NumQosPingsInFlight++;
+
+			// FIcmpEchoResultCallback is a TFunction, the weak pointer drops echoes that arrive after the session is gone
+			TWeakObjectPtr<AShooterGameSession> WeakThis(this);
+			const int32 SearchId = QosSearchId;
+			FIcmp::IcmpEcho(HostAddress, QosPingTimeout, [WeakThis, SearchId, SearchResultIdx](FIcmpEchoResult Result)
+			{
+				if (WeakThis.IsValid())
+				{
+					WeakThis->OnQosPingComplete(Result, SearchId, SearchResultIdx);
+				}
+			});
+		}
+	}
+}
+
+void AShooterGameSession::OnQosPingComplete(FIcmpEchoResult Result, int32 SearchId, int32 SearchResultIdx)
+{
+	NumQosPingsInFlight--;
+
+	if (SearchId == QosSearchId && SearchSettings.IsValid() && SearchSettings->SearchResults.IsValidIndex(SearchResultIdx) && Result.Status == EIcmpResponseStatus::Success)
+	{
+		SearchSettings->SearchResults[SearchResultIdx].PingInMs = FMath::RoundToInt(Result.Time * 1000.0f);
+		SearchResultPingUpdatedEvent.Broadcast(SearchResultIdx);
+	}
 }
 
 void AShooterGameSession::StartMatchmaking()
@@ -331,6 +436,8 @@ void AShooterGameSession::FindSessions(TSharedPtr<const FUniqueNetId> UserId, FN
 		{
 			SearchSettings = MakeShareable(new FShooterOnlineSearchSettings(bIsLAN, bIsPresence));
 			SearchSettings->QuerySettings.Set(SEARCH_KEYWORDS, CustomMatchKeyword, EOnlineComparisonOp::Equals);
+			QosSearchId++;
+			NextQosPingIdx = 0;
 
 			TSharedRef<FOnlineSessionSearch> SearchSettingsRef = SearchSettings.ToSharedRef();
 
@@ -3,6 +3,7 @@
 #include "ShooterGame.h"
 #include "Online/ShooterPlayerState.h"
 #include "ShooterGameInstance.h"
+#include "Player/ShooterCorpseManager.h"
 
 AShooterGameState::AShooterGameState(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -11,6 +12,17 @@ AShooterGameState::AShooterGameState(const FObjectInitializer& ObjectInitializer
 	bTimerPaused = false;
 }
 
+bool AShooterGameState::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	const bool bProcessed = Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+	if (bProcessed)
+	{
+		SHOOTER_INC_COUNTER(RPCsSent);
+	}
+
+	return bProcessed;
+}
+
 void AShooterGameState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
@@ -19,10 +31,62 @@ void AShooterGameState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty >
 	DOREPLIFETIME( AShooterGameState, RemainingTime );
 	DOREPLIFETIME( AShooterGameState, bTimerPaused );
 	DOREPLIFETIME( AShooterGameState, TeamScores );
+	DOREPLIFETIME( AShooterGameState, NextMapName );
+}
+
+void AShooterGameState::SetNextMapName(const FString& InNextMapName)
+{
+	NextMapName = InNextMapName;
+	OnRep_NextMapName();
+}
+
+void AShooterGameState::OnRep_NextMapName()
+{
+	// replays don't travel
+	if (GetWorld()->IsPlayingReplay())
+	{
+		return;
+	}
+
+	UShooterGameInstance* const GameInstance = Cast<UShooterGameInstance>(GetGameInstance());
+	if (GameInstance)
+	{
+		GameInstance->PreloadNextMap(NextMapName);
+	}
+}
+
+FShooterCorpseManager* AShooterGameState::GetCorpseManager()
+{
+	if (!CorpseManager.IsValid() && !IsTemplate())
+	{
+		CorpseManager = MakeShareable(new FShooterCorpseManager(this));
+	}
+	return CorpseManager.Get();
+}
+
+void AShooterGameState::NotifyPlayerScoreChanged(AShooterPlayerState* PlayerState)
+{
+	PlayerScoreChangedEvent.Broadcast(PlayerState);
+}
+
+void AShooterGameState::AddPlayerState(APlayerState* PlayerState)
+{
+	Super::AddPlayerState(PlayerState);
+
+	NotifyPlayerScoreChanged(nullptr);
+}
+
+void AShooterGameState::RemovePlayerState(APlayerState* PlayerState)
+{
+	Super::RemovePlayerState(PlayerState);
+
+	NotifyPlayerScoreChanged(nullptr);
 }
 
 void AShooterGameState::GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(GetRankedMap);
+
 	OutRankedMap.Empty();
 
 	//first, we need to go over all the PlayerStates, grab their score, and rank them
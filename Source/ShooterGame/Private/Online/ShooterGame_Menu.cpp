@@ -2,9 +2,6 @@
 
 #include "ShooterGame.h"
 #include "Online/ShooterGame_Menu.h"
-#include "ShooterMainMenu.h"
-#include "ShooterWelcomeMenu.h"
-#include "ShooterMessageMenu.h"
 #include "Player/ShooterPlayerController_Menu.h"
 #include "Online/ShooterGameSession.h"
 
@@ -0,0 +1,163 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Online/ShooterLoadTestRecorder.h"
+#include "Online/ShooterPlayerState.h"
+#include "Misc/FileHelper.h"
+
+namespace ShooterLoadTest
+{
+	/** seconds between two samples */
+	static const double SampleInterval = 1.0;
+
+	/** the report outlives map changes, only the first recorder in the process starts a new file */
+	static bool bReportStarted = false;
+}
+
+FShooterLoadTestRecorder::FShooterLoadTestRecorder(AShooterGameMode* InGameMode, const FString& InReportFilename, float InDuration)
+	: GameMode(InGameMode)
+	, ReportFilename(InReportFilename)
+	, Duration(InDuration)
+	, StartTime(0.0)
+	, LastFrameTime(0.0)
+	, LastSampleTime(0.0)
+	, FrameMsSum(0.0f)
+	, FrameMsMax(0.0f)
+	, NumFrames(0)
+	, bFinished(false)
+{
+	// time is measured from process start so samples and duration carry over server travel
+	StartTime = GStartTime;
+	LastFrameTime = LastSampleTime = FPlatformTime::Seconds();
+
+	if (!ShooterLoadTest::bReportStarted)
+	{
+		ShooterLoadTest::bReportStarted = true;
+		FFileHelper::SaveStringToFile(TEXT("TimeSeconds,Connection,Player,AvgFrameMs,MaxFrameMs,InBytesPerSec,OutBytesPerSec,PingMs,HitsConfirmed,HitsRejected,MissReports,HitAccuracy,CpuPct\n"), *ReportFilename);
+
+		UE_LOG(LogShooter, Log, TEXT("Load test recording to %s"), *ReportFilename);
+	}
+}
+
+FShooterLoadTestRecorder::~FShooterLoadTestRecorder()
+{
+}
+
+TSharedPtr<FShooterLoadTestRecorder> FShooterLoadTestRecorder::CreateFromCommandLine(AShooterGameMode* InGameMode)
+{
+	FString ReportFilename;
+	if (InGameMode->GetNetMode() == NM_Client || !FParse::Value(FCommandLine::Get(), TEXT("LoadTestReport="), ReportFilename))
+	{
+		return nullptr;
+	}
+
+	if (FPaths::IsRelative(ReportFilename))
+	{
+		ReportFilename = FPaths::ProjectSavedDir() / TEXT("LoadTest") / ReportFilename;
+	}
+
+	float Duration = 0.0f;
+	FParse::Value(FCommandLine::Get(), TEXT("LoadTestDuration="), Duration);
+
+	return MakeShareable(new FShooterLoadTestRecorder(InGameMode, ReportFilename, Duration));
+}
+
+void FShooterLoadTestRecorder::Tick(float DeltaTime)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	const float FrameMs = (float)((CurrentTime - LastFrameTime) * 1000.0);
+	LastFrameTime = CurrentTime;
+
+	FrameMsSum += FrameMs;
+	FrameMsMax = FMath::Max(FrameMsMax, FrameMs);
+	NumFrames++;
+
+	if (CurrentTime - LastSampleTime >= ShooterLoadTest::SampleInterval)
+	{
+		WriteSample();
+
+		LastSampleTime = CurrentTime;
+		FrameMsSum = 0.0f;
+		FrameMsMax = 0.0f;
+		NumFrames = 0;
+	}
+
+	if (Duration > 0.0f && CurrentTime - StartTime >= Duration)
+	{
+		bFinished = true;
+		UE_LOG(LogShooter, Log, TEXT("Load test finished after %.1fs, report: %s"), CurrentTime - StartTime, *ReportFilename);
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+bool FShooterLoadTestRecorder::IsTickable() const
+{
+	return !bFinished && GameMode.IsValid();
+}
+
+bool FShooterLoadTestRecorder::IsTickableWhenPaused() const
+{
+	return true;
+}
+
+TStatId FShooterLoadTestRecorder::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FShooterLoadTestRecorder, STATGROUP_Tickables);
+}
+
+void FShooterLoadTestRecorder::WriteSample()
+{
+	const AShooterGameMode* MyGameMode = GameMode.Get();
+	const UNetDriver* NetDriver = MyGameMode->GetWorld() ? MyGameMode->GetWorld()->GetNetDriver() : nullptr;
+
+	const float TimeSeconds = (float)(FPlatformTime::Seconds() - StartTime);
+	const float AvgFrameMs = NumFrames > 0 ? FrameMsSum / NumFrames : 0.0f;
+	const float CpuPct = FPlatformTime::GetCPUTime().CPUTimePctRelative;
+
+	int32 TotalInBytes = 0;
+	int32 TotalOutBytes = 0;
+	float TotalPing = 0.0f;
+	int32 TotalConfirmed = 0;
+	int32 TotalRejected = 0;
+	int32 TotalMisses = 0;
+	int32 NumConnections = 0;
+
+	FString Csv;
+	if (NetDriver)
+	{
+		for (const UNetConnection* Connection : NetDriver->ClientConnections)
+		{
+			const APlayerController* PC = Connection ? Connection->PlayerController : nullptr;
+			const AShooterPlayerState* PlayerState = PC ? Cast<AShooterPlayerState>(PC->PlayerState) : nullptr;
+			if (PlayerState == nullptr)
+			{
+				continue;
+			}
+
+			const int32 Confirmed = PlayerState->GetNumHitsConfirmed();
+			const int32 Rejected = PlayerState->GetNumHitsRejected();
+			const int32 Misses = PlayerState->GetNumMissReports();
+			const float PingMs = PlayerState->ExactPing;
+
+			Csv += FString::Printf(TEXT("%.2f,%d,%s,%.3f,%.3f,%d,%d,%.1f,%d,%d,%d,%.4f,%.1f\n"),
+				TimeSeconds, NumConnections, *PlayerState->GetPlayerName().Replace(TEXT(","), TEXT(" ")), AvgFrameMs, FrameMsMax,
+				Connection->InBytesPerSecond, Connection->OutBytesPerSecond, PingMs,
+				Confirmed, Rejected, Misses, (Confirmed + Rejected) > 0 ? (float)Confirmed / (Confirmed + Rejected) : 1.0f, CpuPct);
+
+			TotalInBytes += Connection->InBytesPerSecond;
+			TotalOutBytes += Connection->OutBytesPerSecond;
+			TotalPing += PingMs;
+			TotalConfirmed += Confirmed;
+			TotalRejected += Rejected;
+			TotalMisses += Misses;
+			NumConnections++;
+		}
+	}
+
+	Csv += FString::Printf(TEXT("%.2f,ALL,%d players,%.3f,%.3f,%d,%d,%.1f,%d,%d,%d,%.4f,%.1f\n"),
+		TimeSeconds, NumConnections, AvgFrameMs, FrameMsMax, TotalInBytes, TotalOutBytes,
+		NumConnections > 0 ? TotalPing / NumConnections : 0.0f,
+		TotalConfirmed, TotalRejected, TotalMisses, (TotalConfirmed + TotalRejected) > 0 ? (float)TotalConfirmed / (TotalConfirmed + TotalRejected) : 1.0f, CpuPct);
+
+	FFileHelper::SaveStringToFile(Csv, *ReportFilename, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
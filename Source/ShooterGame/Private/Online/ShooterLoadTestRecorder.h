@@ -0,0 +1,67 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Tickable.h"
+
+class AShooterGameMode;
+
+/**
+ * Server side recorder for headless load tests.
+ *
+ * Enabled on a dedicated server with -LoadTestReport=<file.csv>. Once per sample interval a row is appended
+ * for every client connection (bandwidth, ping, hit registration) plus an ALL row with the server frame time
+ * and totals. With -LoadTestDuration=<seconds> the server exits on its own once the duration has elapsed.
+ * Clients are expected to run with -LoadTestBot -nullrhi, see Build/LoadTest/ShooterGameLoadTest.sh.
+ */
+class FShooterLoadTestRecorder : public FTickableGameObject
+{
+public:
+
+	FShooterLoadTestRecorder(AShooterGameMode* InGameMode, const FString& InReportFilename, float InDuration);
+	virtual ~FShooterLoadTestRecorder();
+
+	/** creates a recorder if the command line asks for one */
+	static TSharedPtr<FShooterLoadTestRecorder> CreateFromCommandLine(AShooterGameMode* InGameMode);
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+
+	/** append one sample for each connection */
+	void WriteSample();
+
+	/** owning game mode */
+	TWeakObjectPtr<AShooterGameMode> GameMode;
+
+	/** CSV file the samples are appended to */
+	FString ReportFilename;
+
+	/** wall clock seconds after which the server exits, 0 to run until killed */
+	float Duration;
+
+	/** wall clock time the process started */
+	double StartTime;
+
+	/** wall clock time of the previous tick */
+	double LastFrameTime;
+
+	/** wall clock time of the last written sample */
+	double LastSampleTime;
+
+	/** frame time accumulated since the last sample, in milliseconds */
+	float FrameMsSum;
+
+	/** worst frame time since the last sample, in milliseconds */
+	float FrameMsMax;
+
+	/** frames since the last sample */
+	int32 NumFrames;
+
+	/** exit was already requested */
+	bool bFinished;
+};
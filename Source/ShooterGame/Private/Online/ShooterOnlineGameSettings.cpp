@@ -1,7 +1,7 @@
 // Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
 
 #include "ShooterGame.h"
-#include "ShooterOnlineGameSettings.h"
+#include "Online/ShooterOnlineGameSettings.h"
 
 
 FShooterOnlineSessionSettings::FShooterOnlineSessionSettings(bool bIsLAN, bool bIsPresence, int32 MaxNumPlayers)
@@ -24,7 +24,8 @@ FShooterOnlineSessionSettings::FShooterOnlineSessionSettings(bool bIsLAN, bool b
 FShooterOnlineSearchSettings::FShooterOnlineSearchSettings(bool bSearchingLAN, bool bSearchingPresence)
 {
 	bIsLanQuery = bSearchingLAN;
-	MaxSearchResults = 10;
+	// results are streamed into a virtualized list, so large LAN and internet searches are fine
+	MaxSearchResults = 2000;
 	PingBucketSize = 50;
 
 	if (bSearchingPresence)
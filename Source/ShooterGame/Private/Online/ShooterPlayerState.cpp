@@ -2,6 +2,8 @@
 
 #include "ShooterGame.h"
 #include "Online/ShooterPlayerState.h"
+#include "ShooterGameUIInterface.h"
+#include "Weapons/ShooterWeapon.h"
 
 AShooterPlayerState::AShooterPlayerState(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -10,6 +12,10 @@ AShooterPlayerState::AShooterPlayerState(const FObjectInitializer& ObjectInitial
 	NumDeaths = 0;
 	NumBulletsFired = 0;
 	NumRocketsFired = 0;
+	NumBulletHits = 0;
+	NumHitsConfirmed = 0;
+	NumHitsRejected = 0;
+	NumMissReports = 0;
 	bQuitter = false;
 }
 
@@ -23,7 +29,13 @@ void AShooterPlayerState::Reset()
 	NumDeaths = 0;
 	NumBulletsFired = 0;
 	NumRocketsFired = 0;
+	NumBulletHits = 0;
+	NumHitsConfirmed = 0;
+	NumHitsRejected = 0;
+	NumMissReports = 0;
 	bQuitter = false;
+
+	NotifyScoreChanged();
 }
 
 void AShooterPlayerState::UnregisterPlayerWithSession()
@@ -46,11 +58,62 @@ void AShooterPlayerState::SetTeamNum(int32 NewTeamNumber)
 	TeamNumber = NewTeamNumber;
 
 	UpdateTeamColors();
+	NotifyScoreChanged();
 }
 
 void AShooterPlayerState::OnRep_TeamColor()
 {
 	UpdateTeamColors();
+	NotifyScoreChanged();
+}
+
+void AShooterPlayerState::OnRep_Kills()
+{
+	NotifyScoreChanged();
+}
+
+void AShooterPlayerState::OnRep_Deaths()
+{
+	NotifyScoreChanged();
+}
+
+void AShooterPlayerState::OnRep_Score()
+{
+	Super::OnRep_Score();
+
+	NotifyScoreChanged();
+}
+
+void AShooterPlayerState::OnRep_PlayerName()
+{
+	Super::OnRep_PlayerName();
+
+	NotifyScoreChanged();
+}
+
+void AShooterPlayerState::NotifyScoreChanged()
+{
+	UpdateHUDViewModels();
+
+	AShooterGameState* const MyGameState = GetWorld()->GetGameState<AShooterGameState>();
+	if (MyGameState)
+	{
+		MyGameState->NotifyPlayerScoreChanged(this);
+	}
+}
+
+void AShooterPlayerState::UpdateHUDViewModels()
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		// ranking depends on everybody's score, so every local player is refreshed
+		AShooterPlayerController* TestPC = Cast<AShooterPlayerController>(*It);
+		IShooterPlayerUI* PlayerUI = TestPC ? TestPC->GetPlayerUI() : nullptr;
+		if (PlayerUI)
+		{
+			PlayerUI->UpdateScore();
+		}
+	}
 }
 
 void AShooterPlayerState::AddBulletsFired(int32 NumBullets)
@@ -63,6 +126,28 @@ void AShooterPlayerState::AddRocketsFired(int32 NumRockets)
 	NumRocketsFired += NumRockets;
 }
 
+void AShooterPlayerState::AddBulletHits(int32 NumHits)
+{
+	NumBulletHits += NumHits;
+}
+
+void AShooterPlayerState::AddHitReport(bool bConfirmed)
+{
+	if (bConfirmed)
+	{
+		NumHitsConfirmed++;
+	}
+	else
+	{
+		NumHitsRejected++;
+	}
+}
+
+void AShooterPlayerState::AddMissReport()
+{
+	NumMissReports++;
+}
+
 void AShooterPlayerState::SetQuitter(bool bInQuitter)
 {
 	bQuitter = bInQuitter;
@@ -79,6 +164,38 @@ void AShooterPlayerState::CopyProperties(APlayerState* PlayerState)
 	}	
 }
 
+void AShooterPlayerState::Destroyed()
+{
+	Super::Destroyed();
+
+	for (AShooterWeapon* Weapon : StoredWeapons)
+	{
+		if (Weapon && !Weapon->IsPendingKill())
+		{
+			Weapon->Destroy();
+		}
+	}
+	StoredWeapons.Reset();
+}
+
+void AShooterPlayerState::StoreWeapon(AShooterWeapon* Weapon)
+{
+	Weapon->OnStored();
+	StoredWeapons.AddUnique(Weapon);
+}
+
+void AShooterPlayerState::TakeStoredWeapons(TArray<AShooterWeapon*>& OutWeapons)
+{
+	for (AShooterWeapon* Weapon : StoredWeapons)
+	{
+		if (Weapon && !Weapon->IsPendingKill())
+		{
+			OutWeapons.Add(Weapon);
+		}
+	}
+	StoredWeapons.Reset();
+}
+
 void AShooterPlayerState::UpdateTeamColors()
 {
 	AController* OwnerController = Cast<AController>(GetOwner());
@@ -122,6 +239,26 @@ int32 AShooterPlayerState::GetNumRocketsFired() const
 	return NumRocketsFired;
 }
 
+int32 AShooterPlayerState::GetNumBulletHits() const
+{
+	return NumBulletHits;
+}
+
+int32 AShooterPlayerState::GetNumHitsConfirmed() const
+{
+	return NumHitsConfirmed;
+}
+
+int32 AShooterPlayerState::GetNumHitsRejected() const
+{
+	return NumHitsRejected;
+}
+
+int32 AShooterPlayerState::GetNumMissReports() const
+{
+	return NumMissReports;
+}
+
 bool AShooterPlayerState::IsQuitter() const
 {
 	return bQuitter;
@@ -153,6 +290,8 @@ void AShooterPlayerState::ScorePoints(int32 Points)
 	}
 
 	SetScore(GetScore() + Points);
+
+	NotifyScoreChanged();
 }
 
 void AShooterPlayerState::InformAboutKill_Implementation(class AShooterPlayerState* KillerPlayerState, const UDamageType* KillerDamageType, class AShooterPlayerState* KilledPlayerState)
@@ -191,6 +330,17 @@ void AShooterPlayerState::BroadcastDeath_Implementation(class AShooterPlayerStat
 	}	
 }
 
+bool AShooterPlayerState::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	const bool bProcessed = Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+	if (bProcessed)
+	{
+		SHOOTER_INC_COUNTER(RPCsSent);
+	}
+
+	return bProcessed;
+}
+
 void AShooterPlayerState::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
@@ -147,6 +147,17 @@ void AShooterPickup::OnRep_IsActive()
 	}
 }
 
+bool AShooterPickup::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	const bool bProcessed = Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+	if (bProcessed)
+	{
+		SHOOTER_INC_COUNTER(RPCsSent);
+	}
+
+	return bProcessed;
+}
+
 void AShooterPickup::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
@@ -3,12 +3,17 @@
 #include "ShooterGame.h"
 #include "Weapons/ShooterWeapon.h"
 #include "Weapons/ShooterDamageType.h"
-#include "UI/ShooterHUD.h"
+#include "ShooterGameUIInterface.h"
 #include "Online/ShooterPlayerState.h"
+#include "Player/ShooterDemoSpectator.h"
+#include "Player/ShooterHitboxComponent.h"
+#include "Player/ShooterCorpseManager.h"
+#include "Bots/ShooterBotMatchSimulator.h"
 #include "Animation/AnimMontage.h"
 #include "Animation/AnimInstance.h"
 #include "Sound/SoundNodeLocalPlayer.h"
 #include "AudioThread.h"
+#include "ShooterAssetManager.h"
 
 static int32 NetVisualizeRelevancyTestPoints = 0;
 FAutoConsoleVariableRef CVarNetVisualizeRelevancyTestPoints(
@@ -55,6 +60,9 @@ AShooterCharacter::AShooterCharacter(const FObjectInitializer& ObjectInitializer
 	GetCapsuleComponent()->SetCollisionResponseToChannel(COLLISION_PROJECTILE, ECR_Block);
 	GetCapsuleComponent()->SetCollisionResponseToChannel(COLLISION_WEAPON, ECR_Ignore);
 
+	HitboxComponent = ObjectInitializer.CreateDefaultSubobject<UShooterHitboxComponent>(this, TEXT("Hitboxes"));
+	HitboxComponent->SetupAttachment(GetMesh());
+
 	TargetingSpeedModifier = 0.5f;
 	bIsTargeting = false;
 	RunningSpeedModifier = 1.5f;
@@ -85,26 +93,53 @@ void AShooterCharacter::PostInitializeComponents()
 		MeshMIDs.Add(GetMesh()->CreateAndSetMaterialInstanceDynamic(iMat));
 	}
 
+	// weapon traces hit the hitbox proxy instead of the mesh
+	if (UShooterHitboxComponent::ShouldUseHitboxes(GetWorld()))
+	{
+		HitboxComponent->EnableHitboxes(GetMesh());
+	}
+
 	// play respawn effects
+#if SHOOTER_WITH_COSMETICS
 	if (GetNetMode() != NM_DedicatedServer)
 	{
-		if (RespawnFX)
+		if (!RespawnFX.IsNull())
 		{
-			UGameplayStatics::SpawnEmitterAtLocation(this, RespawnFX, GetActorLocation(), GetActorRotation());
+			UGameplayStatics::SpawnEmitterAtLocation(this, UShooterAssetManager::GetClientAsset(RespawnFX), GetActorLocation(), GetActorRotation());
 		}
 
-		if (RespawnSound)
+		if (!RespawnSound.IsNull())
 		{
-			UGameplayStatics::PlaySoundAtLocation(this, RespawnSound, GetActorLocation());
+			UGameplayStatics::PlaySoundAtLocation(this, UShooterAssetManager::GetClientAsset(RespawnSound), GetActorLocation());
 		}
 	}
+#endif
 }
 
 void AShooterCharacter::Destroyed()
 {
 	Super::Destroyed();
-	DestroyInventory();
+
+	// a corpse gave its weapons away when it died, on clients it still lists the ones the next pawn uses
+	if (!GetTearOff())
+	{
+		DestroyInventory();
+	}
+}
+
+FPrimaryAssetId AShooterCharacter::GetPrimaryAssetId() const
+{
+	return UShooterAssetManager::GetBlueprintPrimaryAssetId(this, UShooterAssetManager::CharacterType);
+}
+
+#if WITH_EDITOR
+void AShooterCharacter::PreSave(const ITargetPlatform* TargetPlatform)
+{
+	Super::PreSave(TargetPlatform);
+
+	UShooterAssetManager::UpdateAssetBundleData(this, AssetBundleData);
 }
+#endif
 
 void AShooterCharacter::PawnClientRestart()
 {
@@ -125,6 +160,9 @@ void AShooterCharacter::PossessedBy(class AController* InController)
 {
 	Super::PossessedBy(InController);
 
+	// [server] the PlayerState is known now, it may hold the weapons of the previous life
+	ReuseStoredWeapons();
+
 	// [server] as soon as PlayerState is assigned, set team colors of this pawn for local player
 	UpdateTeamColorsAllMIDs();
 }
@@ -270,6 +308,9 @@ float AShooterCharacter::TakeDamage(float Damage, struct FDamageEvent const& Dam
 	if (ActualDamage > 0.f)
 	{
 		Health -= ActualDamage;
+		UpdateHUDViewModel();
+		FShooterBotMatchSimulator::NotifyDamageDealt(ActualDamage);
+
 		if (Health <= 0)
 		{
 			Die(ActualDamage, DamageEvent, EventInstigator, DamageCauser);
@@ -309,6 +350,7 @@ bool AShooterCharacter::Die(float KillingDamage, FDamageEvent const& DamageEvent
 	}
 
 	Health = FMath::Min(0.0f, Health);
+	UpdateHUDViewModel();
 
 	// if this is an environmental death then refer to the previous killer so that they receive credit (knocked into lava pits, etc)
 	UDamageType const* const DamageType = DamageEvent.DamageTypeClass ? DamageEvent.DamageTypeClass->GetDefaultObject<UDamageType>() : GetDefault<UDamageType>();
@@ -357,13 +399,15 @@ void AShooterCharacter::OnDeath(float KillingDamage, struct FDamageEvent const&
 	}
 
 	// cannot use IsLocallyControlled here, because even local client's controller may be NULL here
-	if (GetNetMode() != NM_DedicatedServer && DeathSound && Mesh1P && Mesh1P->IsVisible())
+#if SHOOTER_WITH_COSMETICS
+	if (GetNetMode() != NM_DedicatedServer && !DeathSound.IsNull() && Mesh1P && Mesh1P->IsVisible())
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, DeathSound, GetActorLocation());
+		UGameplayStatics::PlaySoundAtLocation(this, UShooterAssetManager::GetClientAsset(DeathSound), GetActorLocation());
 	}
+#endif
 
-	// remove all weapons
-	DestroyInventory();
+	// remove all weapons, the PlayerState keeps them for the next life
+	StoreInventory();
 
 	// switch back to 3rd person view
 	UpdatePawnMeshes();
@@ -388,8 +432,15 @@ void AShooterCharacter::OnDeath(float KillingDamage, struct FDamageEvent const&
 	}
 	SetActorEnableCollision(true);
 
-	// Death anim
-	float DeathAnimDuration = PlayAnimMontage(DeathAnim);
+	// Death anim, skipped when a replay is scrubbed through
+	float DeathAnimDuration = AShooterDemoSpectator::IsFastPlayback(GetWorld()) ? 0.0f : PlayAnimMontage(DeathAnim);
+
+	// corpses are counted, the oldest ones go away when there are too many
+	FShooterCorpseManager* const CorpseManager = FShooterCorpseManager::Get(GetWorld());
+	if (CorpseManager)
+	{
+		CorpseManager->AddCorpse(this);
+	}
 
 	// Ragdoll
 	if (DeathAnimDuration > 0.f)
@@ -398,12 +449,22 @@ void AShooterCharacter::OnDeath(float KillingDamage, struct FDamageEvent const&
 		// blend back to its normal position.
 		const float TriggerRagdollTime = DeathAnimDuration - 0.7f;
 
-		// Enable blend physics so the bones are properly blending against the montage.
-		GetMesh()->bBlendPhysics = true;
-
 		// Use a local timer handle as we don't need to store it for later but we don't need to look for something to clear
 		FTimerHandle TimerHandle;
-		GetWorldTimerManager().SetTimer(TimerHandle, this, &AShooterCharacter::SetRagdollPhysics, FMath::Max(0.1f, TriggerRagdollTime), false);
+		if (CorpseManager == nullptr || CorpseManager->ShouldRagdoll(this))
+		{
+			// Enable blend physics so the bones are properly blending against the montage.
+			GetMesh()->bBlendPhysics = true;
+
+			GetWorldTimerManager().SetTimer(TimerHandle, this, &AShooterCharacter::SetRagdollPhysics, FMath::Max(0.1f, TriggerRagdollTime), false);
+		}
+		else
+		{
+			// nobody is close enough to see it fall, hold the pose the animation ends in
+			SHOOTER_INC_COUNTER(AnimationOnlyDeaths);
+			GetWorldTimerManager().SetTimer(TimerHandle, this, &AShooterCharacter::FreezeCorpse, FMath::Max(0.1f, TriggerRagdollTime), false);
+			SetLifeSpan(FMath::Max(0.1f, TriggerRagdollTime) + 10.0f);
+		}
 	}
 	else
 	{
@@ -411,6 +472,7 @@ void AShooterCharacter::OnDeath(float KillingDamage, struct FDamageEvent const&
 	}
 
 	// disable collisions on capsule
+	HitboxComponent->DisableHitboxes();
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	GetCapsuleComponent()->SetCollisionResponseToAllChannels(ECR_Ignore);
 }
@@ -467,6 +529,11 @@ void AShooterCharacter::SetRagdollPhysics()
 	{
 		bInRagdoll = false;
 	}
+	else if (AShooterDemoSpectator::IsFastPlayback(GetWorld()))
+	{
+		// no physics for corpses nobody has time to look at
+		bInRagdoll = false;
+	}
 	else if (!GetMesh() || !GetMesh()->GetPhysicsAsset())
 	{
 		bInRagdoll = false;
@@ -479,6 +546,13 @@ void AShooterCharacter::SetRagdollPhysics()
 		GetMesh()->bBlendPhysics = true;
 
 		bInRagdoll = true;
+
+		// the ragdoll budget freezes it once it settles, or earlier when newer ones need the room
+		FShooterCorpseManager* const CorpseManager = FShooterCorpseManager::Get(GetWorld());
+		if (CorpseManager)
+		{
+			CorpseManager->AddRagdoll(this);
+		}
 	}
 
 	GetCharacterMovement()->StopMovementImmediately();
@@ -498,6 +572,22 @@ void AShooterCharacter::SetRagdollPhysics()
 	}
 }
 
+void AShooterCharacter::FreezeCorpse()
+{
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->DisableMovement();
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+
+	// without physics or animation updates the bones stay where they are, and the bodies stop costing simulation time
+	USkeletalMeshComponent* const MyMesh = GetMesh();
+	if (MyMesh)
+	{
+		MyMesh->SetSimulatePhysics(false);
+		MyMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		MyMesh->SetComponentTickEnabled(false);
+	}
+}
+
 
 
 void AShooterCharacter::ReplicateHit(float Damage, struct FDamageEvent const& DamageEvent, class APawn* PawnInstigator, class AActor* DamageCauser, bool bKilled)
@@ -528,6 +618,21 @@ void AShooterCharacter::ReplicateHit(float Damage, struct FDamageEvent const& Da
 	LastTakeHitTimeTimeout = TimeoutTime;
 }
 
+void AShooterCharacter::OnRep_Health()
+{
+	UpdateHUDViewModel();
+}
+
+void AShooterCharacter::UpdateHUDViewModel()
+{
+	AShooterPlayerController* PC = Cast<AShooterPlayerController>(Controller);
+	IShooterPlayerUI* PlayerUI = PC ? PC->GetPlayerUI() : nullptr;
+	if (PlayerUI)
+	{
+		PlayerUI->UpdatePawn(this);
+	}
+}
+
 void AShooterCharacter::OnRep_LastTakeHitInfo()
 {
 	if (LastTakeHitInfo.bKilled)
@@ -580,6 +685,58 @@ void AShooterCharacter::SpawnDefaultInventory()
 	}
 }
 
+void AShooterCharacter::ReuseStoredWeapons()
+{
+	AShooterPlayerState* MyPlayerState = GetPlayerState<AShooterPlayerState>();
+	if (GetLocalRole() < ROLE_Authority || MyPlayerState == NULL)
+	{
+		return;
+	}
+
+	// the pawn is possessed in the frame it spawned, so its new weapons haven't replicated yet: swapping them for the
+	// ones clients already have from the previous life means only those are ever sent
+	TArray<AShooterWeapon*> StoredWeapons;
+	MyPlayerState->TakeStoredWeapons(StoredWeapons);
+
+	for (int32 i = 0; i < Inventory.Num() && StoredWeapons.Num() > 0; i++)
+	{
+		AShooterWeapon* SpawnedWeapon = Inventory[i];
+		if (SpawnedWeapon == NULL)
+		{
+			continue;
+		}
+
+		UClass* const WeaponClass = SpawnedWeapon->GetClass();
+		const int32 StoredIndex = StoredWeapons.IndexOfByPredicate([WeaponClass](const AShooterWeapon* Weapon) { return Weapon->GetClass() == WeaponClass; });
+		if (StoredIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		AShooterWeapon* StoredWeapon = StoredWeapons[StoredIndex];
+		StoredWeapons.RemoveAt(StoredIndex);
+		StoredWeapon->ResetForReuse();
+		StoredWeapon->OnEnterInventory(this);
+		Inventory[i] = StoredWeapon;
+
+		if (CurrentWeapon == SpawnedWeapon)
+		{
+			// no last weapon, so no equip animation on a pawn that just spawned
+			SetCurrentWeapon(StoredWeapon, NULL);
+		}
+
+		SpawnedWeapon->OnLeaveInventory();
+		SpawnedWeapon->Destroy();
+		SHOOTER_INC_COUNTER(WeaponsReused);
+	}
+
+	// kept weapons this pawn doesn't carry
+	for (AShooterWeapon* Weapon : StoredWeapons)
+	{
+		Weapon->Destroy();
+	}
+}
+
 void AShooterCharacter::DestroyInventory()
 {
 	if (GetLocalRole() < ROLE_Authority)
@@ -599,6 +756,35 @@ void AShooterCharacter::DestroyInventory()
 	}
 }
 
+void AShooterCharacter::StoreInventory()
+{
+	// torn off corpses are authority on clients too, only the server hands weapons around
+	if (GetLocalRole() < ROLE_Authority || GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	AShooterPlayerState* MyPlayerState = GetPlayerState<AShooterPlayerState>();
+	if (MyPlayerState == NULL)
+	{
+		DestroyInventory();
+		return;
+	}
+
+	// unequip and hide the weapons, they stay dormant until the next pawn picks them up
+	for (int32 i = Inventory.Num() - 1; i >= 0; i--)
+	{
+		AShooterWeapon* Weapon = Inventory[i];
+		if (Weapon)
+		{
+			RemoveWeapon(Weapon);
+			MyPlayerState->StoreWeapon(Weapon);
+		}
+	}
+
+	CurrentWeapon = NULL;
+}
+
 void AShooterCharacter::AddWeapon(AShooterWeapon* Weapon)
 {
 	if (Weapon && GetLocalRole() == ROLE_Authority)
@@ -688,6 +874,8 @@ void AShooterCharacter::SetCurrentWeapon(AShooterWeapon* NewWeapon, AShooterWeap
 
 		NewWeapon->OnEquip(LastWeapon);
 	}
+
+	UpdateHUDViewModel();
 }
 
 
@@ -732,9 +920,9 @@ void AShooterCharacter::SetTargeting(bool bNewTargeting)
 {
 	bIsTargeting = bNewTargeting;
 
-	if (TargetingSound)
+	if (!TargetingSound.IsNull())
 	{
-		UGameplayStatics::SpawnSoundAttached(TargetingSound, GetRootComponent());
+		UGameplayStatics::SpawnSoundAttached(UShooterAssetManager::GetClientAsset(TargetingSound), GetRootComponent());
 	}
 
 	if (GetLocalRole() < ROLE_Authority)
@@ -779,6 +967,7 @@ void AShooterCharacter::ServerSetRunning_Implementation(bool bNewRunning, bool b
 
 void AShooterCharacter::UpdateRunSounds()
 {
+#if SHOOTER_WITH_COSMETICS
 	const bool bIsRunSoundPlaying = RunLoopAC != nullptr && RunLoopAC->IsActive();
 	const bool bWantsRunSoundPlaying = IsRunning() && IsMoving();
 
@@ -789,9 +978,9 @@ void AShooterCharacter::UpdateRunSounds()
 		{
 			RunLoopAC->Play();
 		}
-		else if (RunLoopSound != nullptr)
+		else if (!RunLoopSound.IsNull())
 		{
-			RunLoopAC = UGameplayStatics::SpawnSoundAttached(RunLoopSound, GetRootComponent());
+			RunLoopAC = UGameplayStatics::SpawnSoundAttached(UShooterAssetManager::GetClientAsset(RunLoopSound), GetRootComponent());
 			if (RunLoopAC != nullptr)
 			{
 				RunLoopAC->bAutoDestroy = false;
@@ -801,11 +990,12 @@ void AShooterCharacter::UpdateRunSounds()
 	else if (bIsRunSoundPlaying && !bWantsRunSoundPlaying)
 	{
 		RunLoopAC->Stop();
-		if (RunStopSound != nullptr)
+		if (!RunStopSound.IsNull())
 		{
-			UGameplayStatics::SpawnSoundAttached(RunStopSound, GetRootComponent());
+			UGameplayStatics::SpawnSoundAttached(UShooterAssetManager::GetClientAsset(RunStopSound), GetRootComponent());
 		}
 	}
+#endif
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1061,16 +1251,25 @@ void AShooterCharacter::Tick(float DeltaSeconds)
 			{
 				Health = this->GetMaxHealth();
 			}
+			UpdateHUDViewModel();
 		}
 	}
 
+	IShooterPlayerUI* PlayerUI = MyPC ? MyPC->GetPlayerUI() : nullptr;
+	if (PlayerUI)
+	{
+		// running depends on velocity, so crosshair visibility is the one HUD value refreshed every frame
+		PlayerUI->UpdateCrosshair(this);
+	}
+
+#if SHOOTER_WITH_COSMETICS
 	if (GEngine->UseSound())
 	{
-		if (LowHealthSound)
+		if (!LowHealthSound.IsNull())
 		{
 			if ((this->Health > 0 && this->Health < this->GetMaxHealth() * LowHealthPercentage) && (!LowHealthWarningPlayer || !LowHealthWarningPlayer->IsPlaying()))
 			{
-				LowHealthWarningPlayer = UGameplayStatics::SpawnSoundAttached(LowHealthSound, GetRootComponent(),
+				LowHealthWarningPlayer = UGameplayStatics::SpawnSoundAttached(UShooterAssetManager::GetClientAsset(LowHealthSound), GetRootComponent(),
 					NAME_None, FVector(ForceInit), EAttachLocation::KeepRelativeOffset, true);
 				LowHealthWarningPlayer->SetVolumeMultiplier(0.0f);
 			}
@@ -1096,6 +1295,7 @@ void AShooterCharacter::Tick(float DeltaSeconds)
 	{
 	    USoundNodeLocalPlayer::GetLocallyControlledActorCache().Add(UniqueID, bLocallyControlled);
 	});
+#endif
 	
 	TArray<FVector> PointsToTest;
 	BuildPauseReplicationCheckPoints(PointsToTest);
@@ -1149,6 +1349,17 @@ void AShooterCharacter::PreReplication(IRepChangedPropertyTracker & ChangedPrope
 	DOREPLIFETIME_ACTIVE_OVERRIDE(AShooterCharacter, LastTakeHitInfo, GetWorld() && GetWorld()->GetTimeSeconds() < LastTakeHitTimeTimeout);
 }
 
+bool AShooterCharacter::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	const bool bProcessed = Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+	if (bProcessed)
+	{
+		SHOOTER_INC_COUNTER(RPCsSent);
+	}
+
+	return bProcessed;
+}
+
 void AShooterCharacter::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -1169,6 +1380,8 @@ void AShooterCharacter::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > &
 
 bool AShooterCharacter::IsReplicationPausedForConnection(const FNetViewer& ConnectionOwnerNetViewer)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(IsReplicationPaused);
+
 	if (NetEnablePauseRelevancy == 1)
 	{
 		APlayerController* PC = Cast<APlayerController>(ConnectionOwnerNetViewer.InViewer);
@@ -1186,6 +1399,7 @@ bool AShooterCharacter::IsReplicationPausedForConnection(const FNetViewer& Conne
 
 		for (FVector PointToTest : PointsToTest)
 		{
+			SHOOTER_INC_COUNTER(Traces);
 			if (!GetWorld()->LineTraceTestByChannel(PointToTest, ViewLocation, ECC_Visibility, CollisionParams))
 			{
 				return false;
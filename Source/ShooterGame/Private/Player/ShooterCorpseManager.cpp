@@ -0,0 +1,176 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Player/ShooterCorpseManager.h"
+
+static int32 ShooterMaxRagdolls = 8;
+FAutoConsoleVariableRef CVarShooterMaxRagdolls(
+	TEXT("p.ShooterMaxRagdolls"),
+	ShooterMaxRagdolls,
+	TEXT("Most corpses simulating physics at once, a new ragdoll freezes the oldest one beyond that."),
+	ECVF_Default);
+
+static int32 ShooterMaxCorpses = 24;
+FAutoConsoleVariableRef CVarShooterMaxCorpses(
+	TEXT("p.ShooterMaxCorpses"),
+	ShooterMaxCorpses,
+	TEXT("Most corpses in the world, the oldest ones are removed beyond that."),
+	ECVF_Default);
+
+static float ShooterRagdollDistance = 5000.0f;
+FAutoConsoleVariableRef CVarShooterRagdollDistance(
+	TEXT("p.ShooterRagdollDistance"),
+	ShooterRagdollDistance,
+	TEXT("Characters dying further than this from every local player only play their death animation, 0 to always ragdoll."),
+	ECVF_Default);
+
+namespace ShooterCorpses
+{
+	/** root body speed below which a ragdoll is at rest */
+	const float SettledSpeed = 15.0f;
+
+	/** time at rest before a ragdoll is frozen */
+	const float SettledTime = 0.5f;
+
+	/** longest a ragdoll simulates, in case it never comes to rest */
+	const float MaxRagdollTime = 8.0f;
+}
+
+FShooterCorpseManager::FShooterCorpseManager(AShooterGameState* InGameState)
+	: GameState(InGameState)
+{
+}
+
+FShooterCorpseManager* FShooterCorpseManager::Get(const UWorld* World)
+{
+	AShooterGameState* const MyGameState = World ? World->GetGameState<AShooterGameState>() : nullptr;
+	return MyGameState ? MyGameState->GetCorpseManager() : nullptr;
+}
+
+bool FShooterCorpseManager::ShouldRagdoll(const AShooterCharacter* Corpse) const
+{
+	if (ShooterRagdollDistance <= 0.0f)
+	{
+		return true;
+	}
+
+	const FVector CorpseLocation = Corpse->GetActorLocation();
+	for (FConstPlayerControllerIterator It = Corpse->GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			if (FVector::DistSquared(ViewLocation, CorpseLocation) <= FMath::Square(ShooterRagdollDistance))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void FShooterCorpseManager::AddCorpse(AShooterCharacter* Corpse)
+{
+	Corpses.RemoveAll([](const TWeakObjectPtr<AShooterCharacter>& Other) { return !Other.IsValid(); });
+	Corpses.Add(Corpse);
+
+	while (Corpses.Num() > FMath::Max(ShooterMaxCorpses, 1))
+	{
+		AShooterCharacter* const OldestCorpse = Corpses[0].Get();
+		Corpses.RemoveAt(0);
+		if (OldestCorpse)
+		{
+			OldestCorpse->Destroy();
+		}
+	}
+
+	UpdateStats();
+}
+
+void FShooterCorpseManager::AddRagdoll(AShooterCharacter* Corpse)
+{
+	Ragdolls.RemoveAll([](const FShooterRagdoll& Other) { return !Other.Corpse.IsValid(); });
+	while (Ragdolls.Num() >= FMath::Max(ShooterMaxRagdolls, 1))
+	{
+		FreezeOldestRagdoll();
+	}
+
+	FShooterRagdoll Ragdoll;
+	Ragdoll.Corpse = Corpse;
+	Ragdoll.StartTime = Corpse->GetWorld()->GetTimeSeconds();
+	Ragdoll.SettledTime = 0.0f;
+	Ragdolls.Add(Ragdoll);
+
+	UpdateStats();
+}
+
+void FShooterCorpseManager::FreezeOldestRagdoll()
+{
+	AShooterCharacter* const OldestCorpse = Ragdolls[0].Corpse.Get();
+	Ragdolls.RemoveAt(0);
+	if (OldestCorpse)
+	{
+		OldestCorpse->FreezeCorpse();
+	}
+}
+
+void FShooterCorpseManager::Tick(float DeltaTime)
+{
+	SHOOTER_SCOPE_CYCLE_COUNTER(CorpseManager);
+
+	const float TimeSeconds = GameState->GetWorld()->GetTimeSeconds();
+	for (int32 Index = Ragdolls.Num() - 1; Index >= 0; Index--)
+	{
+		FShooterRagdoll& Ragdoll = Ragdolls[Index];
+		AShooterCharacter* const Corpse = Ragdoll.Corpse.Get();
+		USkeletalMeshComponent* const Mesh = Corpse ? Corpse->GetMesh() : nullptr;
+		if (Mesh == nullptr || !Mesh->IsSimulatingPhysics())
+		{
+			Ragdolls.RemoveAt(Index);
+			continue;
+		}
+
+		const bool bAtRest = !Mesh->IsAnyRigidBodyAwake() || Mesh->GetPhysicsLinearVelocity().SizeSquared() < FMath::Square(ShooterCorpses::SettledSpeed);
+		Ragdoll.SettledTime = bAtRest ? Ragdoll.SettledTime + DeltaTime : 0.0f;
+		if (Ragdoll.SettledTime >= ShooterCorpses::SettledTime || TimeSeconds - Ragdoll.StartTime >= ShooterCorpses::MaxRagdollTime)
+		{
+			Ragdolls.RemoveAt(Index);
+			Corpse->FreezeCorpse();
+		}
+	}
+
+	UpdateStats();
+}
+
+bool FShooterCorpseManager::IsTickable() const
+{
+	return Ragdolls.Num() > 0 && GameState.IsValid();
+}
+
+bool FShooterCorpseManager::IsTickableWhenPaused() const
+{
+	return false;
+}
+
+TStatId FShooterCorpseManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FShooterCorpseManager, STATGROUP_Tickables);
+}
+
+void FShooterCorpseManager::UpdateStats() const
+{
+	int32 NumCorpses = 0;
+	for (const TWeakObjectPtr<AShooterCharacter>& Corpse : Corpses)
+	{
+		NumCorpses += Corpse.IsValid() ? 1 : 0;
+	}
+
+	SET_DWORD_STAT(STAT_ShooterActiveRagdolls, Ragdolls.Num());
+	SET_DWORD_STAT(STAT_ShooterCorpses, NumCorpses);
+	CSV_CUSTOM_STAT(ShooterGame, ActiveRagdolls, Ragdolls.Num(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(ShooterGame, Corpses, NumCorpses, ECsvCustomStatOp::Set);
+}
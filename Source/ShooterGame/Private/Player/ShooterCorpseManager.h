@@ -0,0 +1,71 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Tickable.h"
+
+class AShooterCharacter;
+class AShooterGameState;
+
+/**
+ * Keeps the cost of dead characters bounded.
+ *
+ * At most p.ShooterMaxRagdolls corpses simulate at once: a new ragdoll freezes the oldest one when the budget is
+ * full, and ragdolls are frozen in their current pose as soon as they settle. Deaths further than
+ * p.ShooterRagdollDistance from every local player only play the death animation. Beyond p.ShooterMaxCorpses
+ * the oldest corpses are removed. Timings and counts show up in stat Physics.
+ */
+class FShooterCorpseManager : public FTickableGameObject
+{
+public:
+
+	FShooterCorpseManager(AShooterGameState* InGameState);
+
+	/** corpse manager of World, null until the game state exists */
+	static FShooterCorpseManager* Get(const UWorld* World);
+
+	/** is a local player close enough for Corpse to ragdoll, or should it only play its death animation */
+	bool ShouldRagdoll(const AShooterCharacter* Corpse) const;
+
+	/** track a new corpse, removing the oldest ones beyond the corpse limit */
+	void AddCorpse(AShooterCharacter* Corpse);
+
+	/** track a corpse that started simulating, freezing the oldest ragdolls beyond the budget */
+	void AddRagdoll(AShooterCharacter* Corpse);
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+
+	/** a simulating corpse */
+	struct FShooterRagdoll
+	{
+		/** the corpse */
+		TWeakObjectPtr<AShooterCharacter> Corpse;
+
+		/** game time the ragdoll started */
+		float StartTime;
+
+		/** how long it has been at rest */
+		float SettledTime;
+	};
+
+	/** freeze the oldest ragdoll */
+	void FreezeOldestRagdoll();
+
+	/** update the stats */
+	void UpdateStats() const;
+
+	/** owning game state */
+	TWeakObjectPtr<AShooterGameState> GameState;
+
+	/** all corpses, oldest first */
+	TArray<TWeakObjectPtr<AShooterCharacter>> Corpses;
+
+	/** simulating corpses, oldest first */
+	TArray<FShooterRagdoll> Ragdolls;
+};
@@ -2,8 +2,7 @@
 
 #include "ShooterGame.h"
 #include "Player/ShooterDemoSpectator.h"
-#include "UI/Menu/ShooterDemoPlaybackMenu.h"
-#include "UI/Widgets/SShooterDemoHUD.h"
+#include "ShooterGameUIInterface.h"
 #include "Engine/DemoNetDriver.h"
 
 AShooterDemoSpectator::AShooterDemoSpectator(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -11,6 +10,9 @@ AShooterDemoSpectator::AShooterDemoSpectator(const FObjectInitializer& ObjectIni
 	bShowMouseCursor = true;
 	PrimaryActorTick.bTickEvenWhenPaused = true;
 	bShouldPerformFullTickWhenPaused = true;
+
+	FastPlaybackSpeed = 4.0f;
+	FastPlaybackEffectInterval = 4;
 }
 
 void AShooterDemoSpectator::SetupInputComponent()
@@ -28,20 +30,11 @@ void AShooterDemoSpectator::SetPlayer( UPlayer* InPlayer )
 {
 	Super::SetPlayer( InPlayer );
 
-	// Build menu only after game is initialized
-	ShooterDemoPlaybackMenu = MakeShareable( new FShooterDemoPlaybackMenu() );
-	ShooterDemoPlaybackMenu->Construct( Cast< ULocalPlayer >( Player ) );
-
-	// Create HUD if this is playback
-	if (GetWorld() != nullptr && GetWorld()->GetDemoNetDriver() != nullptr && !GetWorld()->GetDemoNetDriver()->IsServer())
+	// Build menu and playback HUD only after game is initialized
+	IShooterGameUIModule* const UIModule = IShooterGameUIModule::Get();
+	if (UIModule != nullptr && !DemoUI.IsValid())
 	{
-		if (GEngine != nullptr && GEngine->GameViewport != nullptr)
-		{
-			DemoHUD = SNew(SShooterDemoHUD)
-				.PlayerOwner(this);
-
-			GEngine->GameViewport->AddViewportWidgetContent(DemoHUD.ToSharedRef());
-		}
+		DemoUI = UIModule->CreateDemoUI(this);
 	}
 
 	FActorSpawnParameters SpawnInfo;
@@ -53,7 +46,7 @@ void AShooterDemoSpectator::SetPlayer( UPlayer* InPlayer )
 	PlaybackSpeed = 2;
 
 	FInputModeGameAndUI InputMode;
-	InputMode.SetWidgetToFocus(DemoHUD);
+	InputMode.SetWidgetToFocus(DemoUI.IsValid() ? DemoUI->GetFocusWidget() : nullptr);
 
 	SetInputMode(InputMode);
 }
@@ -61,35 +54,53 @@ void AShooterDemoSpectator::SetPlayer( UPlayer* InPlayer )
 void AShooterDemoSpectator::OnToggleInGameMenu()
 {
 	// if no one's paused, pause
-	if ( ShooterDemoPlaybackMenu.IsValid() )
+	if ( DemoUI.IsValid() )
 	{
-		ShooterDemoPlaybackMenu->ToggleGameMenu();
+		DemoUI->ToggleGameMenu();
 	}
 }
 
-static float PlaybackSpeedLUT[5] = { 0.1f, 0.5f, 1.0f, 2.0f, 4.0f };
+static float PlaybackSpeedLUT[8] = { 0.1f, 0.5f, 1.0f, 2.0f, 4.0f, 8.0f, 16.0f, 32.0f };
 
 void AShooterDemoSpectator::OnIncreasePlaybackSpeed()
 {
-	PlaybackSpeed = FMath::Clamp( PlaybackSpeed + 1, 0, 4 );
+	PlaybackSpeed = FMath::Clamp( PlaybackSpeed + 1, 0, (int32)UE_ARRAY_COUNT(PlaybackSpeedLUT) - 1 );
 
 	GetWorldSettings()->DemoPlayTimeDilation = PlaybackSpeedLUT[ PlaybackSpeed ];
 }
 
 void AShooterDemoSpectator::OnDecreasePlaybackSpeed()
 {
-	PlaybackSpeed = FMath::Clamp( PlaybackSpeed - 1, 0, 4 );
+	PlaybackSpeed = FMath::Clamp( PlaybackSpeed - 1, 0, (int32)UE_ARRAY_COUNT(PlaybackSpeedLUT) - 1 );
 
 	GetWorldSettings()->DemoPlayTimeDilation = PlaybackSpeedLUT[ PlaybackSpeed ];
 }
 
-void AShooterDemoSpectator::Destroyed()
+bool AShooterDemoSpectator::IsFastPlayback(const UWorld* World)
+{
+	const AWorldSettings* WorldSettings = World ? World->GetWorldSettings() : nullptr;
+	return WorldSettings != nullptr && World->IsPlayingReplay() && WorldSettings->DemoPlayTimeDilation >= GetDefault<AShooterDemoSpectator>()->FastPlaybackSpeed;
+}
+
+bool AShooterDemoSpectator::ShouldSkipCosmeticEffect(const UWorld* World)
 {
-	if (GEngine != nullptr && GEngine->GameViewport != nullptr && DemoHUD.IsValid())
+	if (!IsFastPlayback(World))
 	{
-		// Remove HUD
-		GEngine->GameViewport->RemoveViewportWidgetContent(DemoHUD.ToSharedRef());
+		return false;
 	}
 
+	// keeps the number of effects per real second about the same however fast the replay plays
+	const AShooterDemoSpectator* DefaultSpectator = GetDefault<AShooterDemoSpectator>();
+	const int32 Interval = FMath::Max(1, FMath::RoundToInt(DefaultSpectator->FastPlaybackEffectInterval * World->GetWorldSettings()->DemoPlayTimeDilation / DefaultSpectator->FastPlaybackSpeed));
+
+	static uint32 CosmeticEffectCounter = 0;
+	return (CosmeticEffectCounter++ % Interval) != 0;
+}
+
+void AShooterDemoSpectator::Destroyed()
+{
+	// removes the playback HUD from the viewport
+	DemoUI.Reset();
+
 	Super::Destroyed();
 }
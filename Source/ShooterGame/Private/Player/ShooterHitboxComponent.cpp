@@ -0,0 +1,362 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Player/ShooterHitboxComponent.h"
+#include "AnimationRuntime.h"
+#include "BonePose.h"
+#include "Animation/AnimSequence.h"
+#include "Components/CapsuleComponent.h"
+#include "EngineUtils.h"
+
+static int32 ShooterServerHitboxes = 0;
+FAutoConsoleVariableRef CVarShooterServerHitboxes(
+	TEXT("p.ShooterServerHitboxes"),
+	ShooterServerHitboxes,
+	TEXT("Hitbox proxies for weapon traces on dedicated servers, read when a character spawns.\n")
+	TEXT("0: Trace the skeletal meshes (default), 1: Trace the hitboxes"),
+	ECVF_Default);
+
+static int32 ShooterCompareHitboxes = 0;
+FAutoConsoleVariableRef CVarShooterCompareHitboxes(
+	TEXT("p.ShooterCompareHitboxes"),
+	ShooterCompareHitboxes,
+	TEXT("Also trace the skeletal meshes of characters using hitboxes and count the hits the two disagree on (stat ShooterGame).\n")
+	TEXT("Needs bSimulateSkeletalMeshOnDedicatedServer=True and p.ShooterServerHitboxes 1.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Cheat);
+
+/** mesh space capsules of one mesh, for each cached pose */
+struct FShooterHitboxPoseSet
+{
+	/** capsule transform per shape, Z along the bone group */
+	TArray<FTransform> ShapeTransforms[EShooterHitboxPose::MAX];
+
+	/** capsule half height per shape */
+	TArray<float> HalfHeights[EShooterHitboxPose::MAX];
+
+	/** location the aim pitch rotates around */
+	FVector AimPivot[EShooterHitboxPose::MAX];
+
+	/** shapes whose bones exist in the mesh */
+	TBitArray<> ValidShapes;
+};
+
+namespace ShooterHitboxes
+{
+	/** pose sets by mesh and component archetype (which holds the shapes and animations) */
+	static TMap<TPair<FObjectKey, FObjectKey>, TSharedPtr<FShooterHitboxPoseSet>> PoseSets;
+
+	/** component space bone transforms of Mesh in the first frame of Animation, or in the reference pose */
+	static void GetComponentSpacePose(USkeletalMesh* Mesh, const UAnimSequence* Animation, TArray<FTransform>& OutComponentSpace)
+	{
+		const FReferenceSkeleton& RefSkeleton = Mesh->RefSkeleton;
+		TArray<FTransform> LocalSpace = RefSkeleton.GetRefBonePose();
+
+		if (Animation && Animation->GetSkeleton() == Mesh->Skeleton)
+		{
+			TArray<FBoneIndexType> RequiredBones;
+			RequiredBones.SetNumUninitialized(RefSkeleton.GetNum());
+			for (int32 BoneIndex = 0; BoneIndex < RequiredBones.Num(); BoneIndex++)
+			{
+				RequiredBones[BoneIndex] = (FBoneIndexType)BoneIndex;
+			}
+
+			FBoneContainer BoneContainer(RequiredBones, FCurveEvaluationOption(false), *Mesh);
+			FCompactPose Pose;
+			Pose.SetBoneContainer(&BoneContainer);
+			FBlendedCurve Curve;
+			Curve.InitFrom(BoneContainer);
+
+			Animation->GetBonePose(Pose, Curve, FAnimExtractContext(0.0f));
+
+			for (FCompactPoseBoneIndex CompactIndex : Pose.ForEachBoneIndex())
+			{
+				LocalSpace[BoneContainer.MakeMeshPoseIndex(CompactIndex).GetInt()] = Pose[CompactIndex];
+			}
+		}
+		else if (Animation)
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Hitbox pose %s doesn't match the skeleton of %s, using the reference pose"), *GetNameSafe(Animation), *GetNameSafe(Mesh));
+		}
+
+		FAnimationRuntime::FillUpComponentSpaceTransforms(RefSkeleton, LocalSpace, OutComponentSpace);
+	}
+}
+
+UShooterHitboxComponent::UShooterHitboxComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostPhysics;
+
+	// bone groups of HeroTPP
+	Shapes.Add(FShooterHitboxShape(TEXT("b_head"), NAME_None, 12.0f, true));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_Spine"), TEXT("b_Neck"), 18.0f, true));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_Hips"), TEXT("b_Spine"), 16.0f, false));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_LeftArm"), TEXT("b_LeftForeArm"), 6.0f, true));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_LeftForeArm"), TEXT("b_LeftHand"), 5.0f, true));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_RightArm"), TEXT("b_RightForeArm"), 6.0f, true));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_RightForeArm"), TEXT("b_RightHand"), 5.0f, true));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_LeftUpLeg"), TEXT("b_LeftLeg"), 9.0f, false));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_LeftLeg"), TEXT("b_LeftFoot"), 7.0f, false));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_RightUpLeg"), TEXT("b_RightLeg"), 9.0f, false));
+	Shapes.Add(FShooterHitboxShape(TEXT("b_RightLeg"), TEXT("b_RightFoot"), 7.0f, false));
+	AimPivotBone = TEXT("b_Spine");
+	AimPitchTolerance = 2.0f;
+
+	IdlePoseAnimation = TSoftObjectPtr<UAnimSequence>(FSoftObjectPath(TEXT("/Game/Animations/TTP_Animations/Idle.Idle")));
+	RunPoseAnimation = TSoftObjectPtr<UAnimSequence>(FSoftObjectPath(TEXT("/Game/Animations/TTP_Animations/Run_Fwd.Run_Fwd")));
+	SprintPoseAnimation = TSoftObjectPtr<UAnimSequence>(FSoftObjectPath(TEXT("/Game/Animations/TTP_Animations/RoadieRun_Fwd.RoadieRun_Fwd")));
+	FallPoseAnimation = TSoftObjectPtr<UAnimSequence>(FSoftObjectPath(TEXT("/Game/Animations/TTP_Animations/JumpLoop.JumpLoop")));
+
+	AppliedPose = EShooterHitboxPose::MAX;
+	AppliedAimPitch = 0.0f;
+}
+
+bool UShooterHitboxComponent::ShouldUseHitboxes(const UWorld* World)
+{
+	if (World == nullptr || World->GetNetMode() != NM_DedicatedServer)
+	{
+		return false;
+	}
+
+	// opt-in; without simulated meshes (bSimulateSkeletalMeshOnDedicatedServer=False) turn this on, or nothing is hit
+	return ShooterServerHitboxes != 0;
+}
+
+void UShooterHitboxComponent::EnableHitboxes(USkeletalMeshComponent* Mesh)
+{
+	if (Mesh == nullptr || Mesh->SkeletalMesh == nullptr || AreHitboxesEnabled())
+	{
+		return;
+	}
+
+	USkeletalMesh* SkeletalMesh = Mesh->SkeletalMesh;
+	TSharedPtr<FShooterHitboxPoseSet>& CachedPoseSet = ShooterHitboxes::PoseSets.FindOrAdd(TPair<FObjectKey, FObjectKey>(SkeletalMesh, GetArchetype()));
+	if (!CachedPoseSet.IsValid())
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		const FReferenceSkeleton& RefSkeleton = SkeletalMesh->RefSkeleton;
+		const TSoftObjectPtr<UAnimSequence>* PoseAnimations[EShooterHitboxPose::MAX] = { &IdlePoseAnimation, &RunPoseAnimation, &SprintPoseAnimation, &FallPoseAnimation };
+
+		CachedPoseSet = MakeShareable(new FShooterHitboxPoseSet());
+		CachedPoseSet->ValidShapes.Init(false, Shapes.Num());
+		for (int32 ShapeIdx = 0; ShapeIdx < Shapes.Num(); ShapeIdx++)
+		{
+			const FShooterHitboxShape& Shape = Shapes[ShapeIdx];
+			const bool bValid = RefSkeleton.FindBoneIndex(Shape.StartBone) != INDEX_NONE && (Shape.EndBone == NAME_None || RefSkeleton.FindBoneIndex(Shape.EndBone) != INDEX_NONE);
+			if (!bValid)
+			{
+				UE_LOG(LogShooter, Warning, TEXT("Hitbox %s-%s: bone not found in %s"), *Shape.StartBone.ToString(), *Shape.EndBone.ToString(), *SkeletalMesh->GetName());
+			}
+			CachedPoseSet->ValidShapes[ShapeIdx] = bValid;
+		}
+
+		TArray<FTransform> ComponentSpace;
+		for (int32 Pose = 0; Pose < EShooterHitboxPose::MAX; Pose++)
+		{
+			ShooterHitboxes::GetComponentSpacePose(SkeletalMesh, PoseAnimations[Pose]->LoadSynchronous(), ComponentSpace);
+
+			const int32 PivotIndex = RefSkeleton.FindBoneIndex(AimPivotBone);
+			CachedPoseSet->AimPivot[Pose] = PivotIndex != INDEX_NONE ? ComponentSpace[PivotIndex].GetLocation() : FVector::ZeroVector;
+			CachedPoseSet->ShapeTransforms[Pose].SetNum(Shapes.Num());
+			CachedPoseSet->HalfHeights[Pose].SetNum(Shapes.Num());
+
+			for (int32 ShapeIdx = 0; ShapeIdx < Shapes.Num(); ShapeIdx++)
+			{
+				if (!CachedPoseSet->ValidShapes[ShapeIdx])
+				{
+					continue;
+				}
+
+				const FShooterHitboxShape& Shape = Shapes[ShapeIdx];
+				const FVector Start = ComponentSpace[RefSkeleton.FindBoneIndex(Shape.StartBone)].GetLocation();
+				const FVector End = Shape.EndBone != NAME_None ? ComponentSpace[RefSkeleton.FindBoneIndex(Shape.EndBone)].GetLocation() : Start;
+				const FVector Axis = End - Start;
+
+				const FQuat Rotation = Axis.IsNearlyZero() ? FQuat::Identity : FRotationMatrix::MakeFromZ(Axis).ToQuat();
+				CachedPoseSet->ShapeTransforms[Pose][ShapeIdx] = FTransform(Rotation, (Start + End) * 0.5f);
+				CachedPoseSet->HalfHeights[Pose][ShapeIdx] = Axis.Size() * 0.5f + Shape.Radius;
+			}
+		}
+
+		UE_LOG(LogShooter, Log, TEXT("Cached %d hitbox poses for %s in %.2f ms"), (int32)EShooterHitboxPose::MAX, *SkeletalMesh->GetName(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+	PoseSet = CachedPoseSet;
+
+	AActor* MyOwner = GetOwner();
+	Capsules.SetNum(Shapes.Num());
+	for (int32 ShapeIdx = 0; ShapeIdx < Shapes.Num(); ShapeIdx++)
+	{
+		if (!PoseSet->ValidShapes[ShapeIdx])
+		{
+			continue;
+		}
+
+		UCapsuleComponent* Capsule = NewObject<UCapsuleComponent>(MyOwner, NAME_None, RF_Transient);
+		Capsule->SetupAttachment(this);
+		Capsule->SetCollisionObjectType(ECC_Pawn);
+		Capsule->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Capsule->SetCollisionResponseToAllChannels(ECR_Ignore);
+		Capsule->SetCollisionResponseToChannel(COLLISION_WEAPON, ECR_Block);
+		Capsule->SetGenerateOverlapEvents(false);
+		Capsule->SetCanEverAffectNavigation(false);
+		Capsule->RegisterComponent();
+		Capsules[ShapeIdx] = Capsule;
+	}
+
+	// weapon traces hit the capsules from now on
+	Mesh->SetCollisionResponseToChannel(COLLISION_WEAPON, ECR_Ignore);
+
+	AppliedPose = EShooterHitboxPose::MAX;
+	SetComponentTickEnabled(true);
+}
+
+void UShooterHitboxComponent::DisableHitboxes()
+{
+	for (UCapsuleComponent* Capsule : Capsules)
+	{
+		if (Capsule)
+		{
+			Capsule->DestroyComponent();
+		}
+	}
+	Capsules.Reset();
+	PoseSet.Reset();
+
+	SetComponentTickEnabled(false);
+}
+
+bool UShooterHitboxComponent::AreHitboxesEnabled() const
+{
+	return PoseSet.IsValid();
+}
+
+EShooterHitboxPose::Type UShooterHitboxComponent::GetCurrentPose() const
+{
+	const AShooterCharacter* MyPawn = Cast<AShooterCharacter>(GetOwner());
+	if (MyPawn == nullptr)
+	{
+		return EShooterHitboxPose::Idle;
+	}
+
+	if (MyPawn->GetCharacterMovement() && MyPawn->GetCharacterMovement()->IsFalling())
+	{
+		return EShooterHitboxPose::Fall;
+	}
+
+	if (MyPawn->GetVelocity().SizeSquared2D() < FMath::Square(10.0f))
+	{
+		return EShooterHitboxPose::Idle;
+	}
+
+	return MyPawn->IsRunning() ? EShooterHitboxPose::Sprint : EShooterHitboxPose::Run;
+}
+
+void UShooterHitboxComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SHOOTER_SCOPE_CYCLE_COUNTER(UpdateHitboxes);
+
+	if (!PoseSet.IsValid())
+	{
+		return;
+	}
+
+	const APawn* MyPawn = Cast<APawn>(GetOwner());
+	const float AimPitch = MyPawn ? FRotator::NormalizeAxis(MyPawn->GetBaseAimRotation().Pitch) : 0.0f;
+	const EShooterHitboxPose::Type Pose = GetCurrentPose();
+
+	if (Pose != AppliedPose || FMath::Abs(AimPitch - AppliedAimPitch) > AimPitchTolerance)
+	{
+		ApplyPose(Pose, AimPitch);
+	}
+}
+
+void UShooterHitboxComponent::ApplyPose(EShooterHitboxPose::Type Pose, float AimPitch)
+{
+	// pitch turns around the pawn's right axis, expressed in the space of the mesh we're attached to
+	const FVector PitchAxis = GetAttachParent() ? GetAttachParent()->GetRelativeRotation().UnrotateVector(FVector::RightVector) : FVector::RightVector;
+	const FQuat AimRotation(PitchAxis, FMath::DegreesToRadians(-AimPitch));
+	const FVector& AimPivot = PoseSet->AimPivot[Pose];
+
+	for (int32 ShapeIdx = 0; ShapeIdx < Capsules.Num(); ShapeIdx++)
+	{
+		UCapsuleComponent* Capsule = Capsules[ShapeIdx];
+		if (Capsule == nullptr)
+		{
+			continue;
+		}
+
+		FTransform ShapeTransform = PoseSet->ShapeTransforms[Pose][ShapeIdx];
+		if (Shapes[ShapeIdx].bFollowsAim)
+		{
+			ShapeTransform.SetLocation(AimPivot + AimRotation.RotateVector(ShapeTransform.GetLocation() - AimPivot));
+			ShapeTransform.SetRotation(AimRotation * ShapeTransform.GetRotation());
+		}
+
+		if (Pose != AppliedPose)
+		{
+			Capsule->SetCapsuleSize(Shapes[ShapeIdx].Radius, PoseSet->HalfHeights[Pose][ShapeIdx], false);
+		}
+		Capsule->SetRelativeTransform(ShapeTransform, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	AppliedPose = Pose;
+	AppliedAimPitch = AimPitch;
+}
+
+void UShooterHitboxComponent::CompareWithMeshTrace(const UWorld* World, const AActor* IgnoreActor, const FVector& StartTrace, const FVector& EndTrace, const FHitResult& Hit)
+{
+	if (ShooterCompareHitboxes == 0 || World == nullptr || World->GetNetMode() != NM_DedicatedServer)
+	{
+		return;
+	}
+
+	// what is behind a pawn hit is unknown, so the meshes are traced up to the first thing that isn't a pawn
+	const AShooterCharacter* HitboxHitPawn = Cast<AShooterCharacter>(Hit.GetActor());
+	const FVector MeshTraceEnd = (Hit.bBlockingHit && HitboxHitPawn == nullptr) ? Hit.ImpactPoint : EndTrace;
+
+	const AShooterCharacter* MeshHitPawn = nullptr;
+	float ClosestMeshHitDistSq = MAX_flt;
+	FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(CompareHitboxTrace), false);
+	for (TActorIterator<AShooterCharacter> It(World); It; ++It)
+	{
+		const UShooterHitboxComponent* Hitboxes = It->FindComponentByClass<UShooterHitboxComponent>();
+		if (Hitboxes == nullptr || !Hitboxes->AreHitboxesEnabled() || *It == IgnoreActor)
+		{
+			continue;
+		}
+
+		FHitResult MeshHit;
+		if (It->GetMesh()->LineTraceComponent(MeshHit, StartTrace, MeshTraceEnd, TraceParams))
+		{
+			const float DistSq = FVector::DistSquared(StartTrace, MeshHit.ImpactPoint);
+			if (DistSq < ClosestMeshHitDistSq)
+			{
+				ClosestMeshHitDistSq = DistSq;
+				MeshHitPawn = *It;
+			}
+		}
+	}
+
+	if (HitboxHitPawn == MeshHitPawn)
+	{
+		if (HitboxHitPawn != nullptr)
+		{
+			SHOOTER_INC_COUNTER(HitboxAgreedHits);
+		}
+	}
+	else
+	{
+		if (HitboxHitPawn != nullptr)
+		{
+			SHOOTER_INC_COUNTER(HitboxOnlyHits);
+		}
+		if (MeshHitPawn != nullptr)
+		{
+			SHOOTER_INC_COUNTER(MeshOnlyHits);
+		}
+	}
+}
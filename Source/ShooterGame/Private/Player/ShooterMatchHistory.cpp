@@ -0,0 +1,445 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "Player/ShooterMatchHistory.h"
+#include "Async/Async.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace ShooterMatchHistory
+{
+	static const uint32 FileMagic = 0x484D5353; // 'SSMH'
+	static const uint32 IndexMagic = 0x494D5353; // 'SSMI'
+
+	/** bump when the record or header layout changes, older files are started over */
+	static const uint32 FileVersion = 2;
+
+	/** history file header bytes, written once when the file is created */
+	static const int32 HeaderSize = 16;
+
+	/** index file bytes, the unused tail is zero so totals can be added */
+	static const int32 IndexSize = 128;
+
+	/** bytes per match record */
+	static const int32 RecordSize = 64;
+
+	static const int32 MapNameSize = 20;
+	static const int32 GameTypeSize = 8;
+
+	/** fixed-size, zero terminated UTF-8 string */
+	static void SerializeFixedString(FArchive& Ar, FString& Value, int32 Size)
+	{
+		ANSICHAR Buffer[32];
+		check(Size <= UE_ARRAY_COUNT(Buffer));
+		FMemory::Memzero(Buffer);
+
+		if (Ar.IsSaving())
+		{
+			FTCHARToUTF8 Converter(*Value);
+			FMemory::Memcpy(Buffer, Converter.Get(), FMath::Min(Converter.Length(), Size - 1));
+		}
+
+		Ar.Serialize(Buffer, Size);
+
+		if (Ar.IsLoading())
+		{
+			Buffer[Size - 1] = 0;
+			Value = UTF8_TO_TCHAR(Buffer);
+		}
+	}
+
+	static void SerializeRecord(FArchive& Ar, FShooterMatchRecord& Match)
+	{
+		const int64 StartOffset = Ar.Tell();
+
+		int64 TimestampTicks = Match.Timestamp.GetTicks();
+		uint32 Flags = Match.bIsWinner ? 1 : 0;
+
+		Ar << TimestampTicks;
+		SerializeFixedString(Ar, Match.MapName, MapNameSize);
+		SerializeFixedString(Ar, Match.GameType, GameTypeSize);
+		Ar << Match.Kills;
+		Ar << Match.Deaths;
+		Ar << Match.BulletsFired;
+		Ar << Match.BulletHits;
+		Ar << Match.RocketsFired;
+		Ar << Match.DurationSeconds;
+		Ar << Flags;
+
+		check(Ar.IsError() || Ar.Tell() - StartOffset == RecordSize);
+
+		if (Ar.IsLoading())
+		{
+			Match.Timestamp = FDateTime(TimestampTicks);
+			Match.bIsWinner = (Flags & 1) != 0;
+		}
+	}
+
+	/** returns false if the header isn't one this build wrote */
+	static bool SerializeHeader(FArchive& Ar)
+	{
+		uint32 Magic = FileMagic;
+		uint32 Version = FileVersion;
+		uint32 StoredRecordSize = RecordSize;
+		uint32 Reserved = 0;
+
+		Ar << Magic;
+		Ar << Version;
+		Ar << StoredRecordSize;
+		Ar << Reserved;
+
+		return !Ar.IsError() && Magic == FileMagic && Version == FileVersion && StoredRecordSize == RecordSize;
+	}
+
+	/** returns false if the index isn't one this build wrote */
+	static bool SerializeIndex(FArchive& Ar, FShooterMatchTotals& Totals)
+	{
+		uint32 Magic = IndexMagic;
+		uint32 Version = FileVersion;
+		uint32 StoredRecordSize = RecordSize;
+		uint32 Reserved = 0;
+
+		Ar << Magic;
+		Ar << Version;
+		Ar << StoredRecordSize;
+		Ar << Reserved;
+		Ar << Totals.NumMatches;
+		Ar << Totals.Wins;
+		Ar << Totals.Kills;
+		Ar << Totals.Deaths;
+		Ar << Totals.BulletsFired;
+		Ar << Totals.BulletHits;
+		Ar << Totals.RocketsFired;
+		Ar << Totals.DurationSeconds;
+
+		uint8 Padding[IndexSize] = { 0 };
+		Ar.Serialize(Padding, IndexSize - Ar.Tell());
+
+		return !Ar.IsError() && Magic == IndexMagic && Version == FileVersion && StoredRecordSize == RecordSize;
+	}
+
+	/** complete records in a history file of FileSize bytes */
+	static int64 GetNumRecords(int64 FileSize)
+	{
+		return FileSize > HeaderSize ? (FileSize - HeaderSize) / RecordSize : 0;
+	}
+
+	/** history file size with NumRecords records */
+	static int64 GetFileSize(int64 NumRecords)
+	{
+		return HeaderSize + NumRecords * RecordSize;
+	}
+
+	/** write a file next to Filename and move it into place, so readers never see half of it */
+	static bool ReplaceFile(const TArray<uint8>& Data, const FString& Filename)
+	{
+		const FString TempFilename = Filename + TEXT(".tmp");
+		return FFileHelper::SaveArrayToFile(Data, *TempFilename)
+			&& IFileManager::Get().Move(*Filename, *TempFilename, true, true, false, true);
+	}
+}
+
+void FShooterMatchTotals::Add(const FShooterMatchRecord& Match)
+{
+	NumMatches++;
+	Wins += Match.bIsWinner ? 1 : 0;
+	Kills += Match.Kills;
+	Deaths += Match.Deaths;
+	BulletsFired += Match.BulletsFired;
+	BulletHits += Match.BulletHits;
+	RocketsFired += Match.RocketsFired;
+	DurationSeconds += Match.DurationSeconds;
+}
+
+FShooterMatchHistory::FShooterMatchHistory(const FString& InSlotName)
+	: SlotName(InSlotName)
+	, bWriting(false)
+{
+}
+
+FString FShooterMatchHistory::GetFilename() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("SaveGames") / SlotName + TEXT(".history");
+}
+
+FString FShooterMatchHistory::GetIndexFilename() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("SaveGames") / SlotName + TEXT(".historyindex");
+}
+
+void FShooterMatchHistory::Load()
+{
+	Flush();
+	WrittenTotals = FShooterMatchTotals();
+
+	const int64 FileSize = IFileManager::Get().FileSize(*GetFilename());
+	if (FileSize >= 0)
+	{
+		FShooterMatchTotals IndexTotals;
+		TUniquePtr<FArchive> IndexReader(IFileManager::Get().CreateFileReader(*GetIndexFilename(), FILEREAD_Silent));
+		const bool bValidIndex = IndexReader && ShooterMatchHistory::SerializeIndex(*IndexReader, IndexTotals);
+		IndexReader.Reset();
+
+		if (bValidIndex && IndexTotals.NumMatches >= 0 && ShooterMatchHistory::GetFileSize(IndexTotals.NumMatches) == FileSize)
+		{
+			WrittenTotals = IndexTotals;
+		}
+		else
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Match history index of %s is out of date, rebuilding it"), *GetFilename());
+
+			// never matches a file size, so the records are summed up again
+			WrittenTotals.NumMatches = INDEX_NONE;
+			if (SyncWithHistoryFile())
+			{
+				TArray<uint8> IndexData;
+				FMemoryWriter IndexWriter(IndexData);
+				ShooterMatchHistory::SerializeIndex(IndexWriter, WrittenTotals);
+				ShooterMatchHistory::ReplaceFile(IndexData, GetIndexFilename());
+			}
+			else
+			{
+				WrittenTotals = FShooterMatchTotals();
+			}
+		}
+	}
+
+	// matches whose write failed are still queued and count as recorded
+	Totals = WrittenTotals;
+	FScopeLock ScopeLock(&Lock);
+	for (const FShooterMatchRecord& Match : PendingMatches)
+	{
+		Totals.Add(Match);
+	}
+}
+
+void FShooterMatchHistory::AddMatch(const FShooterMatchRecord& Match)
+{
+	Totals.Add(Match);
+
+	bool bStartWrite = false;
+	{
+		FScopeLock ScopeLock(&Lock);
+		PendingMatches.Add(Match);
+
+		bStartWrite = !bWriting;
+		bWriting = true;
+	}
+
+	if (bStartWrite)
+	{
+		TSharedRef<FShooterMatchHistory> This = AsShared();
+		WriteTask = Async(EAsyncExecution::ThreadPool, [This]()
+		{
+			This->WritePendingMatches();
+		});
+	}
+}
+
+void FShooterMatchHistory::WritePendingMatches()
+{
+	TArray<FShooterMatchRecord> Matches;
+	for (;;)
+	{
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (PendingMatches.Num() == 0)
+			{
+				bWriting = false;
+				return;
+			}
+
+			Matches = MoveTemp(PendingMatches);
+			PendingMatches.Reset();
+		}
+
+		const int32 NumAppended = AppendRecords(Matches);
+		if (NumAppended > 0)
+		{
+			// a stale index is rebuilt from the records by Load, so a failure here loses nothing
+			TArray<uint8> IndexData;
+			FMemoryWriter IndexWriter(IndexData);
+			ShooterMatchHistory::SerializeIndex(IndexWriter, WrittenTotals);
+			if (!ShooterMatchHistory::ReplaceFile(IndexData, GetIndexFilename()))
+			{
+				UE_LOG(LogShooter, Warning, TEXT("Failed to update match history index %s"), *GetIndexFilename());
+			}
+		}
+
+		if (NumAppended < Matches.Num())
+		{
+			// keep the rest in front of newer matches, the next AddMatch tries again
+			UE_LOG(LogShooter, Warning, TEXT("Failed to append %d matches to %s, retrying with the next match"), Matches.Num() - NumAppended, *GetFilename());
+
+			FScopeLock ScopeLock(&Lock);
+			PendingMatches.Insert(Matches.GetData() + NumAppended, Matches.Num() - NumAppended, 0);
+			bWriting = false;
+			return;
+		}
+	}
+}
+
+int32 FShooterMatchHistory::AppendRecords(const TArray<FShooterMatchRecord>& Matches)
+{
+	// records are placed by the file size, not by what was meant to be written, so a failed write never shifts them
+	if (!SyncWithHistoryFile())
+	{
+		return 0;
+	}
+
+	const int64 NumRecordsBefore = WrittenTotals.NumMatches;
+
+	TArray<uint8> Data;
+	FMemoryWriter Writer(Data);
+	if (IFileManager::Get().FileSize(*GetFilename()) <= 0)
+	{
+		ShooterMatchHistory::SerializeHeader(Writer);
+	}
+	for (FShooterMatchRecord Match : Matches)
+	{
+		ShooterMatchHistory::SerializeRecord(Writer, Match);
+	}
+
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*GetFilename(), FILEWRITE_Append | FILEWRITE_Silent));
+	if (FileWriter)
+	{
+		FileWriter->Serialize(Data.GetData(), Data.Num());
+		if (FileWriter->Close() && !FileWriter->IsError())
+		{
+			for (const FShooterMatchRecord& Match : Matches)
+			{
+				WrittenTotals.Add(Match);
+			}
+			return Matches.Num();
+		}
+		FileWriter.Reset();
+	}
+
+	// part of the batch may have made it, count what the file holds now so nothing is appended twice
+	if (!SyncWithHistoryFile())
+	{
+		WrittenTotals.NumMatches = INDEX_NONE;
+		return 0;
+	}
+	return (int32)FMath::Clamp<int64>(WrittenTotals.NumMatches - NumRecordsBefore, 0, Matches.Num());
+}
+
+bool FShooterMatchHistory::SyncWithHistoryFile()
+{
+	const FString Filename = GetFilename();
+	const int64 FileSize = IFileManager::Get().FileSize(*Filename);
+	if (FileSize < 0)
+	{
+		WrittenTotals = FShooterMatchTotals();
+		return true;
+	}
+
+	const int64 NumRecords = ShooterMatchHistory::GetNumRecords(FileSize);
+	if (ShooterMatchHistory::GetFileSize(NumRecords) == FileSize && NumRecords == WrittenTotals.NumMatches)
+	{
+		return true;
+	}
+
+	// only after an interrupted or failed write, or on the first load without a valid index
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *Filename, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(FileData);
+	if (!ShooterMatchHistory::SerializeHeader(Reader))
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Match history %s is unreadable, starting a new one"), *Filename);
+		WrittenTotals = FShooterMatchTotals();
+		return IFileManager::Get().Delete(*Filename, false, false, true);
+	}
+
+	WrittenTotals = FShooterMatchTotals();
+	for (int64 Idx = 0; Idx < NumRecords; Idx++)
+	{
+		FShooterMatchRecord Match;
+		ShooterMatchHistory::SerializeRecord(Reader, Match);
+		WrittenTotals.Add(Match);
+	}
+
+	if (ShooterMatchHistory::GetFileSize(NumRecords) != FileSize)
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Match history %s ends in a partial match, dropping it"), *Filename);
+		FileData.SetNum(ShooterMatchHistory::GetFileSize(NumRecords));
+		return ShooterMatchHistory::ReplaceFile(FileData, Filename);
+	}
+
+	return true;
+}
+
+int32 FShooterMatchHistory::GetNumMatches() const
+{
+	return (int32)Totals.NumMatches;
+}
+
+const FShooterMatchTotals& FShooterMatchHistory::GetTotals() const
+{
+	return Totals;
+}
+
+void FShooterMatchHistory::GetRecentMatches(int32 NumMatches, TArray<FShooterMatchRecord>& OutMatches)
+{
+	OutMatches.Reset();
+
+	Flush();
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*GetFilename(), FILEREAD_Silent));
+	if (!Reader)
+	{
+		return;
+	}
+
+	// the file decides what is on disk, matches still queued after a failed write aren't in it yet
+	const int64 NumRecords = ShooterMatchHistory::GetNumRecords(Reader->TotalSize());
+	const int64 NumToRead = FMath::Min<int64>(NumMatches, NumRecords);
+	if (NumToRead <= 0)
+	{
+		return;
+	}
+
+	// one read of the tail, the rest of the file is never touched
+	TArray<uint8> RecordData;
+	RecordData.SetNumUninitialized(NumToRead * ShooterMatchHistory::RecordSize);
+	Reader->Seek(ShooterMatchHistory::GetFileSize(NumRecords - NumToRead));
+	Reader->Serialize(RecordData.GetData(), RecordData.Num());
+	if (Reader->IsError())
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Failed to read match history %s"), *GetFilename());
+		return;
+	}
+
+	OutMatches.SetNum(NumToRead);
+	FMemoryReader RecordReader(RecordData);
+	for (int32 Idx = OutMatches.Num() - 1; Idx >= 0; Idx--)
+	{
+		ShooterMatchHistory::SerializeRecord(RecordReader, OutMatches[Idx]);
+	}
+}
+
+FShooterMatchTotals FShooterMatchHistory::GetRecentTotals(int32 NumMatches)
+{
+	TArray<FShooterMatchRecord> Matches;
+	GetRecentMatches(NumMatches, Matches);
+
+	FShooterMatchTotals RecentTotals;
+	for (const FShooterMatchRecord& Match : Matches)
+	{
+		RecentTotals.Add(Match);
+	}
+
+	return RecentTotals;
+}
+
+void FShooterMatchHistory::Flush()
+{
+	if (WriteTask.IsValid())
+	{
+		WriteTask.Wait();
+	}
+}
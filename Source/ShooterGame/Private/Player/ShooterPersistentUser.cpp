@@ -3,6 +3,86 @@
 #include "ShooterGame.h"
 #include "Player/ShooterPersistentUser.h"
 #include "Player/ShooterLocalPlayer.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+
+/** saves of one slot waiting to be written, shared with the background write */
+struct FShooterPersistentUserSaveQueue
+{
+	/** newest serialized save that hasn't been written yet */
+	TArray<uint8> PendingData;
+
+	/** PendingData holds a save */
+	bool bHasPendingData;
+
+	/** a background write is draining this queue */
+	bool bWriting;
+
+	/** guards the members above */
+	FCriticalSection Lock;
+
+	/** background write, only touched on the game thread */
+	TFuture<void> WriteTask;
+
+	FShooterPersistentUserSaveQueue()
+		: bHasPendingData(false)
+		, bWriting(false)
+	{
+	}
+
+	/** replaces any pending save, returns true if a new write has to be started */
+	bool Enqueue(TArray<uint8>&& Data)
+	{
+		FScopeLock ScopeLock(&Lock);
+		PendingData = MoveTemp(Data);
+		bHasPendingData = true;
+
+		const bool bStartWrite = !bWriting;
+		bWriting = true;
+		return bStartWrite;
+	}
+
+	/** takes the pending save, returns false and ends the write once there is none */
+	bool Dequeue(TArray<uint8>& OutData)
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!bHasPendingData)
+		{
+			bWriting = false;
+			return false;
+		}
+
+		OutData = MoveTemp(PendingData);
+		bHasPendingData = false;
+		return true;
+	}
+};
+
+namespace ShooterPersistentUserSaves
+{
+	/** one queue per save slot, so records recreated for the same slot share it */
+	static TMap<FString, TSharedRef<FShooterPersistentUserSaveQueue>> SaveQueues;
+
+	/** match histories by save slot, for the same reason */
+	static TMap<FString, TSharedRef<FShooterMatchHistory>> MatchHistories;
+
+	/** called on a background thread */
+	static bool WriteSaveData(const FString& SlotName, int32 UserIndex, const TArray<uint8>& Data)
+	{
+#if PLATFORM_DESKTOP
+		// same file the generic save game system loads, written next to it first so a crash never leaves a torn save
+		const FString Filename = FPaths::ProjectSavedDir() / TEXT("SaveGames") / SlotName + TEXT(".sav");
+		const FString TempFilename = Filename + TEXT(".tmp");
+		return FFileHelper::SaveArrayToFile(Data, *TempFilename) && IFileManager::Get().Move(*Filename, *TempFilename, true, true);
+#else
+		// console save systems handle their own journaling
+		ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+		return SaveSystem != nullptr && SaveSystem->SaveGame(false, *SlotName, UserIndex, Data);
+#endif
+	}
+}
 
 UShooterPersistentUser::UShooterPersistentUser(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -22,86 +102,56 @@ void UShooterPersistentUser::SetToDefaults()
 	bIsRecordingDemos = false;
 }
 
-bool UShooterPersistentUser::IsAimSensitivityDirty() const
+void UShooterPersistentUser::SavePersistentUser()
 {
-	bool bIsAimSensitivityDirty = false;
-
-	// Fixme: UShooterPersistentUser is not setup to work with multiple worlds.
-	// For now, user settings are global to all world instances.
-	if (GEngine)
+	// serializing is cheap, the disk write is what hitches
+	TArray<uint8> SaveData;
+	if (!UGameplayStatics::SaveGameToMemory(this, SaveData))
 	{
-		TArray<APlayerController*> PlayerList;
-		GEngine->GetAllLocalPlayerControllers(PlayerList);
+		UE_LOG(LogShooter, Warning, TEXT("Failed to serialize persistent user %s"), *SlotName);
+		return;
+	}
 
-		for (auto It = PlayerList.CreateIterator(); It; ++It)
-		{
-			APlayerController* PC = *It;
-			if (!PC || !PC->Player || !PC->PlayerInput)
-			{
-				continue;
-			}
+	bIsDirty = false;
 
-			// Update key bindings for the current user only
-			UShooterLocalPlayer* LocalPlayer = Cast<UShooterLocalPlayer>(PC->Player);
-			if(!LocalPlayer || LocalPlayer->GetPersistentUser() != this)
-			{
-				continue;
-			}
+	TSharedRef<FShooterPersistentUserSaveQueue>* ExistingQueue = ShooterPersistentUserSaves::SaveQueues.Find(SlotName);
+	TSharedRef<FShooterPersistentUserSaveQueue>& SaveQueue = ExistingQueue ? *ExistingQueue : ShooterPersistentUserSaves::SaveQueues.Add(SlotName, MakeShared<FShooterPersistentUserSaveQueue>());
+	if (!SaveQueue->Enqueue(MoveTemp(SaveData)))
+	{
+		// the running write picks up the new data when it's done
+		return;
+	}
 
-			// check if the aim sensitivity is off anywhere
-			for (int32 Idx = 0; Idx < PC->PlayerInput->AxisMappings.Num(); Idx++)
+	TSharedRef<FShooterPersistentUserSaveQueue> Queue = SaveQueue;
+	const FString SaveSlotName = SlotName;
+	const int32 SaveUserIndex = UserIndex;
+	SaveQueue->WriteTask = Async(EAsyncExecution::ThreadPool, [Queue, SaveSlotName, SaveUserIndex]()
+	{
+		TArray<uint8> Data;
+		while (Queue->Dequeue(Data))
+		{
+			if (!ShooterPersistentUserSaves::WriteSaveData(SaveSlotName, SaveUserIndex, Data))
 			{
-				FInputAxisKeyMapping &AxisMapping = PC->PlayerInput->AxisMappings[Idx];
-				if (AxisMapping.AxisName == "Lookup" || AxisMapping.AxisName == "LookupRate" || AxisMapping.AxisName == "Turn" || AxisMapping.AxisName == "TurnRate")
-				{
-					if (FMath::Abs(AxisMapping.Scale) != GetAimSensitivity())
-					{
-						bIsAimSensitivityDirty = true;
-						break;
-					}
-				}
+				UE_LOG(LogShooter, Warning, TEXT("Failed to write persistent user %s"), *SaveSlotName);
 			}
 		}
-	}
-
-	return bIsAimSensitivityDirty;
+	});
 }
 
-bool UShooterPersistentUser::IsInvertedYAxisDirty() const
+void UShooterPersistentUser::FlushPendingSaves()
 {
-	bool bIsInvertedYAxisDirty = false;
-	if (GEngine)
+	for (TPair<FString, TSharedRef<FShooterPersistentUserSaveQueue>>& Pair : ShooterPersistentUserSaves::SaveQueues)
 	{
-		TArray<APlayerController*> PlayerList;
-		GEngine->GetAllLocalPlayerControllers(PlayerList);
-
-		for (auto It = PlayerList.CreateIterator(); It; ++It)
+		if (Pair.Value->WriteTask.IsValid())
 		{
-			APlayerController* PC = *It;
-			if (!PC || !PC->Player || !PC->PlayerInput)
-			{
-				continue;
-			}
-
-			// Update key bindings for the current user only
-			UShooterLocalPlayer* LocalPlayer = Cast<UShooterLocalPlayer>(PC->Player);
-			if(!LocalPlayer || LocalPlayer->GetPersistentUser() != this)
-			{
-				continue;
-			}
-
-			bIsInvertedYAxisDirty |= PC->PlayerInput->GetInvertAxis("Lookup") != GetInvertedYAxis();
-			bIsInvertedYAxisDirty |= PC->PlayerInput->GetInvertAxis("LookupRate") != GetInvertedYAxis();
+			Pair.Value->WriteTask.Wait();
 		}
 	}
 
-	return bIsInvertedYAxisDirty;
-}
-
-void UShooterPersistentUser::SavePersistentUser()
-{
-	UGameplayStatics::SaveGameToSlot(this, SlotName, UserIndex);
-	bIsDirty = false;
+	for (TPair<FString, TSharedRef<FShooterMatchHistory>>& Pair : ShooterPersistentUserSaves::MatchHistories)
+	{
+		Pair.Value->Flush();
+	}
 }
 
 UShooterPersistentUser* UShooterPersistentUser::LoadPersistentUser(FString SlotName, const int32 UserIndex)
@@ -112,6 +162,13 @@ UShooterPersistentUser* UShooterPersistentUser::LoadPersistentUser(FString SlotN
 	// Persistent users aren't valid in this state.
 	if (SlotName.Len() > 0)
 	{	
+		// a save of this slot may still be on its way to disk
+		TSharedRef<FShooterPersistentUserSaveQueue>* SaveQueue = ShooterPersistentUserSaves::SaveQueues.Find(SlotName);
+		if (SaveQueue && (*SaveQueue)->WriteTask.IsValid())
+		{
+			(*SaveQueue)->WriteTask.Wait();
+		}
+
 		Result = Cast<UShooterPersistentUser>(UGameplayStatics::LoadGameFromSlot(SlotName, UserIndex));
 		if (Result == NULL)
 		{
@@ -122,6 +179,20 @@ UShooterPersistentUser* UShooterPersistentUser::LoadPersistentUser(FString SlotN
 	
 		Result->SlotName = SlotName;
 		Result->UserIndex = UserIndex;
+
+		TSharedRef<FShooterMatchHistory>* ExistingHistory = ShooterPersistentUserSaves::MatchHistories.Find(SlotName);
+		if (ExistingHistory)
+		{
+			Result->MatchHistory = *ExistingHistory;
+		}
+		else
+		{
+			// only the header is read, the records stay on disk until queried
+			TSharedRef<FShooterMatchHistory> NewHistory = MakeShared<FShooterMatchHistory>(SlotName);
+			NewHistory->Load();
+			ShooterPersistentUserSaves::MatchHistories.Add(SlotName, NewHistory);
+			Result->MatchHistory = NewHistory;
+		}
 	}
 
 	return Result;
@@ -129,20 +200,20 @@ UShooterPersistentUser* UShooterPersistentUser::LoadPersistentUser(FString SlotN
 
 void UShooterPersistentUser::SaveIfDirty()
 {
-	if (bIsDirty || IsInvertedYAxisDirty() || IsAimSensitivityDirty())
+	if (bIsDirty)
 	{
 		SavePersistentUser();
 	}
 }
 
-void UShooterPersistentUser::AddMatchResult(int32 MatchKills, int32 MatchDeaths, int32 MatchBulletsFired, int32 MatchRocketsFired, bool bIsMatchWinner)
+void UShooterPersistentUser::AddMatchResult(const FShooterMatchRecord& Match)
 {
-	Kills += MatchKills;
-	Deaths += MatchDeaths;
-	BulletsFired += MatchBulletsFired;
-	RocketsFired += MatchRocketsFired;
+	Kills += Match.Kills;
+	Deaths += Match.Deaths;
+	BulletsFired += Match.BulletsFired;
+	RocketsFired += Match.RocketsFired;
 	
-	if (bIsMatchWinner)
+	if (Match.bIsWinner)
 	{
 		Wins++;
 	}
@@ -151,9 +222,19 @@ void UShooterPersistentUser::AddMatchResult(int32 MatchKills, int32 MatchDeaths,
 		Losses++;
 	}
 
+	if (MatchHistory.IsValid())
+	{
+		MatchHistory->AddMatch(Match);
+	}
+
 	bIsDirty = true;
 }
 
+TSharedPtr<FShooterMatchHistory> UShooterPersistentUser::GetMatchHistory() const
+{
+	return MatchHistory;
+}
+
 void UShooterPersistentUser::TellInputAboutKeybindings()
 {
 	TArray<APlayerController*> PlayerList;
@@ -7,9 +7,7 @@
 #include "Player/ShooterLocalPlayer.h"
 #include "Online/ShooterPlayerState.h"
 #include "Weapons/ShooterWeapon.h"
-#include "UI/Menu/ShooterIngameMenu.h"
-#include "UI/Style/ShooterStyle.h"
-#include "UI/ShooterHUD.h"
+#include "ShooterGameUIInterface.h"
 #include "Online.h"
 #include "Interfaces/OnlineAchievementsInterface.h"
 #include "Interfaces/OnlineEventsInterface.h"
@@ -55,8 +53,14 @@ AShooterPlayerController::AShooterPlayerController(const FObjectInitializer& Obj
 	LastDeathLocation = FVector::ZeroVector;
 
 	ServerSayString = TEXT("Say");
-	ShooterFriendUpdateTimer = 0.0f;
 	bHasSentStartEvents = false;
+	bLoadTestAutopilot = false;
+	LoadTestStrafeTimer = 0.0f;
+	LoadTestStrafeDir = 0.0f;
+	ChatMessagesPerSecond = 1.0f;
+	ChatBurstSize = 5.0f;
+	ChatTokens = ChatBurstSize;
+	LastChatTokenTime = 0.0f;
 }
 
 void AShooterPlayerController::SetupInputComponent()
@@ -81,30 +85,17 @@ void AShooterPlayerController::SetupInputComponent()
 void AShooterPlayerController::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
-	FShooterStyle::Initialize();
-	ShooterFriendUpdateTimer = 0;
+
+	bLoadTestAutopilot = (GetNetMode() == NM_Client) && FParse::Param(FCommandLine::Get(), TEXT("LoadTestBot"));
 }
 
 void AShooterPlayerController::TickActor(float DeltaTime, enum ELevelTick TickType, FActorTickFunction& ThisTickFunction)
 {
 	Super::TickActor(DeltaTime, TickType, ThisTickFunction);
 
-	if (IsGameMenuVisible())
+	if (PlayerUI.IsValid())
 	{
-		if (ShooterFriendUpdateTimer > 0)
-		{
-			ShooterFriendUpdateTimer -= DeltaTime;
-		}
-		else
-		{
-			TSharedPtr<class FShooterFriends> ShooterFriends = ShooterIngameMenu->GetShooterFriends();
-			ULocalPlayer* LocalPlayer = Cast<ULocalPlayer>(Player);
-			if (ShooterFriends.IsValid() && LocalPlayer && LocalPlayer->GetControllerId() >= 0)
-			{
-				ShooterFriends->UpdateFriends(LocalPlayer->GetControllerId());
-			}
-			ShooterFriendUpdateTimer = 4; //make sure the time between calls is long enough that we won't trigger (0x80552C81) and not exceed the web api rate limit
-		}
+		PlayerUI->Tick(DeltaTime);
 	}
 
 	// Is this the first frame after the game has ended
@@ -115,16 +106,17 @@ void AShooterPlayerController::TickActor(float DeltaTime, enum ELevelTick TickTy
 		// ONLY PUT CODE HERE WHICH YOU DON'T WANT TO BE DONE DUE TO HOST LOSS
 
 		// Do we need to show the end of round scoreboard?
-		if (IsPrimaryPlayer())
+		if (IsPrimaryPlayer() && PlayerUI.IsValid())
 		{
-			AShooterHUD* ShooterHUD = GetShooterHUD();
-			if (ShooterHUD)
-			{
-				ShooterHUD->ShowScoreboard(true, true);
-			}
+			PlayerUI->ShowScoreboard(true, true);
 		}
 	}
 
+	if (bLoadTestAutopilot && IsLocalController())
+	{
+		UpdateLoadTestAutopilot(DeltaTime);
+	}
+
 	const bool bLocallyControlled = IsLocalController();
 	const uint32 UniqueID = GetUniqueID();
 	FAudioThread::RunCommandOnAudioThread([UniqueID, bLocallyControlled]()
@@ -133,6 +125,60 @@ void AShooterPlayerController::TickActor(float DeltaTime, enum ELevelTick TickTy
 	});
 };
 
+void AShooterPlayerController::UpdateLoadTestAutopilot(float DeltaTime)
+{
+	AShooterCharacter* MyPawn = Cast<AShooterCharacter>(GetPawn());
+	if (MyPawn == NULL || !MyPawn->IsAlive() || !IsGameInputAllowed())
+	{
+		return;
+	}
+
+	// aim at the closest enemy we can see, using only what got replicated to us
+	AShooterCharacter* BestEnemy = NULL;
+	float BestDistSq = MAX_FLT;
+	for (TActorIterator<AShooterCharacter> It(GetWorld()); It; ++It)
+	{
+		AShooterCharacter* TestPawn = *It;
+		if (TestPawn != MyPawn && TestPawn->IsAlive() && TestPawn->IsEnemyFor(this))
+		{
+			const float DistSq = (TestPawn->GetActorLocation() - MyPawn->GetActorLocation()).SizeSquared();
+			if (DistSq < BestDistSq && LineOfSightTo(TestPawn))
+			{
+				BestDistSq = DistSq;
+				BestEnemy = TestPawn;
+			}
+		}
+	}
+
+	FRotator NewControlRotation = GetControlRotation();
+	if (BestEnemy)
+	{
+		const FRotator AimRotation = (BestEnemy->GetActorLocation() - MyPawn->GetPawnViewLocation()).Rotation();
+		NewControlRotation = FMath::RInterpTo(NewControlRotation, AimRotation, DeltaTime, 8.0f);
+		MyPawn->StartWeaponFire();
+	}
+	else
+	{
+		MyPawn->StopWeaponFire();
+
+		// wander, turning away from walls we got stuck on
+		const bool bBlocked = MyPawn->GetVelocity().SizeSquared2D() < FMath::Square(10.0f);
+		NewControlRotation.Yaw += (bBlocked ? 180.0f : 20.0f) * DeltaTime;
+		NewControlRotation.Pitch = 0.0f;
+	}
+	SetControlRotation(NewControlRotation);
+
+	LoadTestStrafeTimer -= DeltaTime;
+	if (LoadTestStrafeTimer <= 0.0f)
+	{
+		LoadTestStrafeTimer = FMath::FRandRange(1.0f, 3.0f);
+		LoadTestStrafeDir = (float)FMath::RandRange(-1, 1);
+	}
+
+	MyPawn->MoveForward(BestEnemy ? 0.0f : 1.0f);
+	MyPawn->MoveRight(LoadTestStrafeDir);
+}
+
 void AShooterPlayerController::BeginDestroy()
 {
 	Super::BeginDestroy();
@@ -154,8 +200,11 @@ void AShooterPlayerController::SetPlayer( UPlayer* InPlayer )
 	if (ULocalPlayer* const LocalPlayer = Cast<ULocalPlayer>(Player))
 	{
 		//Build menu only after game is initialized
-		ShooterIngameMenu = MakeShareable(new FShooterIngameMenu());
-		ShooterIngameMenu->Construct(Cast<ULocalPlayer>(Player));
+		IShooterGameUIModule* const UIModule = IShooterGameUIModule::Get();
+		if (UIModule != nullptr && !PlayerUI.IsValid())
+		{
+			PlayerUI = UIModule->CreatePlayerUI(this);
+		}
 
 		FInputModeGameOnly InputMode;
 		SetInputMode(InputMode);
@@ -237,6 +286,16 @@ void AShooterPlayerController::PawnPendingDestroy(APawn* P)
 	ClientSetSpectatorCamera(CameraLocation, CameraRotation);
 }
 
+void AShooterPlayerController::SetPawn(APawn* InPawn)
+{
+	Super::SetPawn(InPawn);
+
+	if (PlayerUI.IsValid())
+	{
+		PlayerUI->UpdatePawn(Cast<AShooterCharacter>(InPawn));
+	}
+}
+
 void AShooterPlayerController::GameHasEnded(class AActor* EndGameFocus, bool bIsWinner)
 {
 	UpdateSaveFileOnGameEnd(bIsWinner);
@@ -277,6 +336,7 @@ bool AShooterPlayerController::FindDeathCameraSpot(FVector& CameraLocation, FRot
 		const FVector TestLocation = PawnLocation - CameraDir.Vector() * CameraOffset;
 		
 		const bool bBlocked = GetWorld()->LineTraceSingleByChannel(HitResult, PawnLocation, TestLocation, ECC_Camera, TraceParams);
+		SHOOTER_INC_COUNTER(Traces);
 
 		if (!bBlocked)
 		{
@@ -352,14 +412,18 @@ void AShooterPlayerController::OnKill()
 
 void AShooterPlayerController::OnDeathMessage(class AShooterPlayerState* KillerPlayerState, class AShooterPlayerState* KilledPlayerState, const UDamageType* KillerDamageType) 
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->ShowDeathMessage(KillerPlayerState, KilledPlayerState, KillerDamageType);		
+		PlayerUI->ShowDeathMessage(KillerPlayerState, KilledPlayerState, KillerDamageType);
 	}
 
 	PlayerKilledDelegate.Broadcast(KillerPlayerState, KilledPlayerState, KillerDamageType);
 
+	if (PlayerUI.IsValid() && KillerPlayerState && KilledPlayerState && KillerPlayerState == PlayerState && KilledPlayerState != PlayerState)
+	{
+		PlayerUI->ShowRecentlyKilled(KilledPlayerState->GetShortPlayerName());
+	}
+
 	ULocalPlayer* LocalPlayer = Cast<ULocalPlayer>(Player);
 	if (LocalPlayer && LocalPlayer->GetCachedUniqueNetId().IsValid() && KilledPlayerState->GetUniqueId().IsValid())
 	{
@@ -404,10 +468,9 @@ void AShooterPlayerController::OnDeathMessage(class AShooterPlayerState* KillerP
 
 void AShooterPlayerController::OnHitTaken(float DamageTaken, struct FDamageEvent const& DamageEvent, class APawn* PawnInstigator)
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->NotifyWeaponHit(DamageTaken, DamageEvent, PawnInstigator);
+		PlayerUI->NotifyWeaponHit(DamageTaken, DamageEvent, PawnInstigator);
 	}
 
 	HitTakenDelegate.Broadcast(DamageTaken, DamageEvent, PawnInstigator);
@@ -415,10 +478,9 @@ void AShooterPlayerController::OnHitTaken(float DamageTaken, struct FDamageEvent
 
 void AShooterPlayerController::OnEnemyHit()
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->NotifyEnemyHit();
+		PlayerUI->NotifyEnemyHit();
 	}
 
 	EnemyHitDelegate.Broadcast();
@@ -426,10 +488,9 @@ void AShooterPlayerController::OnEnemyHit()
 
 void AShooterPlayerController::NotifyOutOfAmmo()
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->NotifyOutOfAmmo();
+		PlayerUI->NotifyOutOfAmmo();
 	}
 
 	OutOfAmmoDelegate.Broadcast();
@@ -506,55 +567,51 @@ void AShooterPlayerController::OnToggleInGameMenu()
 	}
 
 	// if no one's paused, pause
-	if (ShooterIngameMenu.IsValid())
+	if (PlayerUI.IsValid())
 	{
-		ShooterIngameMenu->ToggleGameMenu();
+		PlayerUI->ToggleGameMenu();
 	}
 }
 
 void AShooterPlayerController::OnConditionalCloseScoreboard()
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if(ShooterHUD && ( ShooterHUD->IsMatchOver() == false ))
+	if (PlayerUI.IsValid() && !PlayerUI->IsMatchOver())
 	{
-		ShooterHUD->ConditionalCloseScoreboard();
+		PlayerUI->ConditionalCloseScoreboard();
 	}
 }
 
 void AShooterPlayerController::OnToggleScoreboard()
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if(ShooterHUD && ( ShooterHUD->IsMatchOver() == false ))
+	if (PlayerUI.IsValid() && !PlayerUI->IsMatchOver())
 	{
-		ShooterHUD->ToggleScoreboard();
+		PlayerUI->ToggleScoreboard();
 	}
 }
 
 void AShooterPlayerController::OnShowScoreboard()
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if(ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->ShowScoreboard(true);
+		PlayerUI->ShowScoreboard(true);
 	}
 }
 
 void AShooterPlayerController::OnHideScoreboard()
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();
 	// If have a valid match and the match is over - hide the scoreboard
-	if( (ShooterHUD != NULL ) && ( ShooterHUD->IsMatchOver() == false ) )
+	if (PlayerUI.IsValid() && !PlayerUI->IsMatchOver())
 	{
-		ShooterHUD->ShowScoreboard(false);
+		PlayerUI->ShowScoreboard(false);
 	}
 }
 
 bool AShooterPlayerController::IsGameMenuVisible() const
 {
 	bool Result = false; 
-	if (ShooterIngameMenu.IsValid())
+	if (PlayerUI.IsValid())
 	{
-		Result = ShooterIngameMenu->GetIsGameMenuUp();
+		Result = PlayerUI->IsGameMenuUp();
 	} 
 
 	return Result;
@@ -592,11 +649,10 @@ void AShooterPlayerController::ClientGameStarted_Implementation()
 	// Enable controls mode now the game has started
 	SetIgnoreMoveInput(false);
 
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->SetMatchState(EShooterMatchState::Playing);
-		ShooterHUD->ShowScoreboard(false);
+		PlayerUI->SetMatchState(EShooterMatchState::Playing);
+		PlayerUI->ShowScoreboard(false);
 	}
 	bGameEndedFrame = false;
 
@@ -749,10 +805,9 @@ void AShooterPlayerController::ClientGameEnded_Implementation(class AActor* EndG
 	// Make sure that we still have valid view target
 	SetViewTarget(GetPawn());
 
-	AShooterHUD* ShooterHUD = GetShooterHUD();
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->SetMatchState(bIsWinner ? EShooterMatchState::Won : EShooterMatchState::Lost);
+		PlayerUI->SetMatchState(bIsWinner ? EShooterMatchState::Won : EShooterMatchState::Lost);
 	}
 
 	UpdateSaveFileOnGameEnd(bIsWinner);
@@ -870,6 +925,17 @@ void AShooterPlayerController::InitInputSystem()
 	}
 }
 
+bool AShooterPlayerController::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	const bool bProcessed = Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+	if (bProcessed)
+	{
+		SHOOTER_INC_COUNTER(RPCsSent);
+	}
+
+	return bProcessed;
+}
+
 void AShooterPlayerController::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
 {
 	Super::GetLifetimeReplicatedProps( OutLifetimeProps );
@@ -935,23 +1001,36 @@ bool AShooterPlayerController::IsGameInputAllowed() const
 
 void AShooterPlayerController::ToggleChatWindow()
 {
-	AShooterHUD* ShooterHUD = Cast<AShooterHUD>(GetHUD());
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
-		ShooterHUD->ToggleChat();
+		PlayerUI->ToggleChat();
 	}
 }
 
 void AShooterPlayerController::ClientTeamMessage_Implementation( APlayerState* SenderPlayerState, const FString& S, FName Type, float MsgLifeTime  )
 {
-	AShooterHUD* ShooterHUD = Cast<AShooterHUD>(GetHUD());
-	if (ShooterHUD)
+	if (PlayerUI.IsValid())
 	{
 		if( Type == ServerSayString )
 		{
 			if( SenderPlayerState != PlayerState  )
 			{
-				ShooterHUD->AddChatLine(FText::FromString(S), false);
+				PlayerUI->AddChatLine(FText::FromString(S));
+			}
+		}
+	}
+}
+
+void AShooterPlayerController::ClientReceiveChat_Implementation(const TArray<FShooterChatMessage>& Messages)
+{
+	if (PlayerUI.IsValid())
+	{
+		for (const FShooterChatMessage& Message : Messages)
+		{
+			// our own lines were added when they were said
+			if (Message.SenderPlayerState != PlayerState)
+			{
+				PlayerUI->AddChatLine(FText::FromString(Message.Text));
 			}
 		}
 	}
@@ -959,7 +1038,7 @@ void AShooterPlayerController::ClientTeamMessage_Implementation( APlayerState* S
 
 void AShooterPlayerController::Say( const FString& Msg )
 {
-	ServerSay(Msg.Left(128));
+	ServerSay(Msg.Left(MAX_CHAT_MESSAGE_LENGTH));
 }
 
 bool AShooterPlayerController::ServerSay_Validate( const FString& Msg )
@@ -969,12 +1048,44 @@ bool AShooterPlayerController::ServerSay_Validate( const FString& Msg )
 
 void AShooterPlayerController::ServerSay_Implementation( const FString& Msg )
 {
-	GetWorld()->GetAuthGameMode<AShooterGameMode>()->Broadcast(this, Msg, ServerSayString);
+	AShooterGameMode* const GameMode = GetWorld()->GetAuthGameMode<AShooterGameMode>();
+	if (GameMode == NULL || Msg.IsEmpty())
+	{
+		return;
+	}
+
+	// token bucket: allow short bursts, then at most ChatMessagesPerSecond
+	const float TimeSeconds = GetWorld()->GetRealTimeSeconds();
+	ChatTokens = FMath::Min(ChatBurstSize, ChatTokens + (TimeSeconds - LastChatTokenTime) * ChatMessagesPerSecond);
+	LastChatTokenTime = TimeSeconds;
+
+	if (ChatTokens < 1.0f)
+	{
+		UE_LOG(LogShooter, Verbose, TEXT("Dropped chat message from %s, rate limit exceeded"), PlayerState ? *PlayerState->GetPlayerName() : *GetName());
+		SHOOTER_INC_COUNTER(ChatMessagesDropped);
+		return;
+	}
+	ChatTokens -= 1.0f;
+
+	// the game mode sends everything said this tick to each player in one RPC
+	GameMode->QueueChatMessage(this, Msg.Left(MAX_CHAT_MESSAGE_LENGTH));
+}
+
+IShooterPlayerUI* AShooterPlayerController::GetPlayerUI() const
+{
+	return PlayerUI.Get();
 }
 
-AShooterHUD* AShooterPlayerController::GetShooterHUD() const
+void AShooterPlayerController::ClientSetHUD_Implementation(TSubclassOf<AHUD> NewHUDClass)
 {
-	return Cast<AShooterHUD>(GetHUD());
+	// the game mode can't name the HUD class, it lives in the ClientOnly UI module
+	IShooterGameUIModule* const UIModule = IShooterGameUIModule::Get();
+	if (UIModule != nullptr && NewHUDClass == AHUD::StaticClass())
+	{
+		NewHUDClass = UIModule->GetHUDClass();
+	}
+
+	Super::ClientSetHUD_Implementation(NewHUDClass);
 }
 
 
@@ -1044,10 +1155,9 @@ FVector AShooterPlayerController::GetFocalLocation() const
 
 void AShooterPlayerController::ShowInGameMenu()
 {
-	AShooterHUD* ShooterHUD = GetShooterHUD();	
-	if(ShooterIngameMenu.IsValid() && !ShooterIngameMenu->GetIsGameMenuUp() && ShooterHUD && (ShooterHUD->IsMatchOver() == false))
+	if (PlayerUI.IsValid() && !PlayerUI->IsGameMenuUp() && !PlayerUI->IsMatchOver())
 	{
-		ShooterIngameMenu->ToggleGameMenu();
+		PlayerUI->ToggleGameMenu();
 	}
 }
 void AShooterPlayerController::UpdateAchievementsOnGameEnd()
@@ -1276,7 +1386,21 @@ void AShooterPlayerController::UpdateSaveFileOnGameEnd(bool bIsWinner)
 		UShooterPersistentUser* const PersistentUser = GetPersistentUser();
 		if (PersistentUser)
 		{
-			PersistentUser->AddMatchResult(ShooterPlayerState->GetKills(), ShooterPlayerState->GetDeaths(), ShooterPlayerState->GetNumBulletsFired(), ShooterPlayerState->GetNumRocketsFired(), bIsWinner);
+			AShooterGameState* const MyGameState = GetWorld()->GetGameState<AShooterGameState>();
+
+			FShooterMatchRecord Match;
+			Match.Timestamp = FDateTime::UtcNow();
+			Match.MapName = FPackageName::GetShortName(GetWorld()->PersistentLevel->GetOutermost()->GetName());
+			Match.GameType = (MyGameState && MyGameState->NumTeams > 1) ? TEXT("TDM") : TEXT("FFA");
+			Match.Kills = ShooterPlayerState->GetKills();
+			Match.Deaths = ShooterPlayerState->GetDeaths();
+			Match.BulletsFired = ShooterPlayerState->GetNumBulletsFired();
+			Match.BulletHits = ShooterPlayerState->GetNumBulletHits();
+			Match.RocketsFired = ShooterPlayerState->GetNumRocketsFired();
+			Match.DurationSeconds = MyGameState ? MyGameState->ElapsedTime : 0;
+			Match.bIsWinner = bIsWinner;
+
+			PersistentUser->AddMatchResult(Match);
 			PersistentUser->SaveIfDirty();
 		}
 	}
@@ -1286,6 +1410,12 @@ void AShooterPlayerController::PreClientTravel(const FString& PendingURL, ETrave
 {
 	Super::PreClientTravel( PendingURL, TravelType, bIsSeamlessTravel );
 
+	UShooterGameInstance* SGI = GetWorld() != NULL ? Cast<UShooterGameInstance>(GetWorld()->GetGameInstance()) : NULL;
+	if (SGI != NULL)
+	{
+		SGI->NotifyMapTravelStarted();
+	}
+
 	if ( GetWorld() != NULL )
 	{
 		UShooterGameViewportClient* ShooterViewport = Cast<UShooterGameViewportClient>( GetWorld()->GetGameViewport() );
@@ -1295,11 +1425,10 @@ void AShooterPlayerController::PreClientTravel(const FString& PendingURL, ETrave
 			ShooterViewport->ShowLoadingScreen();
 		}
 		
-		AShooterHUD* ShooterHUD = Cast<AShooterHUD>(GetHUD());
-		if (ShooterHUD != nullptr)
+		if (PlayerUI.IsValid())
 		{
 			// Passing true to bFocus here ensures that focus is returned to the game viewport.
-			ShooterHUD->ShowScoreboard(false, true);
+			PlayerUI->ShowScoreboard(false, true);
 		}
 	}
 }
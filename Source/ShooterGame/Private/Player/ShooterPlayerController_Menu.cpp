@@ -2,7 +2,6 @@
 
 #include "ShooterGame.h"
 #include "Player/ShooterPlayerController_Menu.h"
-#include "ShooterStyle.h"
 
 
 AShooterPlayerController_Menu::AShooterPlayerController_Menu(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -17,6 +16,4 @@ UShooterLocalPlayer* AShooterPlayerController_Menu::GetLocalPlayer() const
 void AShooterPlayerController_Menu::PostInitializeComponents()
 {
 	Super::PostInitializeComponents();
-
-	FShooterStyle::Initialize();
 }
@@ -0,0 +1,94 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterAssetManager.h"
+
+const FPrimaryAssetType UShooterAssetManager::WeaponType = TEXT("ShooterWeapon");
+const FPrimaryAssetType UShooterAssetManager::CharacterType = TEXT("ShooterCharacter");
+const FPrimaryAssetType UShooterAssetManager::ImpactEffectType = TEXT("ShooterImpactEffect");
+const FName UShooterAssetManager::ClientBundle = TEXT("Client");
+
+UShooterAssetManager::UShooterAssetManager(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, PreloadStartTime(0.0)
+{
+}
+
+UShooterAssetManager& UShooterAssetManager::Get()
+{
+	UShooterAssetManager* This = Cast<UShooterAssetManager>(GEngine->AssetManager);
+	if (This == nullptr)
+	{
+		UE_LOG(LogShooter, Fatal, TEXT("AssetManagerClassName in DefaultEngine.ini must be set to ShooterAssetManager"));
+	}
+	return *This;
+}
+
+FPrimaryAssetId UShooterAssetManager::GetBlueprintPrimaryAssetId(const UObject* Object, const FPrimaryAssetType& AssetType)
+{
+	// blueprints are scanned by class, named after their package like any other asset
+	if (Object->HasAnyFlags(RF_ClassDefaultObject) && !Object->GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		return FPrimaryAssetId(AssetType, FPackageName::GetShortFName(Object->GetOutermost()->GetFName()));
+	}
+	return FPrimaryAssetId();
+}
+
+#if WITH_EDITOR
+void UShooterAssetManager::UpdateAssetBundleData(const UObject* Object, FAssetBundleData& OutBundleData)
+{
+	// the metadata is editor only, the asset registry carries the bundles into cooked builds
+	OutBundleData.Reset();
+	if (Object->HasAnyFlags(RF_ClassDefaultObject) && UAssetManager::IsValid())
+	{
+		UAssetManager::Get().InitializeAssetBundlesFromMetadata(Object, OutBundleData);
+	}
+}
+#endif
+
+void UShooterAssetManager::WarnClientAssetNotLoaded(const FSoftObjectPath& AssetPath)
+{
+	UE_LOG(LogShooter, Warning, TEXT("%s is used before it was streamed in, loading it synchronously"), *AssetPath.ToString());
+}
+
+bool UShooterAssetManager::AreGameAssetsLoaded() const
+{
+	return GameAssetsHandle.IsValid() && GameAssetsHandle->HasLoadCompleted();
+}
+
+void UShooterAssetManager::StartInitialLoading()
+{
+	Super::StartInitialLoading();
+
+	// the editor loads what it opens
+	if (!GIsEditor)
+	{
+		PreloadGameAssets();
+	}
+}
+
+void UShooterAssetManager::PreloadGameAssets()
+{
+	TArray<FPrimaryAssetId> AssetIds;
+	GetPrimaryAssetIdList(WeaponType, AssetIds);
+	GetPrimaryAssetIdList(CharacterType, AssetIds);
+	GetPrimaryAssetIdList(ImpactEffectType, AssetIds);
+	if (AssetIds.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FName> Bundles;
+	if (!IsRunningDedicatedServer())
+	{
+		Bundles.Add(ClientBundle);
+	}
+
+	PreloadStartTime = FPlatformTime::Seconds();
+	GameAssetsHandle = LoadPrimaryAssets(AssetIds, Bundles, FStreamableDelegate::CreateUObject(this, &UShooterAssetManager::OnGameAssetsLoaded, AssetIds.Num()));
+}
+
+void UShooterAssetManager::OnGameAssetsLoaded(int32 NumAssets)
+{
+	UE_LOG(LogShooter, Log, TEXT("Streamed %d game primary assets%s in %.2f s"), NumAssets, IsRunningDedicatedServer() ? TEXT("") : TEXT(" with client bundles"), FPlatformTime::Seconds() - PreloadStartTime);
+}
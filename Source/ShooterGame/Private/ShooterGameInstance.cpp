@@ -6,70 +6,20 @@
 
 #include "ShooterGame.h"
 #include "ShooterGameInstance.h"
-#include "ShooterMainMenu.h"
-#include "ShooterWelcomeMenu.h"
-#include "ShooterMessageMenu.h"
 #include "ShooterGameLoadingScreen.h"
+#include "ShooterGameUIInterface.h"
 #include "OnlineKeyValuePair.h"
-#include "ShooterStyle.h"
-#include "ShooterMenuItemWidgetStyle.h"
 #include "ShooterGameViewportClient.h"
+#include "ShooterReplayBenchmark.h"
+#include "ShooterReplayIndex.h"
 #include "Player/ShooterPlayerController_Menu.h"
+#include "Player/ShooterPersistentUser.h"
 #include "Online/ShooterPlayerState.h"
 #include "Online/ShooterGameSession.h"
 #include "Online/ShooterOnlineSessionClient.h"
 
 FAutoConsoleVariable CVarShooterGameTestEncryption(TEXT("ShooterGame.TestEncryption"), 0, TEXT("If true, clients will send an encryption token with their request to join the server and attempt to encrypt the connection using a debug key. This is NOT SECURE and for demonstration purposes only."));
 
-void SShooterWaitDialog::Construct(const FArguments& InArgs)
-{
-	const FShooterMenuItemStyle* ItemStyle = &FShooterStyle::Get().GetWidgetStyle<FShooterMenuItemStyle>("DefaultShooterMenuItemStyle");
-	const FButtonStyle* ButtonStyle = &FShooterStyle::Get().GetWidgetStyle<FButtonStyle>("DefaultShooterButtonStyle");
-	ChildSlot
-		.VAlign(VAlign_Center)
-		.HAlign(HAlign_Center)
-		[
-			SNew(SVerticalBox)
-			+ SVerticalBox::Slot()
-			.AutoHeight()
-			.Padding(20.0f)
-			.VAlign(VAlign_Center)
-			.HAlign(HAlign_Center)
-			[
-				SNew(SBorder)
-				.Padding(50.0f)
-				.VAlign(VAlign_Center)
-				.HAlign(HAlign_Center)
-				.BorderImage(&ItemStyle->BackgroundBrush)
-				.BorderBackgroundColor(FLinearColor(1.0f, 1.0f, 1.0f, 1.0f))
-				[
-					SNew(STextBlock)
-					.TextStyle(FShooterStyle::Get(), "ShooterGame.MenuHeaderTextStyle")
-					.ColorAndOpacity(this, &SShooterWaitDialog::GetTextColor)
-					.Text(InArgs._MessageText)
-					.WrapTextAt(500.0f)
-				]
-			]
-		];
-
-	//Setup a curve
-	const float StartDelay = 0.0f;
-	const float SecondDelay = 0.0f;
-	const float AnimDuration = 2.0f;
-
-	WidgetAnimation = FCurveSequence();
-	TextColorCurve = WidgetAnimation.AddCurve(StartDelay + SecondDelay, AnimDuration, ECurveEaseFunction::QuadInOut);
-	WidgetAnimation.Play(this->AsShared(), true);
-}
-
-FSlateColor SShooterWaitDialog::GetTextColor() const
-{
-	//instead of going from black -> white, go from white -> grey.
-	float fAlpha = 1.0f - TextColorCurve.GetLerp();
-	fAlpha = fAlpha * 0.5f + 0.5f;
-	return FLinearColor(FColor(155, 164, 182, FMath::Clamp((int32)(fAlpha * 255.0f), 0, 255)));
-}
-
 namespace ShooterGameInstanceState
 {
 	const FName None = FName(TEXT("None"));
@@ -85,6 +35,9 @@ UShooterGameInstance::UShooterGameInstance(const FObjectInitializer& ObjectIniti
 	: Super(ObjectInitializer)
 	, OnlineMode(EOnlineMode::Online) // Default to online
 	, bIsLicensed(true) // Default to licensed (should have been checked by OS on boot)
+	, PreloadedMapWorld(nullptr)
+	, PreloadStartTime(0.0)
+	, MapTravelStartTime(0.0)
 {
 	CurrentState = ShooterGameInstanceState::None;
 }
@@ -129,6 +82,16 @@ void UShooterGameInstance::Init()
 
 	FCoreUObjectDelegates::PostDemoPlay.AddUObject(this, &UShooterGameInstance::OnPostDemoPlay);
 
+	ReplayIndex = MakeShareable(new FShooterReplayIndex());
+	ReplayIndex->Load();
+
+	// menus live in the ClientOnly UI module, dedicated servers run without them
+	IShooterGameUIModule* const UIModule = IShooterGameUIModule::Get();
+	if (UIModule != nullptr)
+	{
+		GameInstanceUI = UIModule->CreateGameInstanceUI(this);
+	}
+
 	bPendingEnableSplitscreen = false;
 
 	OnlineSub->AddOnConnectionStatusChangedDelegate_Handle( FOnConnectionStatusChangedDelegate::CreateUObject( this, &UShooterGameInstance::HandleNetworkConnectionStatusChanged ) );
@@ -154,8 +117,13 @@ void UShooterGameInstance::Shutdown()
 {
 	Super::Shutdown();
 
+	// saves are written in the background, don't exit before they're on disk
+	UShooterPersistentUser::FlushPendingSaves();
+
 	// Unregister ticker delegate
 	FTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
+
+	GameInstanceUI.Reset();
 }
 
 void UShooterGameInstance::HandleNetworkConnectionStatusChanged( const FString&, EOnlineServerConnectionStatus::Type LastConnectionStatus, EOnlineServerConnectionStatus::Type ConnectionStatus )
@@ -218,6 +186,11 @@ void UShooterGameInstance::HandleSessionFailure( const FUniqueNetId& NetId, ESes
 
 void UShooterGameInstance::OnPreLoadMap(const FString& MapName)
 {
+	if (MapTravelStartTime == 0.0)
+	{
+		NotifyMapTravelStarted();
+	}
+
 	if ( bPendingEnableSplitscreen )
 	{
 		// Allow splitscreen
@@ -227,8 +200,30 @@ void UShooterGameInstance::OnPreLoadMap(const FString& MapName)
 	}
 }
 
-void UShooterGameInstance::OnPostLoadMap(UWorld*)
+void UShooterGameInstance::OnPostLoadMap(UWorld* LoadedWorld)
 {
+	if (MapTravelStartTime > 0.0 && LoadedWorld != nullptr)
+	{
+		const FString LoadedMapName = LoadedWorld->GetOutermost()->GetName();
+		const TCHAR* PreloadStatus = TEXT("not preloaded");
+		if (LoadedWorld == PreloadedMapWorld)
+		{
+			PreloadStatus = TEXT("preloaded");
+		}
+		else if (LoadedMapName == PreloadMapName)
+		{
+			PreloadStatus = TEXT("preload not finished");
+		}
+
+		UE_LOG(LogShooter, Log, TEXT("Loaded %s in %.2f s (%s)"), *LoadedMapName, FPlatformTime::Seconds() - MapTravelStartTime, PreloadStatus);
+		MapTravelStartTime = 0.0;
+	}
+
+	// the loaded world is referenced by the engine now, and any other preload is stale
+	PreloadedMapWorld = nullptr;
+	PreloadMapName.Empty();
+	PreloadStartTime = 0.0;
+
 	// Make sure we hide the loading screen when the level is done loading
 	UShooterGameViewportClient * ShooterViewport = Cast<UShooterGameViewportClient>(GetGameViewportClient());
 
@@ -241,9 +236,9 @@ void UShooterGameInstance::OnPostLoadMap(UWorld*)
 void UShooterGameInstance::OnUserCanPlayInvite(const FUniqueNetId& UserId, EUserPrivileges::Type Privilege, uint32 PrivilegeResults)
 {
 	CleanupOnlinePrivilegeTask();
-	if (WelcomeMenuUI.IsValid())
+	if (GameInstanceUI.IsValid())
 	{
-		WelcomeMenuUI->LockControls(false);
+		GameInstanceUI->LockWelcomeMenu(false);
 	}
 
 	if (PrivilegeResults == (uint32)IOnlineIdentity::EPrivilegeResults::NoFailures)	
@@ -263,16 +258,16 @@ void UShooterGameInstance::OnUserCanPlayInvite(const FUniqueNetId& UserId, EUser
 void UShooterGameInstance::OnUserCanPlayTogether(const FUniqueNetId& UserId, EUserPrivileges::Type Privilege, uint32 PrivilegeResults)
 {
 	CleanupOnlinePrivilegeTask();
-	if (WelcomeMenuUI.IsValid())
+	if (GameInstanceUI.IsValid())
 	{
-		WelcomeMenuUI->LockControls(false);
+		GameInstanceUI->LockWelcomeMenu(false);
 	}
 
 	if (PrivilegeResults == (uint32)IOnlineIdentity::EPrivilegeResults::NoFailures)
 	{
-		if (WelcomeMenuUI.IsValid())
+		if (GameInstanceUI.IsValid())
 		{
-			WelcomeMenuUI->SetControllerAndAdvanceToMainMenu(PlayTogetherInfo.UserIndex);
+			GameInstanceUI->AdvanceWelcomeMenu(PlayTogetherInfo.UserIndex);
 		}
 	}
 	else
@@ -289,11 +284,25 @@ void UShooterGameInstance::OnPostDemoPlay()
 
 void UShooterGameInstance::HandleDemoPlaybackFailure( EDemoPlayFailure::Type FailureType, const FString& ErrorString )
 {
+	if (ReplayBenchmark.IsValid())
+	{
+		ReplayBenchmark->OnPlaybackFailed(ErrorString);
+		return;
+	}
+
 	ShowMessageThenGotoState( FText::Format( NSLOCTEXT("UShooterGameInstance", "DemoPlaybackFailedFmt", "Demo playback failed: {0}"), FText::FromString(ErrorString) ), NSLOCTEXT( "DialogButtons", "OKAY", "OK" ), FText::GetEmpty(), ShooterGameInstanceState::MainMenu );
 }
 
 void UShooterGameInstance::StartGameInstance()
 {
+	// Headless replay benchmark, skip the menus and go straight to playback
+	ReplayBenchmark = FShooterReplayBenchmark::CreateFromCommandLine(this);
+	if (ReplayBenchmark.IsValid())
+	{
+		PlayDemo(nullptr, ReplayBenchmark->GetReplayName());
+		return;
+	}
+
 #if PLATFORM_PS4 == 0
 	TCHAR Parm[4096] = TEXT("");
 
@@ -661,10 +670,10 @@ void UShooterGameInstance::BeginWelcomeScreenState()
 
 	ULocalPlayer* const LocalPlayer = GetFirstGamePlayer();
 	LocalPlayer->SetCachedUniqueNetId(nullptr);
-	check(!WelcomeMenuUI.IsValid());
-	WelcomeMenuUI = MakeShareable(new FShooterWelcomeMenu);
-	WelcomeMenuUI->Construct( this );
-	WelcomeMenuUI->AddToGameViewport();
+	if (GameInstanceUI.IsValid())
+	{
+		GameInstanceUI->ShowWelcomeMenu();
+	}
 
 	// Disallow splitscreen (we will allow while in the playing state)
 	GetGameViewportClient()->SetForceDisableSplitscreen( true );
@@ -672,10 +681,9 @@ void UShooterGameInstance::BeginWelcomeScreenState()
 
 void UShooterGameInstance::EndWelcomeScreenState()
 {
-	if (WelcomeMenuUI.IsValid())
+	if (GameInstanceUI.IsValid())
 	{
-		WelcomeMenuUI->RemoveFromGameViewport();
-		WelcomeMenuUI = nullptr;
+		GameInstanceUI->HideWelcomeMenu();
 	}
 }
 
@@ -732,16 +740,17 @@ void UShooterGameInstance::BeginMainMenuState()
 	// player 0 gets to own the UI
 	ULocalPlayer* const Player = GetFirstGamePlayer();
 
-	MainMenuUI = MakeShareable(new FShooterMainMenu());
-	MainMenuUI->Construct(this, Player);
-	MainMenuUI->AddMenuToGameViewport();
-
-	// It's possible that a play together event was sent by the system while the player was in-game or didn't
-	// have the application launched. The game will automatically go directly to the main menu state in those cases
-	// so this will handle Play Together if that is why we transitioned here.
-	if (PlayTogetherInfo.UserIndex != -1)
+	if (GameInstanceUI.IsValid())
 	{
-		MainMenuUI->OnPlayTogetherEventReceived();
+		GameInstanceUI->ShowMainMenu(Player);
+
+		// It's possible that a play together event was sent by the system while the player was in-game or didn't
+		// have the application launched. The game will automatically go directly to the main menu state in those cases
+		// so this will handle Play Together if that is why we transitioned here.
+		if (PlayTogetherInfo.UserIndex != -1)
+		{
+			GameInstanceUI->NotifyPlayTogether();
+		}
 	}
 
 #if !SHOOTER_CONSOLE_UI
@@ -759,10 +768,9 @@ void UShooterGameInstance::BeginMainMenuState()
 
 void UShooterGameInstance::EndMainMenuState()
 {
-	if (MainMenuUI.IsValid())
+	if (GameInstanceUI.IsValid())
 	{
-		MainMenuUI->RemoveMenuFromGameViewport();
-		MainMenuUI = nullptr;
+		GameInstanceUI->HideMainMenu();
 	}
 }
 
@@ -783,19 +791,19 @@ void UShooterGameInstance::BeginMessageMenuState()
 		ShooterViewport->HideLoadingScreen();
 	}
 
-	check(!MessageMenuUI.IsValid());
-	MessageMenuUI = MakeShareable(new FShooterMessageMenu);
-	MessageMenuUI->Construct(this, PendingMessage.PlayerOwner, PendingMessage.DisplayString, PendingMessage.OKButtonString, PendingMessage.CancelButtonString, PendingMessage.NextState);
+	if (GameInstanceUI.IsValid())
+	{
+		GameInstanceUI->ShowMessageMenu(PendingMessage);
+	}
 
 	PendingMessage.DisplayString = FText::GetEmpty();
 }
 
 void UShooterGameInstance::EndMessageMenuState()
 {
-	if (MessageMenuUI.IsValid())
+	if (GameInstanceUI.IsValid())
 	{
-		MessageMenuUI->RemoveFromGameViewport();
-		MessageMenuUI = nullptr;
+		GameInstanceUI->HideMessageMenu();
 	}
 }
 
@@ -1235,6 +1243,66 @@ void UShooterGameInstance::OnSearchSessionsComplete(bool bWasSuccessful)
 	OnServerSearchEnded.Broadcast(bWasSuccessful, ServerNames);
 }
 
+IShooterGameInstanceUI* UShooterGameInstance::GetUI() const
+{
+	return GameInstanceUI.Get();
+}
+
+TSharedPtr<FShooterReplayIndex> UShooterGameInstance::GetReplayIndex() const
+{
+	return ReplayIndex;
+}
+
+void UShooterGameInstance::PreloadNextMap(const FString& MapPackageName)
+{
+	if (MapPackageName.IsEmpty() || MapPackageName == PreloadMapName || FParse::Param(FCommandLine::Get(), TEXT("NoMapPreload")))
+	{
+		return;
+	}
+
+	// travel to the same map reloads it anyway
+	UWorld* const World = GetWorld();
+	if (World == nullptr || World->GetOutermost()->GetName() == MapPackageName || !FPackageName::DoesPackageExist(MapPackageName))
+	{
+		return;
+	}
+
+	PreloadMapName = MapPackageName;
+	PreloadedMapWorld = nullptr;
+	PreloadStartTime = FPlatformTime::Seconds();
+
+	// seamless travel finds the package already loaded and skips straight to initializing the world
+	UE_LOG(LogShooter, Log, TEXT("Preloading next map %s"), *MapPackageName);
+	LoadPackageAsync(MapPackageName, FLoadPackageAsyncDelegate::CreateUObject(this, &UShooterGameInstance::OnNextMapPreloaded), 0, PKG_ContainsMap);
+}
+
+void UShooterGameInstance::OnNextMapPreloaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+	if (PackageName.ToString() != PreloadMapName)
+	{
+		// travel already happened, or another map was requested since
+		return;
+	}
+
+	PreloadedMapWorld = LoadedPackage ? UWorld::FindWorldInPackage(LoadedPackage) : nullptr;
+	if (PreloadedMapWorld == nullptr)
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Failed to preload next map %s"), *PreloadMapName);
+		PreloadMapName.Empty();
+	}
+	else
+	{
+		UE_LOG(LogShooter, Log, TEXT("Preloaded next map %s in %.2f s"), *PreloadMapName, FPlatformTime::Seconds() - PreloadStartTime);
+	}
+
+	PreloadStartTime = 0.0;
+}
+
+void UShooterGameInstance::NotifyMapTravelStarted()
+{
+	MapTravelStartTime = FPlatformTime::Seconds();
+}
+
 bool UShooterGameInstance::Tick(float DeltaSeconds)
 {
 	// Dedicated server doesn't need to worry about game state
@@ -1248,6 +1316,11 @@ bool UShooterGameInstance::Tick(float DeltaSeconds)
 
 	MaybeChangeState();
 
+	if (GameInstanceUI.IsValid())
+	{
+		GameInstanceUI->Tick(DeltaSeconds);
+	}
+
 	UShooterGameViewportClient * ShooterViewport = Cast<UShooterGameViewportClient>(GetGameViewportClient());
 
 	if (CurrentState != ShooterGameInstanceState::WelcomeScreen)
@@ -1826,13 +1899,9 @@ FReply UShooterGameInstance::OnConfirmGeneric()
 
 void UShooterGameInstance::StartOnlinePrivilegeTask(const IOnlineIdentity::FOnGetUserPrivilegeCompleteDelegate& Delegate, EUserPrivileges::Type Privilege, TSharedPtr< const FUniqueNetId > UserId)
 {
-	WaitMessageWidget = SNew(SShooterWaitDialog)
-		.MessageText(NSLOCTEXT("NetworkStatus", "CheckingPrivilegesWithServer", "Checking privileges with server.  Please wait..."));
-
-	if (GEngine && GEngine->GameViewport)
+	if (GameInstanceUI.IsValid())
 	{
-		UGameViewportClient* const GVC = GEngine->GameViewport;
-		GVC->AddViewportWidgetContent(WaitMessageWidget.ToSharedRef());
+		GameInstanceUI->ShowWaitMessage(NSLOCTEXT("NetworkStatus", "CheckingPrivilegesWithServer", "Checking privileges with server.  Please wait..."));
 	}
 
 	auto Identity = Online::GetIdentityInterface();
@@ -1849,10 +1918,9 @@ void UShooterGameInstance::StartOnlinePrivilegeTask(const IOnlineIdentity::FOnGe
 
 void UShooterGameInstance::CleanupOnlinePrivilegeTask()
 {
-	if (GEngine && GEngine->GameViewport && WaitMessageWidget.IsValid())
+	if (GameInstanceUI.IsValid())
 	{
-		UGameViewportClient* const GVC = GEngine->GameViewport;
-		GVC->RemoveViewportWidgetContent(WaitMessageWidget.ToSharedRef());
+		GameInstanceUI->HideWaitMessage();
 	}
 }
 
@@ -2001,7 +2069,10 @@ void UShooterGameInstance::OnPlayTogetherEventReceived(const int32 UserIndex, co
 	// Always handle Play Together in the main menu since the player has session customization options.
 	else if (CurrentState == ShooterGameInstanceState::MainMenu)
 	{
-		MainMenuUI->OnPlayTogetherEventReceived();
+		if (GameInstanceUI.IsValid())
+		{
+			GameInstanceUI->NotifyPlayTogether();
+		}
 	}
 	else if (CurrentState == ShooterGameInstanceState::WelcomeScreen)
 	{
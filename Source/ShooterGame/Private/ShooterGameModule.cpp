@@ -2,37 +2,68 @@
 
 #include "ShooterGame.h"
 #include "ShooterGameDelegates.h"
-
-#include "ShooterMenuSoundsWidgetStyle.h"
-#include "ShooterMenuWidgetStyle.h"
-#include "ShooterMenuItemWidgetStyle.h"
-#include "ShooterOptionsWidgetStyle.h"
-#include "ShooterScoreboardWidgetStyle.h"
-#include "ShooterChatWidgetStyle.h"
+#include "Engine/World.h"
 #include "AssetRegistryModule.h"
 #include "IAssetRegistry.h"
 
 
+DEFINE_STAT(STAT_ShooterFireWeapon);
+DEFINE_STAT(STAT_ShooterServerNotifyHit);
+DEFINE_STAT(STAT_ShooterHandleFiring);
+DEFINE_STAT(STAT_ShooterFindClosestEnemyWithLOS);
+DEFINE_STAT(STAT_ShooterChoosePlayerStart);
+DEFINE_STAT(STAT_ShooterGetRankedMap);
+DEFINE_STAT(STAT_ShooterDrawHUD);
+DEFINE_STAT(STAT_ShooterIsReplicationPaused);
+DEFINE_STAT(STAT_ShooterScoreboardTick);
+DEFINE_STAT(STAT_ShooterUpdateHitboxes);
+DEFINE_STAT(STAT_ShooterTraces);
+DEFINE_STAT(STAT_ShooterRPCsSent);
+DEFINE_STAT(STAT_ShooterActorsSpawned);
+DEFINE_STAT(STAT_ShooterHUDTextRebuilds);
+DEFINE_STAT(STAT_ShooterChatMessagesDropped);
+DEFINE_STAT(STAT_ShooterHitboxAgreedHits);
+DEFINE_STAT(STAT_ShooterHitboxOnlyHits);
+DEFINE_STAT(STAT_ShooterMeshOnlyHits);
+DEFINE_STAT(STAT_ShooterTracesSkipped);
+DEFINE_STAT(STAT_ShooterAnimationOnlyDeaths);
+DEFINE_STAT(STAT_ShooterWeaponsReused);
+DEFINE_STAT(STAT_ShooterCorpseManager);
+DEFINE_STAT(STAT_ShooterActiveRagdolls);
+DEFINE_STAT(STAT_ShooterCorpses);
+
+CSV_DEFINE_CATEGORY_MODULE(SHOOTERGAME_API, ShooterGame, true);
 
-#include "UI/Style/ShooterStyle.h"
+/** counts every actor spawned in game worlds */
+static void OnShooterActorSpawned(AActor* SpawnedActor)
+{
+	SHOOTER_INC_COUNTER(ActorsSpawned);
+}
 
+static void OnShooterWorldInitialized(UWorld* World, const UWorld::InitializationValues IVS)
+{
+	if (World && World->IsGameWorld())
+	{
+		World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateStatic(&OnShooterActorSpawned));
+	}
+}
 
 class FShooterGameModule : public FDefaultGameModuleImpl
 {
 	virtual void StartupModule() override
 	{
 		InitializeShooterGameDelegates();
+		WorldInitHandle = FWorldDelegates::OnPostWorldInitialization.AddStatic(&OnShooterWorldInitialized);
 		FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-
-		//Hot reload hack
-		FSlateStyleRegistry::UnRegisterSlateStyle(FShooterStyle::GetStyleSetName());
-		FShooterStyle::Initialize();
 	}
 
 	virtual void ShutdownModule() override
 	{
-		FShooterStyle::Shutdown();
+		FWorldDelegates::OnPostWorldInitialization.Remove(WorldInitHandle);
 	}
+
+	/** handle for the world init hook that installs the spawn counter */
+	FDelegateHandle WorldInitHandle;
 };
 
 IMPLEMENT_PRIMARY_GAME_MODULE(FShooterGameModule, ShooterGame, "ShooterGame");
@@ -2,15 +2,14 @@
 
 #include "ShooterGame.h"
 #include "ShooterGameViewportClient.h"
-#include "SShooterConfirmationDialog.h"
-#include "Widgets/Layout/SSafeZone.h"
-#include "Widgets/Images/SThrobber.h"
 #include "Player/ShooterLocalPlayer.h"
+#include "ShooterGameUIInterface.h"
 
 UShooterGameViewportClient::UShooterGameViewportClient(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	SetSuppressTransitionMessage(true);
+	DialogType = EShooterDialogType::None;
 }
 
 void UShooterGameViewportClient::NotifyPlayerAdded(int32 PlayerIndex, ULocalPlayer* AddedPlayer)
@@ -86,7 +85,7 @@ void UShooterGameViewportClient::ShowExistingWidgets()
 	HiddenViewportContentStack.Empty();
 }
 
-void UShooterGameViewportClient::ShowDialog(TWeakObjectPtr<ULocalPlayer> PlayerOwner, EShooterDialogType::Type DialogType, const FText& Message, const FText& Confirm, const FText& Cancel, const FOnClicked& OnConfirm, const FOnClicked& OnCancel)
+void UShooterGameViewportClient::ShowDialog(TWeakObjectPtr<ULocalPlayer> PlayerOwner, EShooterDialogType::Type InDialogType, const FText& Message, const FText& Confirm, const FText& Cancel, const FOnClicked& OnConfirm, const FOnClicked& OnCancel)
 {
 	UE_LOG( LogPlayerManagement, Log, TEXT( "UShooterGameViewportClient::ShowDialog..." ) );
 
@@ -95,20 +94,21 @@ void UShooterGameViewportClient::ShowDialog(TWeakObjectPtr<ULocalPlayer> PlayerO
 		return;	// Already showing a dialog box
 	}
 
+	IShooterGameUIModule* const UIModule = IShooterGameUIModule::Get();
+	if ( UIModule == nullptr )
+	{
+		return;
+	}
+
 	// Hide all existing widgets
 	if ( !LoadingScreenWidget.IsValid() )
 	{
 		HideExistingWidgets();
 	}
 
-	DialogWidget = SNew( SShooterConfirmationDialog )
-		.PlayerOwner(PlayerOwner)
-		.DialogType(DialogType)
-		.MessageText(Message)
-		.ConfirmText(Confirm)
-		.CancelText(Cancel)
-		.OnConfirmClicked(OnConfirm)
-		.OnCancelClicked(OnCancel);
+	DialogWidget = UIModule->CreateDialogWidget(PlayerOwner, InDialogType, Message, Confirm, Cancel, OnConfirm, OnCancel);
+	DialogType = InDialogType;
+	DialogOwner = PlayerOwner;
 
 	if ( LoadingScreenWidget.IsValid() )
 	{
@@ -140,6 +140,8 @@ void UShooterGameViewportClient::HideDialog()
 
 		// Destroy the dialog widget
 		DialogWidget = NULL;
+		DialogType = EShooterDialogType::None;
+		DialogOwner = nullptr;
 
 		if ( !LoadingScreenWidget.IsValid() )
 		{
@@ -158,7 +160,8 @@ void UShooterGameViewportClient::HideDialog()
 
 void UShooterGameViewportClient::ShowLoadingScreen()
 {
-	if ( LoadingScreenWidget.IsValid() )
+	IShooterGameUIModule* const UIModule = IShooterGameUIModule::Get();
+	if ( LoadingScreenWidget.IsValid() || UIModule == nullptr )
 	{
 		return;
 	}
@@ -177,7 +180,7 @@ void UShooterGameViewportClient::ShowLoadingScreen()
 		HideExistingWidgets();
 	}
 
-	LoadingScreenWidget = SNew( SShooterLoadingScreen );
+	LoadingScreenWidget = UIModule->CreateLoadingScreenWidget();
 
 	AddViewportWidgetContent( LoadingScreenWidget.ToSharedRef() );
 }
@@ -209,12 +212,12 @@ void UShooterGameViewportClient::HideLoadingScreen()
 
 EShooterDialogType::Type UShooterGameViewportClient::GetDialogType() const
 {
-	return (DialogWidget.IsValid() ? DialogWidget->DialogType : EShooterDialogType::None);
+	return DialogType;
 }
 
 TWeakObjectPtr<ULocalPlayer> UShooterGameViewportClient::GetDialogOwner() const
 {
-	return (DialogWidget.IsValid() ? DialogWidget->PlayerOwner : nullptr);
+	return DialogOwner;
 }
 
 void UShooterGameViewportClient::Tick(float DeltaSeconds)
@@ -273,37 +276,3 @@ void UShooterGameViewportClient::ReleaseSlateResources()
 	ViewportContentStack.Empty();
 	HiddenViewportContentStack.Empty();
 }
-
-void SShooterLoadingScreen::Construct(const FArguments& InArgs)
-{
-	static const FName LoadingScreenName(TEXT("/Game/UI/Menu/LoadingScreen.LoadingScreen"));
-
-	//since we are not using game styles here, just load one image
-	LoadingScreenBrush = MakeShareable( new FShooterGameLoadingScreenBrush( LoadingScreenName, FVector2D(1920,1080) ) );
-
-	ChildSlot
-	[
-		SNew(SOverlay)
-		+SOverlay::Slot()
-		.HAlign(HAlign_Fill)
-		.VAlign(VAlign_Fill)
-		[
-			SNew(SImage)
-			.Image(LoadingScreenBrush.Get())
-		]
-		+SOverlay::Slot()
-		.HAlign(HAlign_Fill)
-		.VAlign(VAlign_Fill)
-		[
-			SNew(SSafeZone)
-			.VAlign(VAlign_Bottom)
-			.HAlign(HAlign_Right)
-			.Padding(10.0f)
-			.IsTitleSafe(true)
-			[
-				SNew(SThrobber)
-				.Visibility(this, &SShooterLoadingScreen::GetLoadIndicatorVisibility)
-			]
-		]
-	];
-}
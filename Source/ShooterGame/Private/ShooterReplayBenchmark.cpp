@@ -0,0 +1,386 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterReplayBenchmark.h"
+#include "ShooterGameInstance.h"
+#include "Engine/DemoNetDriver.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace ShooterReplayBenchmark
+{
+	/** frames between two particle system samples */
+	static const int32 ParticleSampleInterval = 30;
+
+	/** summary values compared against the baseline, lower is better for all of them; seek times only exist in runs that seeked */
+	static const TCHAR* ComparedValues[] = { TEXT("AvgFrameMs"), TEXT("P95FrameMs"), TEXT("AvgGameThreadMs"), TEXT("PeakUsedPhysicalMB"), TEXT("AvgSeekMs"), TEXT("MaxSeekMs") };
+}
+
+FShooterReplayBenchmark::FShooterReplayBenchmark(UShooterGameInstance* InGameInstance, const FString& InReplayName, float InSimFPS, int32 InNumSeeks)
+	: GameInstance(InGameInstance)
+	, ReplayName(InReplayName)
+	, SimFPS(FMath::Max(1.0f, InSimFPS))
+	, NumSeeks(FMath::Max(0, InNumSeeks))
+	, NumFailedSeeks(0)
+	, SeekStartTime(0.0)
+	, PlaybackDemoSeconds(0.0f)
+	, PlaybackWallSeconds(0.0)
+	, bPlaybackDone(false)
+	, LastFrameTime(0.0)
+	, StartTime(0.0)
+	, StartDemoTime(0.0f)
+	, bMeasuring(false)
+	, bFinished(false)
+{
+	// every run simulates the same frames, no matter how long each of them takes
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(1.0 / SimFPS);
+
+	UE_LOG(LogShooter, Log, TEXT("Replay benchmark of %s (%.1f fps fixed timestep)"), *ReplayName, SimFPS);
+}
+
+FShooterReplayBenchmark::~FShooterReplayBenchmark()
+{
+}
+
+TSharedPtr<FShooterReplayBenchmark> FShooterReplayBenchmark::CreateFromCommandLine(UShooterGameInstance* InGameInstance)
+{
+	FString ReplayName;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("ReplayBenchmark="), ReplayName) || ReplayName.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	float SimFPS = 30.0f;
+	FParse::Value(FCommandLine::Get(), TEXT("ReplayBenchmarkFPS="), SimFPS);
+
+	int32 NumSeeks = 0;
+	FParse::Value(FCommandLine::Get(), TEXT("ReplayBenchmarkSeeks="), NumSeeks);
+
+	return MakeShareable(new FShooterReplayBenchmark(InGameInstance, ReplayName, SimFPS, NumSeeks));
+}
+
+const FString& FShooterReplayBenchmark::GetReplayName() const
+{
+	return ReplayName;
+}
+
+void FShooterReplayBenchmark::OnPlaybackFailed(const FString& ErrorString)
+{
+	bFinished = true;
+
+	UE_LOG(LogShooter, Error, TEXT("Replay benchmark of %s failed: %s"), *ReplayName, *ErrorString);
+	FPlatformMisc::RequestExitWithStatus(false, 2);
+}
+
+void FShooterReplayBenchmark::Tick(float DeltaTime)
+{
+	const UWorld* World = GameInstance->GetWorld();
+	const UDemoNetDriver* DemoDriver = World ? World->GetDemoNetDriver() : nullptr;
+	if (DemoDriver == nullptr || DemoDriver->IsServer() || DemoDriver->GetDemoTotalTime() <= 0.0f)
+	{
+		return;
+	}
+
+	if (!bMeasuring)
+	{
+		BeginMeasuring();
+		return;
+	}
+
+	if (bPlaybackDone)
+	{
+		// frames spent loading checkpoints count towards the seek, not playback
+		if (SeekStartTime == 0.0)
+		{
+			StartNextSeek();
+		}
+		return;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	FFrameSample& Sample = Frames[Frames.AddUninitialized()];
+	Sample.FrameMs = (float)((CurrentTime - LastFrameTime) * 1000.0);
+	Sample.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Sample.RenderThreadMs = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+	LastFrameTime = CurrentTime;
+
+	if (Frames.Num() % ShooterReplayBenchmark::ParticleSampleInterval == 0)
+	{
+		ParticleSamples.Add(CountActiveParticleSystems());
+	}
+
+	if (DemoDriver->GetDemoCurrentTime() >= DemoDriver->GetDemoTotalTime())
+	{
+		EndPlayback();
+	}
+}
+
+void FShooterReplayBenchmark::EndPlayback()
+{
+	const UDemoNetDriver* DemoDriver = GameInstance->GetWorld()->GetDemoNetDriver();
+
+	bPlaybackDone = true;
+	PlaybackDemoSeconds = DemoDriver->GetDemoCurrentTime() - StartDemoTime;
+	PlaybackWallSeconds = FPlatformTime::Seconds() - StartTime;
+
+	if (NumSeeks == 0)
+	{
+		FinishBenchmark();
+	}
+}
+
+void FShooterReplayBenchmark::StartNextSeek()
+{
+	if (SeekTimesMs.Num() + NumFailedSeeks >= NumSeeks)
+	{
+		FinishBenchmark();
+		return;
+	}
+
+	UDemoNetDriver* DemoDriver = GameInstance->GetWorld()->GetDemoNetDriver();
+
+	// evenly spaced, alternating between both halves so every seek has to load a different checkpoint
+	const int32 SeekIdx = SeekTimesMs.Num() + NumFailedSeeks;
+	const int32 SpreadIdx = (SeekIdx % 2 == 0) ? SeekIdx / 2 : NumSeeks - 1 - SeekIdx / 2;
+	const float TargetTime = DemoDriver->GetDemoTotalTime() * (SpreadIdx + 0.5f) / NumSeeks;
+
+	SeekStartTime = FPlatformTime::Seconds();
+	if (!DemoDriver->GotoTimeInSeconds(TargetTime, FOnGotoTimeDelegate::CreateSP(this, &FShooterReplayBenchmark::OnSeekComplete)))
+	{
+		OnSeekComplete(false);
+	}
+}
+
+void FShooterReplayBenchmark::OnSeekComplete(bool bWasSuccessful)
+{
+	const float SeekMs = (float)((FPlatformTime::Seconds() - SeekStartTime) * 1000.0);
+	SeekStartTime = 0.0;
+
+	if (bWasSuccessful)
+	{
+		SeekTimesMs.Add(SeekMs);
+	}
+	else
+	{
+		NumFailedSeeks++;
+	}
+}
+
+bool FShooterReplayBenchmark::IsTickable() const
+{
+	return !bFinished && GameInstance.IsValid();
+}
+
+bool FShooterReplayBenchmark::IsTickableWhenPaused() const
+{
+	return false;
+}
+
+TStatId FShooterReplayBenchmark::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(FShooterReplayBenchmark, STATGROUP_Tickables);
+}
+
+void FShooterReplayBenchmark::BeginMeasuring()
+{
+	const UDemoNetDriver* DemoDriver = GameInstance->GetWorld()->GetDemoNetDriver();
+
+	bMeasuring = true;
+	StartTime = LastFrameTime = FPlatformTime::Seconds();
+	StartDemoTime = DemoDriver->GetDemoCurrentTime();
+	Frames.Reserve(FMath::CeilToInt(DemoDriver->GetDemoTotalTime() * SimFPS) + 1);
+
+#if CSV_PROFILER
+	FCsvProfiler::Get()->BeginCapture(-1, FPaths::ProjectSavedDir() / TEXT("ReplayBenchmark"), ReplayName + TEXT("-Stats.csv"));
+#endif
+}
+
+void FShooterReplayBenchmark::FinishBenchmark()
+{
+	bFinished = true;
+
+#if CSV_PROFILER
+	FCsvProfiler::Get()->EndCapture();
+#endif
+
+	const FString BaseName = FPaths::ProjectSavedDir() / TEXT("ReplayBenchmark") / ReplayName;
+	WriteFrameTimings(BaseName + TEXT("-Frames.csv"));
+
+	TSharedRef<FJsonObject> Summary = BuildSummary();
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Summary, Writer);
+	FFileHelper::SaveStringToFile(Json, *(BaseName + TEXT("-Summary.json")));
+
+	UE_LOG(LogShooter, Log, TEXT("Replay benchmark of %s finished: %d frames in %.2fs. Report: %s"),
+		*ReplayName, Frames.Num(), FPlatformTime::Seconds() - StartTime, *BaseName);
+
+	bool bPassed = true;
+	FString BaselineFilename;
+	if (FParse::Value(FCommandLine::Get(), TEXT("ReplayBenchmarkBaseline="), BaselineFilename))
+	{
+		if (FParse::Param(FCommandLine::Get(), TEXT("ReplayBenchmarkUpdateBaseline")))
+		{
+			FFileHelper::SaveStringToFile(Json, *BaselineFilename);
+			UE_LOG(LogShooter, Log, TEXT("Replay benchmark baseline updated: %s"), *BaselineFilename);
+		}
+		else
+		{
+			bPassed = CompareToBaseline(Summary, BaselineFilename);
+		}
+	}
+
+	FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+}
+
+void FShooterReplayBenchmark::WriteFrameTimings(const FString& Filename) const
+{
+	FString Csv = TEXT("Frame,FrameMs,GameThreadMs,RenderThreadMs\n");
+	for (int32 i = 0; i < Frames.Num(); ++i)
+	{
+		Csv += FString::Printf(TEXT("%d,%.4f,%.4f,%.4f\n"), i, Frames[i].FrameMs, Frames[i].GameThreadMs, Frames[i].RenderThreadMs);
+	}
+
+	FFileHelper::SaveStringToFile(Csv, *Filename);
+}
+
+TSharedRef<FJsonObject> FShooterReplayBenchmark::BuildSummary() const
+{
+	const int32 NumFrames = Frames.Num();
+
+	TArray<float> SortedFrameTimes;
+	SortedFrameTimes.Reserve(NumFrames);
+
+	float TotalFrameMs = 0.0f;
+	float TotalGameThreadMs = 0.0f;
+	float TotalRenderThreadMs = 0.0f;
+	for (const FFrameSample& Sample : Frames)
+	{
+		SortedFrameTimes.Add(Sample.FrameMs);
+		TotalFrameMs += Sample.FrameMs;
+		TotalGameThreadMs += Sample.GameThreadMs;
+		TotalRenderThreadMs += Sample.RenderThreadMs;
+	}
+	SortedFrameTimes.Sort();
+
+	int32 TotalParticles = 0;
+	int32 MaxParticles = 0;
+	for (int32 NumParticles : ParticleSamples)
+	{
+		TotalParticles += NumParticles;
+		MaxParticles = FMath::Max(MaxParticles, NumParticles);
+	}
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+
+	TSharedRef<FJsonObject> Summary = MakeShareable(new FJsonObject());
+	Summary->SetStringField(TEXT("Replay"), ReplayName);
+	Summary->SetStringField(TEXT("Map"), GameInstance.IsValid() && GameInstance->GetWorld() ? GameInstance->GetWorld()->GetMapName() : FString());
+	Summary->SetNumberField(TEXT("SimFPS"), SimFPS);
+	Summary->SetNumberField(TEXT("ReplaySeconds"), PlaybackDemoSeconds);
+	Summary->SetNumberField(TEXT("Frames"), NumFrames);
+	Summary->SetNumberField(TEXT("WallSeconds"), PlaybackWallSeconds);
+	Summary->SetNumberField(TEXT("AvgFrameMs"), NumFrames > 0 ? TotalFrameMs / NumFrames : 0.0f);
+	Summary->SetNumberField(TEXT("P95FrameMs"), NumFrames > 0 ? SortedFrameTimes[FMath::Min(NumFrames - 1, (NumFrames * 95) / 100)] : 0.0f);
+	Summary->SetNumberField(TEXT("MaxFrameMs"), NumFrames > 0 ? SortedFrameTimes.Last() : 0.0f);
+	Summary->SetNumberField(TEXT("AvgGameThreadMs"), NumFrames > 0 ? TotalGameThreadMs / NumFrames : 0.0f);
+	Summary->SetNumberField(TEXT("AvgRenderThreadMs"), NumFrames > 0 ? TotalRenderThreadMs / NumFrames : 0.0f);
+	Summary->SetNumberField(TEXT("AvgActiveParticleSystems"), ParticleSamples.Num() > 0 ? (float)TotalParticles / ParticleSamples.Num() : 0.0f);
+	Summary->SetNumberField(TEXT("MaxActiveParticleSystems"), MaxParticles);
+	Summary->SetNumberField(TEXT("PeakUsedPhysicalMB"), MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0));
+	Summary->SetNumberField(TEXT("PeakUsedVirtualMB"), MemoryStats.PeakUsedVirtual / (1024.0 * 1024.0));
+
+	if (NumSeeks > 0)
+	{
+		float TotalSeekMs = 0.0f;
+		float MaxSeekMs = 0.0f;
+		for (float SeekMs : SeekTimesMs)
+		{
+			TotalSeekMs += SeekMs;
+			MaxSeekMs = FMath::Max(MaxSeekMs, SeekMs);
+		}
+
+		Summary->SetNumberField(TEXT("Seeks"), SeekTimesMs.Num());
+		Summary->SetNumberField(TEXT("FailedSeeks"), NumFailedSeeks);
+
+		// no seek times at all isn't a zero seek time, leave them out so the comparison flags it
+		if (SeekTimesMs.Num() > 0)
+		{
+			Summary->SetNumberField(TEXT("AvgSeekMs"), TotalSeekMs / SeekTimesMs.Num());
+			Summary->SetNumberField(TEXT("MaxSeekMs"), MaxSeekMs);
+		}
+	}
+
+	return Summary;
+}
+
+bool FShooterReplayBenchmark::CompareToBaseline(const TSharedRef<FJsonObject>& Summary, const FString& BaselineFilename) const
+{
+	FString BaselineJson;
+	TSharedPtr<FJsonObject> Baseline;
+	if (!FFileHelper::LoadFileToString(BaselineJson, *BaselineFilename) ||
+		!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineJson), Baseline) || !Baseline.IsValid())
+	{
+		UE_LOG(LogShooter, Error, TEXT("Replay benchmark baseline %s could not be read, rerun with -ReplayBenchmarkUpdateBaseline to create it"), *BaselineFilename);
+		return false;
+	}
+
+	float TolerancePct = 10.0f;
+	FParse::Value(FCommandLine::Get(), TEXT("ReplayBenchmarkTolerance="), TolerancePct);
+
+	bool bPassed = true;
+	for (const TCHAR* ValueName : ShooterReplayBenchmark::ComparedValues)
+	{
+		double BaselineValue = 0.0;
+		double CurrentValue = 0.0;
+		const bool bInBaseline = Baseline->TryGetNumberField(ValueName, BaselineValue);
+		const bool bInSummary = Summary->TryGetNumberField(ValueName, CurrentValue);
+		if (!bInBaseline && !bInSummary)
+		{
+			// e.g. seek times when neither run seeked
+			UE_LOG(LogShooter, Log, TEXT("Replay benchmark: %s not measured"), ValueName);
+			continue;
+		}
+
+		if (!bInBaseline || !bInSummary || BaselineValue <= 0.0)
+		{
+			UE_LOG(LogShooter, Error, TEXT("Replay benchmark: %s missing from the %s, can't compare"), ValueName, bInSummary ? TEXT("baseline") : TEXT("run"));
+			bPassed = false;
+			continue;
+		}
+
+		const double ChangePct = (CurrentValue - BaselineValue) * 100.0 / BaselineValue;
+		if (ChangePct > TolerancePct)
+		{
+			UE_LOG(LogShooter, Error, TEXT("Replay benchmark regression: %s %.3f (baseline %.3f, %+.1f%%)"), ValueName, CurrentValue, BaselineValue, ChangePct);
+			bPassed = false;
+		}
+		else
+		{
+			UE_LOG(LogShooter, Log, TEXT("Replay benchmark: %s %.3f (baseline %.3f, %+.1f%%)"), ValueName, CurrentValue, BaselineValue, ChangePct);
+		}
+	}
+
+	return bPassed;
+}
+
+int32 FShooterReplayBenchmark::CountActiveParticleSystems() const
+{
+	const UWorld* World = GameInstance->GetWorld();
+
+	int32 NumActive = 0;
+	for (TObjectIterator<UParticleSystemComponent> It; It; ++It)
+	{
+		if (It->GetWorld() == World && It->IsActive())
+		{
+			NumActive++;
+		}
+	}
+	return NumActive;
+}
@@ -0,0 +1,133 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Tickable.h"
+
+class UShooterGameInstance;
+
+/**
+ * Replay driven client CPU benchmark.
+ *
+ * Enabled with -ReplayBenchmark=<ReplayName>, usually together with -nullrhi. The replay is played back on a
+ * fixed timestep as fast as the CPU allows, so every run simulates exactly the same frames. Per-frame timings
+ * are written to Saved/ReplayBenchmark together with a summary (frame, game and render thread times, particle
+ * counts, memory high-water mark). When the engine CSV profiler is compiled in, a CSV capture with the full
+ * stat breakdown (audio, particles, ...) is recorded for the same frames.
+ *
+ *   -ReplayBenchmarkFPS=30                 simulated frame rate
+ *   -ReplayBenchmarkBaseline=<file.json>   compare the summary against a previous one, exit code 1 on regression
+ *   -ReplayBenchmarkTolerance=10           allowed increase against the baseline, in percent
+ *   -ReplayBenchmarkUpdateBaseline         write the summary to the baseline file instead of comparing
+ *   -ReplayBenchmarkSeeks=10               after playback, seek to evenly spaced times and report the seek times
+ */
+class FShooterReplayBenchmark : public FTickableGameObject, public TSharedFromThis<FShooterReplayBenchmark>
+{
+public:
+
+	FShooterReplayBenchmark(UShooterGameInstance* InGameInstance, const FString& InReplayName, float InSimFPS, int32 InNumSeeks);
+	virtual ~FShooterReplayBenchmark();
+
+	/** creates a benchmark if the command line asks for one */
+	static TSharedPtr<FShooterReplayBenchmark> CreateFromCommandLine(UShooterGameInstance* InGameInstance);
+
+	/** name of the replay being benchmarked */
+	const FString& GetReplayName() const;
+
+	/** replay couldn't be played, report and exit */
+	void OnPlaybackFailed(const FString& ErrorString);
+
+	// FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+
+	/** timings of a single simulated frame */
+	struct FFrameSample
+	{
+		float FrameMs;
+		float GameThreadMs;
+		float RenderThreadMs;
+	};
+
+	/** start sampling once the replay is actually streaming */
+	void BeginMeasuring();
+
+	/** playback reached the end, seek or finish */
+	void EndPlayback();
+
+	/** seek to the next benchmark time */
+	void StartNextSeek();
+
+	/** demo driver finished loading the checkpoint and fast forwarding */
+	void OnSeekComplete(bool bWasSuccessful);
+
+	/** write the report, compare against the baseline and request engine exit */
+	void FinishBenchmark();
+
+	/** write per-frame timings as CSV */
+	void WriteFrameTimings(const FString& Filename) const;
+
+	/** build the summary for this run */
+	TSharedRef<FJsonObject> BuildSummary() const;
+
+	/** returns false if the baseline can't be read, a value is only in one of both summaries or got worse than allowed */
+	bool CompareToBaseline(const TSharedRef<FJsonObject>& Summary, const FString& BaselineFilename) const;
+
+	/** count active particle systems in the replay world */
+	int32 CountActiveParticleSystems() const;
+
+	/** owning game instance */
+	TWeakObjectPtr<UShooterGameInstance> GameInstance;
+
+	/** replay being played back */
+	FString ReplayName;
+
+	/** fixed simulation rate */
+	float SimFPS;
+
+	/** per-frame timings */
+	TArray<FFrameSample> Frames;
+
+	/** active particle systems, sampled periodically */
+	TArray<int32> ParticleSamples;
+
+	/** seeks done after playback */
+	int32 NumSeeks;
+
+	/** wall clock time of each completed seek */
+	TArray<float> SeekTimesMs;
+
+	/** seeks the demo driver reported as failed */
+	int32 NumFailedSeeks;
+
+	/** wall clock time the running seek started, 0 if none is running */
+	double SeekStartTime;
+
+	/** replay seconds played back while measuring */
+	float PlaybackDemoSeconds;
+
+	/** wall clock seconds spent on playback */
+	double PlaybackWallSeconds;
+
+	/** playback reached the end of the replay */
+	bool bPlaybackDone;
+
+	/** wall clock time of the previous tick */
+	double LastFrameTime;
+
+	/** wall clock time measuring started */
+	double StartTime;
+
+	/** replay time when measuring started */
+	float StartDemoTime;
+
+	/** sampling started */
+	bool bMeasuring;
+
+	/** report was already written */
+	bool bFinished;
+};
@@ -0,0 +1,357 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterReplayIndex.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/NetworkVersion.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace ShooterReplayIndex
+{
+	/** bump when the file layout changes, older files are ignored and rebuilt by a rescan */
+	static const int32 FileVersion = 1;
+}
+
+FShooterReplayIndex::FShooterReplayIndex()
+	: Revision(0)
+	, bLoaded(false)
+	, bRescanPending(false)
+	, bRescanning(false)
+	, bRescanned(false)
+{
+}
+
+FShooterReplayIndex::~FShooterReplayIndex()
+{
+	// don't lose the last write on exit
+	if (PendingSave.IsValid())
+	{
+		PendingSave.Wait();
+	}
+}
+
+FString FShooterReplayIndex::GetIndexFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("Demos") / TEXT("ReplayIndex.json");
+}
+
+void FShooterReplayIndex::Load()
+{
+	if (bLoaded)
+	{
+		return;
+	}
+
+	TWeakPtr<FShooterReplayIndex> WeakThis = AsShared();
+	const FString Filename = GetIndexFilename();
+
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Filename]()
+	{
+		TArray<FShooterReplayInfo> LoadedReplays;
+
+		FString Json;
+		if (FFileHelper::LoadFileToString(Json, *Filename))
+		{
+			ParseIndex(Json, LoadedReplays);
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, LoadedReplays]()
+		{
+			TSharedPtr<FShooterReplayIndex> This = WeakThis.Pin();
+			if (This.IsValid())
+			{
+				This->OnLoaded(LoadedReplays);
+			}
+		});
+	});
+}
+
+void FShooterReplayIndex::ParseIndex(const FString& Json, TArray<FShooterReplayInfo>& OutReplays)
+{
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		return;
+	}
+
+	if (Root->GetIntegerField(TEXT("Version")) != ShooterReplayIndex::FileVersion)
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Entries = nullptr;
+	if (!Root->TryGetArrayField(TEXT("Replays"), Entries))
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Entry : *Entries)
+	{
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+		if (!Entry.IsValid() || !Entry->TryGetObject(Object))
+		{
+			continue;
+		}
+
+		FShooterReplayInfo Info;
+		if (!(*Object)->TryGetStringField(TEXT("Name"), Info.Name) || Info.Name.IsEmpty())
+		{
+			continue;
+		}
+
+		FString Timestamp, Size;
+		(*Object)->TryGetStringField(TEXT("FriendlyName"), Info.FriendlyName);
+		(*Object)->TryGetStringField(TEXT("Timestamp"), Timestamp);
+		(*Object)->TryGetNumberField(TEXT("LengthInMS"), Info.LengthInMS);
+		// int64 doesn't survive a round trip through a json number
+		(*Object)->TryGetStringField(TEXT("SizeInBytes"), Size);
+		(*Object)->TryGetStringField(TEXT("Map"), Info.MapName);
+		(*Object)->TryGetStringField(TEXT("GameType"), Info.GameType);
+		(*Object)->TryGetNumberField(TEXT("Kills"), Info.NumKills);
+		(*Object)->TryGetStringField(TEXT("TopPlayer"), Info.TopPlayerName);
+		(*Object)->TryGetNumberField(TEXT("TopScore"), Info.TopPlayerScore);
+		(*Object)->TryGetBoolField(TEXT("Compatible"), Info.bCompatible);
+
+		FDateTime::ParseIso8601(*Timestamp, Info.Timestamp);
+		LexFromString(Info.SizeInBytes, *Size);
+
+		OutReplays.Add(Info);
+	}
+}
+
+void FShooterReplayIndex::OnLoaded(const TArray<FShooterReplayInfo>& LoadedReplays)
+{
+	bLoaded = true;
+
+	// keep anything recorded while the file was loading
+	const bool bRecordedWhileLoading = Replays.Num() > 0;
+	for (const FShooterReplayInfo& Loaded : LoadedReplays)
+	{
+		if (!Replays.ContainsByPredicate([&Loaded](const FShooterReplayInfo& Info) { return Info.Name == Loaded.Name; }))
+		{
+			Replays.Add(Loaded);
+		}
+	}
+
+	UE_LOG(LogShooter, Log, TEXT("Replay index loaded with %d replays"), Replays.Num());
+
+	if (bRecordedWhileLoading)
+	{
+		OnReplaysChanged();
+	}
+	else
+	{
+		Replays.StableSort([](const FShooterReplayInfo& A, const FShooterReplayInfo& B) { return A.Timestamp > B.Timestamp; });
+		Revision++;
+	}
+
+	if (bRescanPending)
+	{
+		bRescanPending = false;
+		Rescan(true);
+	}
+}
+
+bool FShooterReplayIndex::IsLoaded() const
+{
+	return bLoaded;
+}
+
+const TArray<FShooterReplayInfo>& FShooterReplayIndex::GetReplays() const
+{
+	return Replays;
+}
+
+int32 FShooterReplayIndex::GetRevision() const
+{
+	return Revision;
+}
+
+bool FShooterReplayIndex::IsRescanning() const
+{
+	return bRescanning;
+}
+
+void FShooterReplayIndex::AddRecordedReplay(const FShooterReplayInfo& ReplayInfo)
+{
+	FShooterReplayInfo* Existing = Replays.FindByPredicate([&ReplayInfo](const FShooterReplayInfo& Info) { return Info.Name == ReplayInfo.Name; });
+	if (Existing)
+	{
+		// the streamer knows the final size and length better than the recording game
+		const int64 SizeInBytes = Existing->SizeInBytes;
+		*Existing = ReplayInfo;
+		Existing->SizeInBytes = FMath::Max(SizeInBytes, ReplayInfo.SizeInBytes);
+	}
+	else
+	{
+		Replays.Add(ReplayInfo);
+	}
+
+	OnReplaysChanged();
+}
+
+void FShooterReplayIndex::RemoveReplay(const FString& ReplayName)
+{
+	if (Replays.RemoveAll([&ReplayName](const FShooterReplayInfo& Info) { return Info.Name == ReplayName; }) > 0)
+	{
+		OnReplaysChanged();
+	}
+}
+
+void FShooterReplayIndex::Rescan(bool bForce)
+{
+	if (bRescanning || (bRescanned && !bForce))
+	{
+		return;
+	}
+
+	if (!bLoaded)
+	{
+		// merging into an empty index would drop the metadata in the file
+		bRescanPending = true;
+		return;
+	}
+
+	if (!ReplayStreamer.IsValid())
+	{
+		ReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
+	}
+
+	if (!ReplayStreamer.IsValid())
+	{
+		return;
+	}
+
+	bRescanning = true;
+	CompatibleReplayNames.Reset();
+
+	// same filter the demo list used: any changelist of the current network version
+	FNetworkReplayVersion CompatibleVersion = FNetworkVersion::GetReplayVersion();
+	CompatibleVersion.Changelist = 0;
+
+	ReplayStreamer->EnumerateStreams(CompatibleVersion, INDEX_NONE, FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateSP(this, &FShooterReplayIndex::OnEnumerateCompatibleComplete));
+}
+
+void FShooterReplayIndex::OnEnumerateCompatibleComplete(const FEnumerateStreamsResult& Result)
+{
+	for (const FNetworkReplayStreamInfo& StreamInfo : Result.FoundStreams)
+	{
+		CompatibleReplayNames.Add(StreamInfo.Name);
+	}
+
+	FNetworkReplayVersion AllVersions = FNetworkVersion::GetReplayVersion();
+	AllVersions.NetworkVersion = 0;
+	AllVersions.Changelist = 0;
+
+	ReplayStreamer->EnumerateStreams(AllVersions, INDEX_NONE, FString(), TArray<FString>(), FEnumerateStreamsCallback::CreateSP(this, &FShooterReplayIndex::OnEnumerateAllComplete));
+}
+
+void FShooterReplayIndex::OnEnumerateAllComplete(const FEnumerateStreamsResult& Result)
+{
+	bRescanning = false;
+
+	if (!Result.WasSuccessful())
+	{
+		UE_LOG(LogShooter, Warning, TEXT("Replay index rescan failed, keeping %d indexed replays"), Replays.Num());
+		return;
+	}
+
+	bRescanned = true;
+
+	TArray<FShooterReplayInfo> ScannedReplays;
+	ScannedReplays.Reserve(Result.FoundStreams.Num());
+
+	for (const FNetworkReplayStreamInfo& StreamInfo : Result.FoundStreams)
+	{
+		FShooterReplayInfo Info;
+		const FShooterReplayInfo* Existing = Replays.FindByPredicate([&StreamInfo](const FShooterReplayInfo& Indexed) { return Indexed.Name == StreamInfo.Name; });
+		if (StreamInfo.bIsLive)
+		{
+			// still recording, the game mode adds it when the match ends and the next rescan fills in the final size
+			if (Existing)
+			{
+				ScannedReplays.Add(*Existing);
+			}
+			continue;
+		}
+
+		if (Existing)
+		{
+			Info = *Existing;
+		}
+
+		Info.Name = StreamInfo.Name;
+		Info.FriendlyName = StreamInfo.FriendlyName;
+		Info.Timestamp = StreamInfo.Timestamp;
+		Info.LengthInMS = StreamInfo.LengthInMS;
+		Info.SizeInBytes = StreamInfo.SizeInBytes;
+		Info.bCompatible = CompatibleReplayNames.Contains(StreamInfo.Name);
+
+		ScannedReplays.Add(Info);
+	}
+
+	UE_LOG(LogShooter, Log, TEXT("Replay index rescanned: %d replays, %d compatible"), ScannedReplays.Num(), CompatibleReplayNames.Num());
+
+	Replays = MoveTemp(ScannedReplays);
+	CompatibleReplayNames.Reset();
+
+	OnReplaysChanged();
+}
+
+void FShooterReplayIndex::OnReplaysChanged()
+{
+	Replays.StableSort([](const FShooterReplayInfo& A, const FShooterReplayInfo& B) { return A.Timestamp > B.Timestamp; });
+	Revision++;
+
+	if (!bLoaded)
+	{
+		// written once the file has been read and merged
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Entries;
+	Entries.Reserve(Replays.Num());
+
+	for (const FShooterReplayInfo& Info : Replays)
+	{
+		TSharedRef<FJsonObject> Object = MakeShareable(new FJsonObject);
+		Object->SetStringField(TEXT("Name"), Info.Name);
+		Object->SetStringField(TEXT("FriendlyName"), Info.FriendlyName);
+		Object->SetStringField(TEXT("Timestamp"), Info.Timestamp.ToIso8601());
+		Object->SetNumberField(TEXT("LengthInMS"), Info.LengthInMS);
+		Object->SetStringField(TEXT("SizeInBytes"), LexToString(Info.SizeInBytes));
+		Object->SetStringField(TEXT("Map"), Info.MapName);
+		Object->SetStringField(TEXT("GameType"), Info.GameType);
+		Object->SetNumberField(TEXT("Kills"), Info.NumKills);
+		Object->SetStringField(TEXT("TopPlayer"), Info.TopPlayerName);
+		Object->SetNumberField(TEXT("TopScore"), Info.TopPlayerScore);
+		Object->SetBoolField(TEXT("Compatible"), Info.bCompatible);
+		Entries.Add(MakeShareable(new FJsonValueObject(Object)));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShareable(new FJsonObject);
+	Root->SetNumberField(TEXT("Version"), ShooterReplayIndex::FileVersion);
+	Root->SetArrayField(TEXT("Replays"), Entries);
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	// writes must land in order
+	if (PendingSave.IsValid())
+	{
+		PendingSave.Wait();
+	}
+
+	const FString Filename = GetIndexFilename();
+	PendingSave = Async(EAsyncExecution::ThreadPool, [Json, Filename]()
+	{
+		if (!FFileHelper::SaveStringToFile(Json, *Filename))
+		{
+			UE_LOG(LogShooter, Warning, TEXT("Failed to write replay index %s"), *Filename);
+		}
+	});
+}
@@ -0,0 +1,430 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterVisibilityBakeCommandlet.h"
+#include "ShooterVisibilityMap.h"
+#include "EngineUtils.h"
+#include "Engine/LevelBounds.h"
+#include "Engine/LevelStreaming.h"
+#include "NavigationSystem.h"
+#include "NavMesh/NavMeshBoundsVolume.h"
+#include "Async/ParallelFor.h"
+
+namespace ShooterVisibilityBake
+{
+	/** default edge length of a cell */
+	const float DefaultCellSize = 300.0f;
+
+	/** floor traces per cell along X and Y, and the most sample points kept per cell */
+	const int32 FloorSamplesPerAxis = 2;
+	const int32 MaxCellSamples = 16;
+
+	/** lowest and highest point above the floor a standing character can be queried from, feet to top of the head */
+	const float MinHeight = 10.0f;
+	const float MaxHeight = 220.0f;
+
+	/** sample points per floor hit, spread evenly from MinHeight to MaxHeight */
+	const int32 HeightSamples = 4;
+
+	/** flattest floor a character can stand on */
+	const float WalkableFloorZ = 0.7f;
+
+	/** how far the floor trace skips below a hit before looking for the next floor */
+	const float FloorSkip = 20.0f;
+
+	/** most floor traces down one column */
+	const int32 MaxFloorTraces = 64;
+
+	/** cells closer than this many cell sizes always see each other */
+	const float AlwaysVisibleCells = 2.0f;
+
+	/** biggest grid we bake */
+	const int64 MaxVoxels = 1 << 24;
+}
+
+/** a cell characters can be in, during the bake */
+struct FShooterBakeCell
+{
+	/** center of the cell */
+	FVector Center;
+
+	/** points visibility is traced from and to */
+	TArray<FVector, TInlineAllocator<ShooterVisibilityBake::MaxCellSamples>> Samples;
+};
+
+UShooterVisibilityBakeCommandlet::UShooterVisibilityBakeCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UShooterVisibilityBakeCommandlet::Main(const FString& Params)
+{
+	FString MapList;
+	if (!FParse::Value(*Params, TEXT("Map="), MapList, false))
+	{
+		UE_LOG(LogShooter, Error, TEXT("Usage: -run=ShooterVisibilityBake -Map=Sanctuary,Highrise [-CellSize=%.0f]"), ShooterVisibilityBake::DefaultCellSize);
+		return 1;
+	}
+
+	float CellSize = ShooterVisibilityBake::DefaultCellSize;
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+	CellSize = FMath::Max(CellSize, 50.0f);
+
+	TArray<FString> MapNames;
+	MapList.ParseIntoArray(MapNames, TEXT(","));
+
+	int32 NumFailed = 0;
+	for (const FString& MapName : MapNames)
+	{
+		if (!BakeMap(MapName.TrimStartAndEnd(), CellSize))
+		{
+			NumFailed++;
+		}
+	}
+
+	return NumFailed == 0 ? 0 : 1;
+}
+
+bool UShooterVisibilityBakeCommandlet::BakeMap(const FString& MapName, float CellSize)
+{
+	FString PackageName = MapName;
+	if (!FPackageName::IsValidLongPackageName(PackageName) && !FPackageName::SearchForPackageOnDisk(MapName, &PackageName))
+	{
+		UE_LOG(LogShooter, Error, TEXT("Can't find map %s"), *MapName);
+		return false;
+	}
+
+	UPackage* Package = LoadPackage(nullptr, *PackageName, LOAD_None);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (World == nullptr)
+	{
+		UE_LOG(LogShooter, Error, TEXT("Can't load map %s"), *PackageName);
+		return false;
+	}
+
+	World->WorldType = EWorldType::Editor;
+	World->AddToRoot();
+	GWorld = World;
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.AllowAudioPlayback(false)
+			.RequiresHitProxies(false)
+			.CreatePhysicsScene(true)
+			.CreateNavigation(true)
+			.CreateAISystem(false)
+			.ShouldSimulatePhysics(false)
+			.EnableTraceCollision(true)
+			.SetTransactional(false)
+			.CreateFXSystem(false));
+	}
+	World->UpdateWorldComponents(true, false);
+
+	// sublevels hold geometry too
+	for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+	{
+		StreamingLevel->SetShouldBeLoaded(true);
+		StreamingLevel->SetShouldBeVisible(true);
+	}
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+
+	const bool bBaked = BakeWorld(World, FShooterVisibilityMap::GetFilename(PackageName), CellSize);
+
+	World->CleanupWorld();
+	World->RemoveFromRoot();
+	GWorld = nullptr;
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+	return bBaked;
+}
+
+bool UShooterVisibilityBakeCommandlet::BakeWorld(UWorld* World, const FString& Filename, float CellSize)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// the grid covers the navigable part of the map, or the whole level without a navmesh
+	FBox Bounds(ForceInit);
+	for (TActorIterator<ANavMeshBoundsVolume> It(World); It; ++It)
+	{
+		Bounds += It->GetComponentsBoundingBox(true);
+	}
+	if (!Bounds.IsValid)
+	{
+		Bounds = ALevelBounds::CalculateLevelBounds(World->PersistentLevel);
+	}
+	if (!Bounds.IsValid)
+	{
+		UE_LOG(LogShooter, Error, TEXT("%s has no geometry to bake"), *World->GetName());
+		return false;
+	}
+	Bounds.Max.Z += ShooterVisibilityBake::MaxHeight;
+
+	const FVector Origin = Bounds.Min;
+	const FVector GridExtent = Bounds.GetSize() / CellSize;
+	const FIntVector Size(FMath::Max(FMath::CeilToInt(GridExtent.X), 1), FMath::Max(FMath::CeilToInt(GridExtent.Y), 1), FMath::Max(FMath::CeilToInt(GridExtent.Z), 1));
+	const int64 NumVoxels = (int64)Size.X * Size.Y * Size.Z;
+	if (NumVoxels > ShooterVisibilityBake::MaxVoxels)
+	{
+		UE_LOG(LogShooter, Error, TEXT("%s needs %lld cells of size %.0f, use a bigger -CellSize"), *World->GetName(), NumVoxels, CellSize);
+		return false;
+	}
+
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance() : nullptr;
+	if (NavData == nullptr)
+	{
+		UE_LOG(LogShooter, Warning, TEXT("%s has no navmesh, every walkable floor is baked"), *World->GetName());
+	}
+
+	// find the floors, every cell from a floor up to the top of a character standing on it is a baked cell
+	FCollisionQueryParams FloorParams(SCENE_QUERY_STAT(ShooterVisibilityBakeFloor), false);
+	FloorParams.MobilityType = EQueryMobilityType::Static;
+
+	TMap<int32, int32> CellsByVoxel;
+	TArray<FShooterBakeCell> Cells;
+	const float SampleSpacing = CellSize / ShooterVisibilityBake::FloorSamplesPerAxis;
+	for (int32 SampleX = 0; SampleX < Size.X * ShooterVisibilityBake::FloorSamplesPerAxis; SampleX++)
+	{
+		for (int32 SampleY = 0; SampleY < Size.Y * ShooterVisibilityBake::FloorSamplesPerAxis; SampleY++)
+		{
+			const int32 X = SampleX / ShooterVisibilityBake::FloorSamplesPerAxis;
+			const int32 Y = SampleY / ShooterVisibilityBake::FloorSamplesPerAxis;
+			FVector TraceStart(Origin.X + (SampleX + 0.5f) * SampleSpacing, Origin.Y + (SampleY + 0.5f) * SampleSpacing, Bounds.Max.Z);
+			const FVector TraceEnd(TraceStart.X, TraceStart.Y, Bounds.Min.Z);
+
+			for (int32 NumTraces = 0; NumTraces < ShooterVisibilityBake::MaxFloorTraces && TraceStart.Z > TraceEnd.Z; NumTraces++)
+			{
+				FHitResult Hit;
+				if (!World->LineTraceSingleByChannel(Hit, TraceStart, TraceEnd, ECC_Pawn, FloorParams))
+				{
+					break;
+				}
+				TraceStart.Z = Hit.ImpactPoint.Z - ShooterVisibilityBake::FloorSkip;
+
+				FNavLocation NavLocation;
+				if (Hit.bStartPenetrating || Hit.ImpactNormal.Z < ShooterVisibilityBake::WalkableFloorZ
+					|| (NavData && !NavData->ProjectPoint(Hit.ImpactPoint, NavLocation, FVector(SampleSpacing * 0.5f, SampleSpacing * 0.5f, ShooterVisibilityBake::FloorSkip))))
+				{
+					continue;
+				}
+
+				const float FloorZ = Hit.ImpactPoint.Z;
+				const int32 MinZ = FMath::Max(FMath::FloorToInt((FloorZ + ShooterVisibilityBake::MinHeight - Origin.Z) / CellSize), 0);
+				const int32 MaxZ = FMath::Min(FMath::FloorToInt((FloorZ + ShooterVisibilityBake::MaxHeight - Origin.Z) / CellSize), Size.Z - 1);
+				for (int32 Z = MinZ; Z <= MaxZ; Z++)
+				{
+					const int32 VoxelIndex = (Z * Size.Y + Y) * Size.X + X;
+					int32* CellIndex = CellsByVoxel.Find(VoxelIndex);
+					if (CellIndex == nullptr)
+					{
+						FShooterBakeCell& NewCell = Cells.AddDefaulted_GetRef();
+						NewCell.Center = Origin + (FVector(X, Y, Z) + 0.5f) * CellSize;
+						CellIndex = &CellsByVoxel.Add(VoxelIndex, Cells.Num() - 1);
+					}
+				}
+
+				// sample the whole height of a character standing here, from the feet to the top of the head
+				for (int32 HeightSample = 0; HeightSample < ShooterVisibilityBake::HeightSamples; HeightSample++)
+				{
+					const float SampleZ = FloorZ + FMath::Lerp(ShooterVisibilityBake::MinHeight, ShooterVisibilityBake::MaxHeight, (float)HeightSample / (ShooterVisibilityBake::HeightSamples - 1));
+					const int32 Z = FMath::Clamp(FMath::FloorToInt((SampleZ - Origin.Z) / CellSize), MinZ, MaxZ);
+					const int32* CellIndex = CellsByVoxel.Find((Z * Size.Y + Y) * Size.X + X);
+					if (CellIndex && Cells[*CellIndex].Samples.Num() < ShooterVisibilityBake::MaxCellSamples)
+					{
+						Cells[*CellIndex].Samples.Add(FVector(Hit.ImpactPoint.X, Hit.ImpactPoint.Y, SampleZ));
+					}
+				}
+			}
+		}
+	}
+
+	const int32 NumCells = Cells.Num();
+	if (NumCells == 0)
+	{
+		UE_LOG(LogShooter, Error, TEXT("%s has no cells to bake, is the navmesh built?"), *World->GetName());
+		return false;
+	}
+
+	// trace every pair of cells once, a cell only writes its own row
+	FCollisionQueryParams SightParams(SCENE_QUERY_STAT(ShooterVisibilityBakeSight), false);
+	SightParams.MobilityType = EQueryMobilityType::Static;
+
+	const int32 CellWords = FMath::DivideAndRoundUp(NumCells, 64);
+	const float AlwaysVisibleDistSq = FMath::Square(ShooterVisibilityBake::AlwaysVisibleCells * CellSize);
+	TArray<uint64> CellBits;
+	CellBits.SetNumZeroed(NumCells * CellWords);
+
+	ParallelFor(NumCells, [&](int32 CellA)
+	{
+		uint64* Row = &CellBits[CellA * CellWords];
+		for (int32 CellB = CellA; CellB < NumCells; CellB++)
+		{
+			bool bVisible = CellA == CellB || FVector::DistSquared(Cells[CellA].Center, Cells[CellB].Center) <= AlwaysVisibleDistSq;
+			for (int32 SampleA = 0; SampleA < Cells[CellA].Samples.Num() && !bVisible; SampleA++)
+			{
+				for (int32 SampleB = 0; SampleB < Cells[CellB].Samples.Num() && !bVisible; SampleB++)
+				{
+					const FVector& From = Cells[CellA].Samples[SampleA];
+					const FVector& To = Cells[CellB].Samples[SampleB];
+					bVisible = !World->LineTraceTestByChannel(From, To, ECC_Visibility, SightParams)
+						|| !World->LineTraceTestByChannel(From, To, COLLISION_WEAPON, SightParams);
+				}
+			}
+
+			if (bVisible)
+			{
+				Row[CellB / 64] |= (uint64)1 << (CellB % 64);
+			}
+		}
+	});
+
+	for (int32 CellA = 0; CellA < NumCells; CellA++)
+	{
+		for (int32 CellB = CellA + 1; CellB < NumCells; CellB++)
+		{
+			if (CellBits[CellA * CellWords + CellB / 64] & ((uint64)1 << (CellB % 64)))
+			{
+				CellBits[CellB * CellWords + CellA / 64] |= (uint64)1 << (CellA % 64);
+			}
+		}
+	}
+
+	// the samples don't cover every point in a cell (corners, doorway edges, windows), and runtime queries can come
+	// from anywhere in it. Keep the map conservative: A sees B if any neighbour of A sees any neighbour of B.
+	TArray<TArray<int32, TInlineAllocator<27>>> CellNeighbors;
+	CellNeighbors.SetNum(NumCells);
+	for (const TPair<int32, int32>& VoxelCell : CellsByVoxel)
+	{
+		const int32 X = VoxelCell.Key % Size.X;
+		const int32 Y = (VoxelCell.Key / Size.X) % Size.Y;
+		const int32 Z = VoxelCell.Key / (Size.X * Size.Y);
+		for (int32 NeighborZ = FMath::Max(Z - 1, 0); NeighborZ <= FMath::Min(Z + 1, Size.Z - 1); NeighborZ++)
+		{
+			for (int32 NeighborY = FMath::Max(Y - 1, 0); NeighborY <= FMath::Min(Y + 1, Size.Y - 1); NeighborY++)
+			{
+				for (int32 NeighborX = FMath::Max(X - 1, 0); NeighborX <= FMath::Min(X + 1, Size.X - 1); NeighborX++)
+				{
+					if (const int32* Neighbor = CellsByVoxel.Find((NeighborZ * Size.Y + NeighborY) * Size.X + NeighborX))
+					{
+						CellNeighbors[VoxelCell.Value].Add(*Neighbor);
+					}
+				}
+			}
+		}
+	}
+
+	// rows of the neighbours, then the transpose of that, then rows of the neighbours again (visibility is symmetric)
+	TArray<uint64> DilatedBits;
+	DilatedBits.SetNumZeroed(NumCells * CellWords);
+	for (int32 Pass = 0; Pass < 2; Pass++)
+	{
+		ParallelFor(NumCells, [&](int32 Cell)
+		{
+			uint64* Row = &DilatedBits[Cell * CellWords];
+			FMemory::Memzero(Row, CellWords * sizeof(uint64));
+			for (int32 Neighbor : CellNeighbors[Cell])
+			{
+				const uint64* NeighborRow = &CellBits[Neighbor * CellWords];
+				for (int32 Word = 0; Word < CellWords; Word++)
+				{
+					Row[Word] |= NeighborRow[Word];
+				}
+			}
+		});
+
+		if (Pass == 0)
+		{
+			FMemory::Memzero(CellBits.GetData(), CellBits.Num() * sizeof(uint64));
+			ParallelFor(NumCells, [&](int32 CellB)
+			{
+				uint64* Row = &CellBits[CellB * CellWords];
+				for (int32 CellA = 0; CellA < NumCells; CellA++)
+				{
+					if (DilatedBits[CellA * CellWords + CellB / 64] & ((uint64)1 << (CellB % 64)))
+					{
+						Row[CellA / 64] |= (uint64)1 << (CellA % 64);
+					}
+				}
+			});
+		}
+	}
+	CellBits = MoveTemp(DilatedBits);
+
+	int64 NumVisiblePairs = 0;
+	for (int32 CellA = 0; CellA < NumCells; CellA++)
+	{
+		for (int32 CellB = CellA + 1; CellB < NumCells; CellB++)
+		{
+			NumVisiblePairs += (CellBits[CellA * CellWords + CellB / 64] >> (CellB % 64)) & 1;
+		}
+	}
+
+	// cells seeing the same cells are also seen by the same cells, so they can share a row and a column
+	TArray<int32> CellClusters;
+	CellClusters.SetNumUninitialized(NumCells);
+	TArray<int32> ClusterCells;
+	TMultiMap<uint32, int32> ClustersByHash;
+	for (int32 Cell = 0; Cell < NumCells; Cell++)
+	{
+		const uint64* Row = &CellBits[Cell * CellWords];
+		const uint32 Hash = FCrc::MemCrc32(Row, CellWords * sizeof(uint64));
+
+		int32 Cluster = INDEX_NONE;
+		TArray<int32, TInlineAllocator<4>> Candidates;
+		ClustersByHash.MultiFind(Hash, Candidates);
+		for (int32 Candidate : Candidates)
+		{
+			if (FMemory::Memcmp(Row, &CellBits[ClusterCells[Candidate] * CellWords], CellWords * sizeof(uint64)) == 0)
+			{
+				Cluster = Candidate;
+				break;
+			}
+		}
+		if (Cluster == INDEX_NONE)
+		{
+			Cluster = ClusterCells.Add(Cell);
+			ClustersByHash.Add(Hash, Cluster);
+		}
+		CellClusters[Cell] = Cluster;
+	}
+
+	const int32 NumClusters = ClusterCells.Num();
+	const int32 ClusterWords = FMath::DivideAndRoundUp(NumClusters, 64);
+	TArray<uint64> ClusterBits;
+	ClusterBits.SetNumZeroed(NumClusters * ClusterWords);
+	for (int32 ClusterA = 0; ClusterA < NumClusters; ClusterA++)
+	{
+		const int32 CellA = ClusterCells[ClusterA];
+		for (int32 ClusterB = 0; ClusterB < NumClusters; ClusterB++)
+		{
+			const int32 CellB = ClusterCells[ClusterB];
+			if (CellBits[CellA * CellWords + CellB / 64] & ((uint64)1 << (CellB % 64)))
+			{
+				ClusterBits[ClusterA * ClusterWords + ClusterB / 64] |= (uint64)1 << (ClusterB % 64);
+			}
+		}
+	}
+
+	TArray<int32> VoxelClusters;
+	VoxelClusters.Init(INDEX_NONE, NumVoxels);
+	for (const TPair<int32, int32>& VoxelCell : CellsByVoxel)
+	{
+		VoxelClusters[VoxelCell.Key] = CellClusters[VoxelCell.Value];
+	}
+
+	if (!FShooterVisibilityMap::Save(Filename, Origin, CellSize, Size, NumCells, VoxelClusters, NumClusters, ClusterBits))
+	{
+		UE_LOG(LogShooter, Error, TEXT("Can't write %s"), *Filename);
+		return false;
+	}
+
+	const int64 NumPairs = (int64)NumCells * (NumCells - 1) / 2;
+	UE_LOG(LogShooter, Display, TEXT("Baked %s in %.1f s: %d x %d x %d grid, %d cells in %d clusters, %.1f%% of cell pairs visible, %lld KB (%lld KB unclustered)"),
+		*Filename, FPlatformTime::Seconds() - StartTime, Size.X, Size.Y, Size.Z, NumCells, NumClusters,
+		NumPairs > 0 ? 100.0 * NumVisiblePairs / NumPairs : 100.0, IFileManager::Get().FileSize(*Filename) / 1024, (int64)CellBits.Num() * sizeof(uint64) / 1024);
+	return true;
+}
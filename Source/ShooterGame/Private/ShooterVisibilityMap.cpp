@@ -0,0 +1,243 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterVisibilityMap.h"
+#include "Online/ShooterGameMode.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFilemanager.h"
+
+static int32 ShooterUseVisibilityMap = 1;
+FAutoConsoleVariableRef CVarShooterVisibilityMap(
+	TEXT("p.ShooterVisibilityMap"),
+	ShooterUseVisibilityMap,
+	TEXT("Skip bot line of sight traces between cells the baked visibility map says can't see each other.\n")
+	TEXT("0: Disable, 1: Enable"),
+	ECVF_Cheat);
+
+/** layout of a .pvs file: header, cluster per cell (int32), padding to 8 bytes, cluster rows (uint64) */
+struct FShooterVisibilityMapHeader
+{
+	/** 'SPVS' */
+	uint32 Magic;
+
+	/** bumped when the layout changes */
+	uint32 Version;
+
+	/** corner of the grid */
+	FVector Origin;
+
+	/** edge length of a cell */
+	float CellSize;
+
+	/** cells along each axis */
+	FIntVector Size;
+
+	/** baked cells */
+	int32 NumCells;
+
+	/** cells with the same visibility share a cluster */
+	int32 NumClusters;
+
+	/** uint64s per cluster row */
+	int32 ClusterWords;
+};
+
+static_assert(sizeof(FShooterVisibilityMapHeader) == 48, "visibility map header layout changed, bump ShooterVisibilityMap::Version");
+
+namespace ShooterVisibilityMap
+{
+	const uint32 Magic = 0x53505653;
+	const uint32 Version = 2;
+
+	int64 GetClustersOffset()
+	{
+		return sizeof(FShooterVisibilityMapHeader);
+	}
+
+	int64 GetBitsOffset(const FIntVector& Size)
+	{
+		return Align(GetClustersOffset() + (int64)Size.X * Size.Y * Size.Z * sizeof(int32), sizeof(uint64));
+	}
+}
+
+FShooterVisibilityMap::FShooterVisibilityMap()
+	: Header(nullptr)
+	, VoxelClusters(nullptr)
+	, ClusterBits(nullptr)
+	, DataSize(0)
+{
+}
+
+FShooterVisibilityMap::~FShooterVisibilityMap()
+{
+	// the region has to go before the file it maps
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+FString FShooterVisibilityMap::GetFilename(const FString& MapName)
+{
+	return FPaths::ProjectContentDir() / TEXT("Visibility") / FPackageName::GetShortName(MapName) + TEXT(".pvs");
+}
+
+TSharedPtr<FShooterVisibilityMap> FShooterVisibilityMap::LoadForMap(const FString& MapName)
+{
+	const FString Filename = GetFilename(MapName);
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.FileExists(*Filename))
+	{
+		UE_LOG(LogShooter, Log, TEXT("No visibility map for %s, line of sight is traced"), *MapName);
+		return nullptr;
+	}
+
+	TSharedPtr<FShooterVisibilityMap> VisibilityMap = MakeShareable(new FShooterVisibilityMap());
+
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+	VisibilityMap->MappedFile.Reset(PlatformFile.OpenMapped(*Filename));
+	if (VisibilityMap->MappedFile.IsValid())
+	{
+		VisibilityMap->MappedRegion.Reset(VisibilityMap->MappedFile->MapRegion());
+	}
+	if (VisibilityMap->MappedRegion.IsValid())
+	{
+		Data = VisibilityMap->MappedRegion->GetMappedPtr();
+		DataSize = VisibilityMap->MappedRegion->GetMappedSize();
+	}
+	else if (FFileHelper::LoadFileToArray(VisibilityMap->FileData, *Filename))
+	{
+		Data = VisibilityMap->FileData.GetData();
+		DataSize = VisibilityMap->FileData.Num();
+	}
+
+	if (!VisibilityMap->Initialize(Data, DataSize))
+	{
+		UE_LOG(LogShooter, Warning, TEXT("%s is not a valid visibility map, rebake it with -run=ShooterVisibilityBake"), *Filename);
+		return nullptr;
+	}
+
+	UE_LOG(LogShooter, Log, TEXT("Loaded visibility map for %s: %d cells in %d clusters, %lld KB %s"),
+		*MapName, VisibilityMap->Header->NumCells, VisibilityMap->Header->NumClusters, VisibilityMap->GetDataSize() / 1024,
+		VisibilityMap->MappedRegion.IsValid() ? TEXT("memory mapped") : TEXT("in memory"));
+	return VisibilityMap;
+}
+
+bool FShooterVisibilityMap::Initialize(const uint8* Data, int64 InDataSize)
+{
+	if (Data == nullptr || InDataSize < (int64)sizeof(FShooterVisibilityMapHeader))
+	{
+		return false;
+	}
+
+	const FShooterVisibilityMapHeader* FileHeader = (const FShooterVisibilityMapHeader*)Data;
+	if (FileHeader->Magic != ShooterVisibilityMap::Magic || FileHeader->Version != ShooterVisibilityMap::Version
+		|| FileHeader->CellSize <= 0.0f || FileHeader->Size.GetMin() <= 0 || FileHeader->NumClusters < 0
+		|| FileHeader->ClusterWords != FMath::DivideAndRoundUp(FileHeader->NumClusters, 64))
+	{
+		return false;
+	}
+
+	const int64 NumVoxels = (int64)FileHeader->Size.X * FileHeader->Size.Y * FileHeader->Size.Z;
+	const int64 BitsOffset = ShooterVisibilityMap::GetBitsOffset(FileHeader->Size);
+	if (InDataSize != BitsOffset + (int64)FileHeader->NumClusters * FileHeader->ClusterWords * sizeof(uint64))
+	{
+		return false;
+	}
+
+	const int32* FileClusters = (const int32*)(Data + ShooterVisibilityMap::GetClustersOffset());
+	for (int64 VoxelIndex = 0; VoxelIndex < NumVoxels; VoxelIndex++)
+	{
+		if (FileClusters[VoxelIndex] < INDEX_NONE || FileClusters[VoxelIndex] >= FileHeader->NumClusters)
+		{
+			return false;
+		}
+	}
+
+	Header = FileHeader;
+	VoxelClusters = FileClusters;
+	ClusterBits = (const uint64*)(Data + BitsOffset);
+	DataSize = InDataSize;
+	return true;
+}
+
+bool FShooterVisibilityMap::Save(const FString& Filename, const FVector& Origin, float CellSize, const FIntVector& Size, int32 NumCells, const TArray<int32>& InVoxelClusters, int32 NumClusters, const TArray<uint64>& InClusterBits)
+{
+	FShooterVisibilityMapHeader FileHeader;
+	FMemory::Memzero(FileHeader);
+	FileHeader.Magic = ShooterVisibilityMap::Magic;
+	FileHeader.Version = ShooterVisibilityMap::Version;
+	FileHeader.Origin = Origin;
+	FileHeader.CellSize = CellSize;
+	FileHeader.Size = Size;
+	FileHeader.NumCells = NumCells;
+	FileHeader.NumClusters = NumClusters;
+	FileHeader.ClusterWords = FMath::DivideAndRoundUp(NumClusters, 64);
+
+	check(InVoxelClusters.Num() == Size.X * Size.Y * Size.Z);
+	check(InClusterBits.Num() == NumClusters * FileHeader.ClusterWords);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	Writer->Serialize(&FileHeader, sizeof(FileHeader));
+	Writer->Serialize((void*)InVoxelClusters.GetData(), InVoxelClusters.Num() * sizeof(int32));
+
+	uint8 Padding[sizeof(uint64)] = { 0 };
+	Writer->Serialize(Padding, ShooterVisibilityMap::GetBitsOffset(Size) - Writer->Tell());
+	Writer->Serialize((void*)InClusterBits.GetData(), InClusterBits.Num() * sizeof(uint64));
+
+	return Writer->Close() && !Writer->IsError();
+}
+
+bool FShooterVisibilityMap::MayBeVisible(const UWorld* World, const FVector& From, const FVector& To)
+{
+	if (ShooterUseVisibilityMap == 0 || World == nullptr)
+	{
+		return true;
+	}
+
+	const AShooterGameMode* GameMode = World->GetAuthGameMode<AShooterGameMode>();
+	const FShooterVisibilityMap* VisibilityMap = GameMode ? GameMode->GetVisibilityMap() : nullptr;
+	if (VisibilityMap == nullptr || VisibilityMap->IsPotentiallyVisible(From, To))
+	{
+		return true;
+	}
+
+	SHOOTER_INC_COUNTER(TracesSkipped);
+	return false;
+}
+
+bool FShooterVisibilityMap::IsPotentiallyVisible(const FVector& From, const FVector& To) const
+{
+	const int32 FromCluster = FindCluster(From);
+	const int32 ToCluster = FindCluster(To);
+	if (FromCluster == INDEX_NONE || ToCluster == INDEX_NONE)
+	{
+		return true;
+	}
+
+	const uint64 Word = ClusterBits[(int64)FromCluster * Header->ClusterWords + ToCluster / 64];
+	return (Word & ((uint64)1 << (ToCluster % 64))) != 0;
+}
+
+int32 FShooterVisibilityMap::FindCluster(const FVector& Location) const
+{
+	const FVector GridLocation = (Location - Header->Origin) / Header->CellSize;
+	const int32 X = FMath::FloorToInt(GridLocation.X);
+	const int32 Y = FMath::FloorToInt(GridLocation.Y);
+	const int32 Z = FMath::FloorToInt(GridLocation.Z);
+	if (X < 0 || Y < 0 || Z < 0 || X >= Header->Size.X || Y >= Header->Size.Y || Z >= Header->Size.Z)
+	{
+		return INDEX_NONE;
+	}
+
+	return VoxelClusters[((int64)Z * Header->Size.Y + Y) * Header->Size.X + X];
+}
+
+int64 FShooterVisibilityMap::GetDataSize() const
+{
+	return DataSize;
+}
@@ -0,0 +1,76 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FShooterVisibilityMapHeader;
+
+/**
+ * Precomputed cell to cell visibility of a map, baked by the ShooterVisibilityBake commandlet.
+ *
+ * The map is cut into cubic cells, and every cell a standing character can occupy is assigned a visibility cluster:
+ * cells seeing exactly the same set of cells share one. A lookup is a grid index and a bit test in the cluster
+ * matrix, so line of sight queries between cells that can't see each other are rejected before any trace runs.
+ * Locations outside baked cells (jumping, spectators) are unknown and never rejected.
+ *
+ * Files live in Content/Visibility/<Map>.pvs, staged outside of the pak so they can be memory mapped.
+ */
+class FShooterVisibilityMap
+{
+public:
+
+	~FShooterVisibilityMap();
+
+	/** load the baked visibility of a map, null if it wasn't baked */
+	static TSharedPtr<FShooterVisibilityMap> LoadForMap(const FString& MapName);
+
+	/** baked file of a map */
+	static FString GetFilename(const FString& MapName);
+
+	/** write a baked visibility map, VoxelClusters holds one cluster per cell (INDEX_NONE for none), ClusterBits one row of bits per cluster */
+	static bool Save(const FString& Filename, const FVector& Origin, float CellSize, const FIntVector& Size, int32 NumCells, const TArray<int32>& VoxelClusters, int32 NumClusters, const TArray<uint64>& ClusterBits);
+
+	/**
+	 * Could there be line of sight between From and To in World? False only if the visibility map of the world's
+	 * game mode says so, the caller should then skip its trace.
+	 */
+	static bool MayBeVisible(const UWorld* World, const FVector& From, const FVector& To);
+
+	/** false if the cells of From and To can't see each other */
+	bool IsPotentiallyVisible(const FVector& From, const FVector& To) const;
+
+	/** bytes used by the visibility data */
+	int64 GetDataSize() const;
+
+private:
+
+	FShooterVisibilityMap();
+
+	/** point into the file contents, false if they aren't a valid visibility map */
+	bool Initialize(const uint8* Data, int64 DataSize);
+
+	/** cluster of the cell containing Location, INDEX_NONE if it isn't a baked cell */
+	int32 FindCluster(const FVector& Location) const;
+
+	/** file handle, if the file could be memory mapped */
+	TUniquePtr<IMappedFileHandle> MappedFile;
+
+	/** the mapped file contents */
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+
+	/** file contents, if the file couldn't be memory mapped */
+	TArray<uint8> FileData;
+
+	/** file header */
+	const FShooterVisibilityMapHeader* Header;
+
+	/** cluster of every cell in the grid */
+	const int32* VoxelClusters;
+
+	/** visibility bits, one row per cluster */
+	const uint64* ClusterBits;
+
+	/** size of the file contents */
+	int64 DataSize;
+};
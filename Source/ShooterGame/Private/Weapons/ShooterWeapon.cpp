@@ -5,8 +5,11 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Bots/ShooterAIController.h"
 #include "Online/ShooterPlayerState.h"
-#include "UI/ShooterHUD.h"
+#include "ShooterGameUIInterface.h"
+#include "Player/ShooterDemoSpectator.h"
+#include "Player/ShooterHitboxComponent.h"
 #include "MatineeCameraShake.h"
+#include "ShooterAssetManager.h"
 
 AShooterWeapon::AShooterWeapon(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -72,6 +75,20 @@ void AShooterWeapon::Destroyed()
 	StopSimulatingWeaponFire();
 }
 
+FPrimaryAssetId AShooterWeapon::GetPrimaryAssetId() const
+{
+	return UShooterAssetManager::GetBlueprintPrimaryAssetId(this, UShooterAssetManager::WeaponType);
+}
+
+#if WITH_EDITOR
+void AShooterWeapon::PreSave(const ITargetPlatform* TargetPlatform)
+{
+	Super::PreSave(TargetPlatform);
+
+	UShooterAssetManager::UpdateAssetBundleData(this, AssetBundleData);
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Inventory
 
@@ -114,6 +131,8 @@ void AShooterWeapon::OnEquipFinished()
 	bIsEquipped = true;
 	bPendingEquip = false;
 
+	UpdateHUDViewModel();
+
 	// Determine the state so that the can reload checks will work
 	DetermineWeaponState(); 
 	
@@ -175,6 +194,44 @@ void AShooterWeapon::OnLeaveInventory()
 	}
 }
 
+void AShooterWeapon::OnStored()
+{
+	// OnLeaveInventory cleared MyPawn this frame, going dormant right away could keep that from ever being sent:
+	// send it now and wait a net update before clients keep the hidden weapon around
+	ForceNetUpdate();
+	GetWorldTimerManager().SetTimer(TimerHandle_OnStoredReplicated, this, &AShooterWeapon::OnStoredReplicated, 1.0f / FMath::Max(NetUpdateFrequency, 1.0f), false);
+}
+
+void AShooterWeapon::OnStoredReplicated()
+{
+	// it only has to be sent again when it changes on reuse
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void AShooterWeapon::ResetForReuse()
+{
+	// also cancels going dormant if the weapon is reused within a net update
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	SetNetDormancy(DORM_Awake);
+
+	bWantsToFire = false;
+	bPendingReload = false;
+	bPendingEquip = false;
+	bIsEquipped = false;
+	bRefiring = false;
+	CurrentState = EWeaponState::Idle;
+	BurstCounter = 0;
+
+	// same ammo as a freshly spawned weapon, see PostInitializeComponents
+	CurrentAmmoInClip = 0;
+	CurrentAmmo = 0;
+	if (WeaponConfig.InitialClips > 0)
+	{
+		CurrentAmmoInClip = WeaponConfig.AmmoPerClip;
+		CurrentAmmo = WeaponConfig.AmmoPerClip * WeaponConfig.InitialClips;
+	}
+}
+
 void AShooterWeapon::AttachMeshToPawn()
 {
 	if (MyPawn)
@@ -358,6 +415,8 @@ void AShooterWeapon::GiveAmmo(int AddAmount)
 	AddAmount = FMath::Min(AddAmount, MissingAmmo);
 	CurrentAmmo += AddAmount;
 
+	UpdateHUDViewModel();
+
 	AShooterAIController* BotAI = MyPawn ? Cast<AShooterAIController>(MyPawn->GetController()) : NULL;
 	if (BotAI)
 	{
@@ -385,6 +444,8 @@ void AShooterWeapon::UseAmmo()
 		CurrentAmmo--;
 	}
 
+	UpdateHUDViewModel();
+
 	AShooterAIController* BotAI = MyPawn ? Cast<AShooterAIController>(MyPawn->GetController()) : NULL;	
 	AShooterPlayerController* PlayerController = MyPawn ? Cast<AShooterPlayerController>(MyPawn->GetController()) : NULL;
 	if (BotAI)
@@ -409,12 +470,16 @@ void AShooterWeapon::UseAmmo()
 
 void AShooterWeapon::HandleFiring()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(HandleFiring);
+
 	if ((CurrentAmmoInClip > 0 || HasInfiniteClip() || HasInfiniteAmmo()) && CanFire())
 	{
+#if SHOOTER_WITH_COSMETICS
 		if (GetNetMode() != NM_DedicatedServer)
 		{
 			SimulateWeaponFire();
 		}
+#endif
 
 		if (MyPawn && MyPawn->IsLocallyControlled())
 		{
@@ -513,6 +578,8 @@ void AShooterWeapon::ReloadWeapon()
 	{
 		CurrentAmmo = FMath::Max(CurrentAmmoInClip, CurrentAmmo);
 	}
+
+	UpdateHUDViewModel();
 }
 
 void AShooterWeapon::SetWeaponState(EWeaponState::Type NewState)
@@ -583,10 +650,12 @@ void AShooterWeapon::OnBurstFinished()
 	BurstCounter = 0;
 
 	// stop firing FX locally, unless it's a dedicated server
+#if SHOOTER_WITH_COSMETICS
 	if (GetNetMode() != NM_DedicatedServer)
 	{
 		StopSimulatingWeaponFire();
 	}
+#endif
 	
 	GetWorldTimerManager().ClearTimer(TimerHandle_HandleFiring);
 	bRefiring = false;
@@ -596,13 +665,19 @@ void AShooterWeapon::OnBurstFinished()
 //////////////////////////////////////////////////////////////////////////
 // Weapon usage helpers
 
-UAudioComponent* AShooterWeapon::PlayWeaponSound(USoundCue* Sound)
+UAudioComponent* AShooterWeapon::PlayWeaponSound(const TSoftObjectPtr<USoundCue>& Sound)
 {
 	UAudioComponent* AC = NULL;
-	if (Sound && MyPawn)
+#if SHOOTER_WITH_COSMETICS
+	if (!Sound.IsNull() && MyPawn && !AShooterDemoSpectator::IsFastPlayback(GetWorld()))
 	{
-		AC = UGameplayStatics::SpawnSoundAttached(Sound, MyPawn->GetRootComponent());
+		USoundCue* const LoadedSound = UShooterAssetManager::GetClientAsset(Sound);
+		if (LoadedSound)
+		{
+			AC = UGameplayStatics::SpawnSoundAttached(LoadedSound, MyPawn->GetRootComponent());
+		}
 	}
+#endif
 
 	return AC;
 }
@@ -727,6 +802,11 @@ FHitResult AShooterWeapon::WeaponTrace(const FVector& StartTrace, const FVector&
 
 	FHitResult Hit(ForceInit);
 	GetWorld()->LineTraceSingleByChannel(Hit, StartTrace, EndTrace, COLLISION_WEAPON, TraceParams);
+	SHOOTER_INC_COUNTER(Traces);
+
+#if !UE_BUILD_SHIPPING
+	UShooterHitboxComponent::CompareWithMeshTrace(GetWorld(), GetInstigator(), StartTrace, EndTrace, Hit);
+#endif
 
 	return Hit;
 }
@@ -781,14 +861,31 @@ void AShooterWeapon::OnRep_Reload()
 	}
 }
 
+void AShooterWeapon::OnRep_Ammo()
+{
+	UpdateHUDViewModel();
+}
+
+void AShooterWeapon::UpdateHUDViewModel()
+{
+	AShooterPlayerController* PC = MyPawn ? Cast<AShooterPlayerController>(MyPawn->Controller) : NULL;
+	IShooterPlayerUI* PlayerUI = PC ? PC->GetPlayerUI() : nullptr;
+	if (PlayerUI)
+	{
+		PlayerUI->UpdateWeapon(this);
+	}
+}
+
 void AShooterWeapon::SimulateWeaponFire()
 {
+#if SHOOTER_WITH_COSMETICS
 	if (GetLocalRole() == ROLE_Authority && CurrentState != EWeaponState::Firing)
 	{
 		return;
 	}
 
-	if (MuzzleFX)
+	UParticleSystem* const LoadedMuzzleFX = UShooterAssetManager::GetClientAsset(MuzzleFX);
+	if (LoadedMuzzleFX)
 	{
 		USkeletalMeshComponent* UseWeaponMesh = GetWeaponMesh();
 		if (!bLoopedMuzzleFX || MuzzlePSC == NULL)
@@ -800,19 +897,19 @@ void AShooterWeapon::SimulateWeaponFire()
 				if( PlayerCon != NULL )
 				{
 					Mesh1P->GetSocketLocation(MuzzleAttachPoint);
-					MuzzlePSC = UGameplayStatics::SpawnEmitterAttached(MuzzleFX, Mesh1P, MuzzleAttachPoint);
+					MuzzlePSC = UGameplayStatics::SpawnEmitterAttached(LoadedMuzzleFX, Mesh1P, MuzzleAttachPoint);
 					MuzzlePSC->bOwnerNoSee = false;
 					MuzzlePSC->bOnlyOwnerSee = true;
 
 					Mesh3P->GetSocketLocation(MuzzleAttachPoint);
-					MuzzlePSCSecondary = UGameplayStatics::SpawnEmitterAttached(MuzzleFX, Mesh3P, MuzzleAttachPoint);
+					MuzzlePSCSecondary = UGameplayStatics::SpawnEmitterAttached(LoadedMuzzleFX, Mesh3P, MuzzleAttachPoint);
 					MuzzlePSCSecondary->bOwnerNoSee = true;
 					MuzzlePSCSecondary->bOnlyOwnerSee = false;				
 				}				
 			}
 			else
 			{
-				MuzzlePSC = UGameplayStatics::SpawnEmitterAttached(MuzzleFX, UseWeaponMesh, MuzzleAttachPoint);
+				MuzzlePSC = UGameplayStatics::SpawnEmitterAttached(LoadedMuzzleFX, UseWeaponMesh, MuzzleAttachPoint);
 			}
 		}
 	}
@@ -842,19 +939,22 @@ void AShooterWeapon::SimulateWeaponFire()
 		{
 			PC->ClientStartCameraShake(FireCameraShake, 1);
 		}
-		if (FireForceFeedback != NULL && PC->IsVibrationEnabled())
+		UForceFeedbackEffect* const LoadedForceFeedback = PC->IsVibrationEnabled() ? UShooterAssetManager::GetClientAsset(FireForceFeedback) : NULL;
+		if (LoadedForceFeedback != NULL)
 		{
 			FForceFeedbackParameters FFParams;
 			FFParams.bLooping = false;
 			FFParams.bPlayWhilePaused = false;
 			FFParams.Tag = "Weapon";
-			PC->ClientPlayForceFeedback(FireForceFeedback, FFParams);
+			PC->ClientPlayForceFeedback(LoadedForceFeedback, FFParams);
 		}
 	}
+#endif
 }
 
 void AShooterWeapon::StopSimulatingWeaponFire()
 {
+#if SHOOTER_WITH_COSMETICS
 	if (bLoopedMuzzleFX )
 	{
 		if( MuzzlePSC != NULL )
@@ -882,6 +982,18 @@ void AShooterWeapon::StopSimulatingWeaponFire()
 
 		PlayWeaponSound(FireFinishSound);
 	}
+#endif
+}
+
+bool AShooterWeapon::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	const bool bProcessed = Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+	if (bProcessed)
+	{
+		SHOOTER_INC_COUNTER(RPCsSent);
+	}
+
+	return bProcessed;
 }
 
 void AShooterWeapon::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
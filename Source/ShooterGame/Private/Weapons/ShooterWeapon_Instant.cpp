@@ -4,6 +4,9 @@
 #include "Weapons/ShooterWeapon_Instant.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Effects/ShooterImpactEffect.h"
+#include "Online/ShooterPlayerState.h"
+#include "Player/ShooterDemoSpectator.h"
+#include "ShooterAssetManager.h"
 
 AShooterWeapon_Instant::AShooterWeapon_Instant(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -15,6 +18,8 @@ AShooterWeapon_Instant::AShooterWeapon_Instant(const FObjectInitializer& ObjectI
 
 void AShooterWeapon_Instant::FireWeapon()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(FireWeapon);
+
 	const int32 RandomSeed = FMath::Rand();
 	FRandomStream WeaponRandomStream(RandomSeed);
 	const float CurrentSpread = GetCurrentSpread();
@@ -38,6 +43,8 @@ bool AShooterWeapon_Instant::ServerNotifyHit_Validate(const FHitResult& Impact,
 
 void AShooterWeapon_Instant::ServerNotifyHit_Implementation(const FHitResult& Impact, FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread)
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(ServerNotifyHit);
+
 	const float WeaponAngleDot = FMath::Abs(FMath::Sin(ReticleSpread * PI / 180.f));
 
 	// if we have an instigator, calculate dot between the view and the shot
@@ -87,26 +94,59 @@ void AShooterWeapon_Instant::ServerNotifyHit_Implementation(const FHitResult& Im
 						FMath::Abs(Impact.Location.X - BoxCenter.X) < BoxExtent.X &&
 						FMath::Abs(Impact.Location.Y - BoxCenter.Y) < BoxExtent.Y)
 					{
+						RecordHitReport(Impact.GetActor(), true);
 						ProcessInstantHit_Confirmed(Impact, Origin, ShootDir, RandomSeed, ReticleSpread);
 					}
 					else
 					{
+						RecordHitReport(Impact.GetActor(), false);
 						UE_LOG(LogShooterWeapon, Log, TEXT("%s Rejected client side hit of %s (outside bounding box tolerance)"), *GetNameSafe(this), *GetNameSafe(Impact.GetActor()));
 					}
 				}
 			}
+			else
+			{
+				// weapon stopped firing on the server before the report arrived
+				RecordHitReport(Impact.GetActor(), false);
+			}
 		}
 		else if (ViewDotHitDir <= InstantConfig.AllowedViewDotHitDir)
 		{
+			RecordHitReport(Impact.GetActor(), false);
 			UE_LOG(LogShooterWeapon, Log, TEXT("%s Rejected client side hit of %s (facing too far from the hit direction)"), *GetNameSafe(this), *GetNameSafe(Impact.GetActor()));
 		}
 		else
 		{
+			RecordHitReport(Impact.GetActor(), false);
 			UE_LOG(LogShooterWeapon, Log, TEXT("%s Rejected client side hit of %s"), *GetNameSafe(this), *GetNameSafe(Impact.GetActor()));
 		}
 	}
 }
 
+void AShooterWeapon_Instant::RecordHitReport(const AActor* HitActor, bool bConfirmed)
+{
+	// world geometry and props are accepted as reported, only shots at pawns say anything about hit registration
+	if (Cast<APawn>(HitActor) == NULL)
+	{
+		return;
+	}
+
+	AShooterPlayerState* InstigatorPlayerState = GetInstigator() ? Cast<AShooterPlayerState>(GetInstigator()->GetPlayerState()) : NULL;
+	if (InstigatorPlayerState)
+	{
+		InstigatorPlayerState->AddHitReport(bConfirmed);
+	}
+}
+
+void AShooterWeapon_Instant::RecordMissReport()
+{
+	AShooterPlayerState* InstigatorPlayerState = GetInstigator() ? Cast<AShooterPlayerState>(GetInstigator()->GetPlayerState()) : NULL;
+	if (InstigatorPlayerState)
+	{
+		InstigatorPlayerState->AddMissReport();
+	}
+}
+
 bool AShooterWeapon_Instant::ServerNotifyMiss_Validate(FVector_NetQuantizeNormal ShootDir, int32 RandomSeed, float ReticleSpread)
 {
 	return true;
@@ -116,21 +156,36 @@ void AShooterWeapon_Instant::ServerNotifyMiss_Implementation(FVector_NetQuantize
 {
 	const FVector Origin = GetMuzzleLocation();
 
+	RecordMissReport();
+
 	// play FX on remote clients
 	HitNotify.Origin = Origin;
 	HitNotify.RandomSeed = RandomSeed;
 	HitNotify.ReticleSpread = ReticleSpread;
 
 	// play FX locally
+#if SHOOTER_WITH_COSMETICS
 	if (GetNetMode() != NM_DedicatedServer)
 	{
 		const FVector EndTrace = Origin + ShootDir * InstantConfig.WeaponRange;
 		SpawnTrailEffect(EndTrace);
 	}
+#endif
 }
 
 void AShooterWeapon_Instant::ProcessInstantHit(const FHitResult& Impact, const FVector& Origin, const FVector& ShootDir, int32 RandomSeed, float ReticleSpread)
 {
+	// counted where the shot was fired, like AddBulletsFired, so the local match history gets accuracy on clients too
+	APlayerController* PlayerController = MyPawn ? Cast<APlayerController>(MyPawn->GetController()) : NULL;
+	if (PlayerController && PlayerController->IsLocalController() && Cast<APawn>(Impact.GetActor()))
+	{
+		AShooterPlayerState* PlayerState = Cast<AShooterPlayerState>(PlayerController->PlayerState);
+		if (PlayerState)
+		{
+			PlayerState->AddBulletHits(1);
+		}
+	}
+
 	if (MyPawn && MyPawn->IsLocallyControlled() && GetNetMode() == NM_Client)
 	{
 		// if we're a client and we've hit something that is being controlled by the server
@@ -175,6 +230,7 @@ void AShooterWeapon_Instant::ProcessInstantHit_Confirmed(const FHitResult& Impac
 	}
 
 	// play FX locally
+#if SHOOTER_WITH_COSMETICS
 	if (GetNetMode() != NM_DedicatedServer)
 	{
 		const FVector EndTrace = Origin + ShootDir * InstantConfig.WeaponRange;
@@ -183,6 +239,7 @@ void AShooterWeapon_Instant::ProcessInstantHit_Confirmed(const FHitResult& Impac
 		SpawnTrailEffect(EndPoint);
 		SpawnImpactEffects(Impact);
 	}
+#endif
 }
 
 bool AShooterWeapon_Instant::ShouldDealDamage(AActor* TestActor) const
@@ -277,7 +334,8 @@ void AShooterWeapon_Instant::SimulateInstantHit(const FVector& ShotOrigin, int32
 
 void AShooterWeapon_Instant::SpawnImpactEffects(const FHitResult& Impact)
 {
-	if (ImpactTemplate && Impact.bBlockingHit)
+#if SHOOTER_WITH_COSMETICS
+	if (ImpactTemplate && Impact.bBlockingHit && !AShooterDemoSpectator::ShouldSkipCosmeticEffect(GetWorld()))
 	{
 		FHitResult UseImpact = Impact;
 
@@ -298,20 +356,23 @@ void AShooterWeapon_Instant::SpawnImpactEffects(const FHitResult& Impact)
 			UGameplayStatics::FinishSpawningActor(EffectActor, SpawnTransform);
 		}
 	}
+#endif
 }
 
 void AShooterWeapon_Instant::SpawnTrailEffect(const FVector& EndPoint)
 {
-	if (TrailFX)
+#if SHOOTER_WITH_COSMETICS
+	if (!TrailFX.IsNull() && !AShooterDemoSpectator::ShouldSkipCosmeticEffect(GetWorld()))
 	{
 		const FVector Origin = GetMuzzleLocation();
 
-		UParticleSystemComponent* TrailPSC = UGameplayStatics::SpawnEmitterAtLocation(this, TrailFX, Origin);
+		UParticleSystemComponent* TrailPSC = UGameplayStatics::SpawnEmitterAtLocation(this, UShooterAssetManager::GetClientAsset(TrailFX), Origin);
 		if (TrailPSC)
 		{
 			TrailPSC->SetVectorParameter(TrailTargetParam, EndPoint);
 		}
 	}
+#endif
 }
 
 void AShooterWeapon_Instant::GetLifetimeReplicatedProps( TArray< FLifetimeProperty > & OutLifetimeProps ) const
@@ -13,6 +13,8 @@ AShooterWeapon_Projectile::AShooterWeapon_Projectile(const FObjectInitializer& O
 
 void AShooterWeapon_Projectile::FireWeapon()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(FireWeapon);
+
 	FVector ShootDir = GetAdjustedAim();
 	FVector Origin = GetMuzzleLocation();
 
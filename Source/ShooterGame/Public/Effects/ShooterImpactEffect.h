@@ -15,76 +15,76 @@ class AShooterImpactEffect : public AActor
 	GENERATED_UCLASS_BODY()
 
 	/** default impact FX used when material specific override doesn't exist */
-	UPROPERTY(EditDefaultsOnly, Category=Defaults)
-	UParticleSystem* DefaultFX;
+	UPROPERTY(EditDefaultsOnly, Category=Defaults, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> DefaultFX;
 
 	/** impact FX on concrete */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* ConcreteFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> ConcreteFX;
 
 	/** impact FX on dirt */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* DirtFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> DirtFX;
 
 	/** impact FX on water */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* WaterFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> WaterFX;
 
 	/** impact FX on metal */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* MetalFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> MetalFX;
 
 	/** impact FX on wood */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* WoodFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> WoodFX;
 
 	/** impact FX on glass */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* GlassFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> GlassFX;
 
 	/** impact FX on grass */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* GrassFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> GrassFX;
 
 	/** impact FX on flesh */
-	UPROPERTY(EditDefaultsOnly, Category=Visual)
-	UParticleSystem* FleshFX;
+	UPROPERTY(EditDefaultsOnly, Category=Visual, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> FleshFX;
 
 	/** default impact sound used when material specific override doesn't exist */
-	UPROPERTY(EditDefaultsOnly, Category=Defaults)
-	USoundCue* DefaultSound;
+	UPROPERTY(EditDefaultsOnly, Category=Defaults, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> DefaultSound;
 
 	/** impact FX on concrete */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* ConcreteSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> ConcreteSound;
 
 	/** impact FX on dirt */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* DirtSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> DirtSound;
 
 	/** impact FX on water */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* WaterSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> WaterSound;
 
 	/** impact FX on metal */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* MetalSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> MetalSound;
 
 	/** impact FX on wood */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* WoodSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> WoodSound;
 
 	/** impact FX on glass */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* GlassSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> GlassSound;
 
 	/** impact FX on grass */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* GrassSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> GrassSound;
 
 	/** impact FX on flesh */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* FleshSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> FleshSound;
 
 	/** default decal when material specific override doesn't exist */
 	UPROPERTY(EditDefaultsOnly, Category=Defaults)
@@ -94,9 +94,23 @@ class AShooterImpactEffect : public AActor
 	UPROPERTY(BlueprintReadOnly, Category=Surface)
 	FHitResult SurfaceHit;
 
+#if WITH_EDITORONLY_DATA
+	/** bundles of the soft references, saved to the asset registry so cooked builds can stream them */
+	UPROPERTY(AssetRegistrySearchable)
+	FAssetBundleData AssetBundleData;
+#endif
+
 	/** spawn effect */
 	virtual void PostInitializeComponents() override;
 
+	/** impact effect blueprints are ShooterImpactEffect primary assets */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+#if WITH_EDITOR
+	/** collect the bundles of the soft references */
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+#endif
+
 protected:
 
 	/** get FX for material type */
@@ -3,15 +3,19 @@
 #pragma once
 
 #include "Interfaces/OnlineIdentityInterface.h"
+#include "ShooterTypes.h"
 #include "ShooterGameMode.generated.h"
 
 class AShooterAIController;
 class AShooterPlayerState;
 class AShooterPickup;
 class FUniqueNetId;
+class FShooterBotMatchSimulator;
+class FShooterLoadTestRecorder;
+class FShooterVisibilityMap;
 
 UCLASS(config=Game)
-class AShooterGameMode : public AGameMode
+class SHOOTERGAME_API AShooterGameMode : public AGameMode
 {
 	GENERATED_UCLASS_BODY()	
 
@@ -57,13 +61,19 @@ class AShooterGameMode : public AGameMode
 	/** update remaining time */
 	virtual void DefaultTimer();
 
+	/** sends queued chat to all players */
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** queue a chat line, it is sent to all players with the rest of this tick's chat */
+	void QueueChatMessage(APlayerController* Sender, const FString& Msg);
+
 	/** called before startmatch */
 	virtual void HandleMatchIsWaitingToStart() override;
 
 	/** starts new match */
 	virtual void HandleMatchHasStarted() override;
 
-	/** hides the onscreen hud and restarts the map */
+	/** hides the onscreen hud and travels to the next map of the rotation, or restarts the map */
 	virtual void RestartGame() override;
 
 	/** Creates AIControllers for all bots */
@@ -72,6 +82,12 @@ class AShooterGameMode : public AGameMode
 	/** Create a bot */
 	AShooterAIController* CreateBot(int32 BotNum);	
 
+	/** is this a headless bot-vs-bot simulation? */
+	bool IsBotMatchSimulation() const;
+
+	/** baked visibility of the current map, null if it wasn't baked */
+	const FShooterVisibilityMap* GetVisibilityMap() const;
+
 protected:
 
 	/** delay between first player login and starting match */
@@ -100,16 +116,45 @@ protected:
 	UPROPERTY(config)
 	int32 MaxBots;
 
+	/** seconds between replay checkpoints, shorter is faster seeking for bigger replays */
+	UPROPERTY(config)
+	float ReplayCheckpointInterval;
+
+	/** maps played in order, by package name; empty restarts the current map */
+	UPROPERTY(config)
+	TArray<FString> MapRotation;
+
 	UPROPERTY()
 	TArray<AShooterAIController*> BotControllers;
 	
 	/** Handle for efficient management of DefaultTimer timer */
 	FTimerHandle TimerHandle_DefaultTimer;
 
+	/** chat waiting to be sent, oldest first */
+	UPROPERTY(Transient)
+	TArray<FShooterChatMessage> PendingChatMessages;
+
+	/** most chat lines sent to players per tick, the rest waits for the next one */
+	UPROPERTY(config)
+	int32 MaxChatMessagesPerTick;
+
+	/** most chat lines waiting to be sent, the oldest are dropped beyond that */
+	UPROPERTY(config)
+	int32 MaxPendingChatMessages;
+
 	bool bNeedsBotCreation;
 
 	bool bAllowBots;		
 
+	/** drives headless bot-vs-bot matches, only valid when started with the BotSim option */
+	TSharedPtr<FShooterBotMatchSimulator> BotMatchSimulator;
+
+	/** samples server load for headless load tests, only valid when started with -LoadTestReport */
+	TSharedPtr<FShooterLoadTestRecorder> LoadTestRecorder;
+
+	/** precomputed cell to cell visibility, rejects line of sight traces that can't succeed */
+	TSharedPtr<FShooterVisibilityMap> VisibilityMap;
+
 	/** spawning all bots for this game */
 	void StartBots();
 
@@ -122,6 +167,15 @@ protected:
 	/** check if PlayerState is a winner */
 	virtual bool IsWinner(AShooterPlayerState* PlayerState) const;
 
+	/** add the demo recorded of this match to the local replay index */
+	void IndexRecordedReplay();
+
+	/** add an event to the replay being recorded, if any */
+	void AddReplayEvent(const TCHAR* Group, const FString& Meta);
+
+	/** map after the current one in MapRotation, empty if there is no rotation */
+	FString GetNextMapName() const;
+
 	/** check if player can use spawnpoint */
 	virtual bool IsSpawnpointAllowed(APlayerStart* SpawnPoint, AController* Player) const;
 
@@ -6,6 +6,8 @@
 #include "ShooterLeaderboards.h"
 #include "ShooterGameSession.generated.h"
 
+struct FIcmpEchoResult;
+
 struct FShooterGameSessionParams
 {
 	/** Name of session settings are stored with */
@@ -52,6 +54,28 @@ protected:
 	TSharedPtr<class FShooterOnlineSessionSettings> HostSettings;
 	/** Current search settings */
 	TSharedPtr<class FShooterOnlineSearchSettings> SearchSettings;
+	/** Search results already tried by matchmaking */
+	TArray<int32> TriedSessionIdxs;
+
+	/** Most QoS pings in flight at once */
+	UPROPERTY(config)
+	int32 MaxConcurrentQosPings;
+	/** Seconds before a QoS ping gives up, the ping reported by the online subsystem is kept then */
+	UPROPERTY(config)
+	float QosPingTimeout;
+	/** Matchmaking score per millisecond of ping */
+	UPROPERTY(config)
+	float MatchmakingPingWeight;
+	/** Matchmaking score bonus of a nearly full session over an empty one */
+	UPROPERTY(config)
+	float MatchmakingFillWeight;
+
+	/** Incremented for each search, so pings of older searches are ignored */
+	int32 QosSearchId;
+	/** Next search result to ping */
+	int32 NextQosPingIdx;
+	/** Number of QoS pings waiting for a reply */
+	int32 NumQosPingsInFlight;
 
 	/**
 	 * Delegate fired when a session create request has completed
@@ -102,6 +126,18 @@ protected:
 	 */
 	void ChooseBestSession();
 
+	/**
+	 * Rank a search result for matchmaking by ping and how full it is
+	 *
+	 * @param SearchResult session to rank
+	 *
+	 * @return score, lower is better
+	 */
+	float GetMatchmakingScore(const FOnlineSessionSearchResult& SearchResult) const;
+
+	/** @return index of the best search result not tried by matchmaking yet, -1 if none has an open slot */
+	int32 FindBestSessionIdx() const;
+
 	/**
 	 * Entry point for matchmaking after search results are returned
 	 */
@@ -149,6 +185,18 @@ protected:
 	DECLARE_EVENT_OneParam(AShooterGameSession, FOnFindSessionsComplete, bool /*bWasSuccessful*/);
 	FOnFindSessionsComplete FindSessionsCompleteEvent;
 
+	/*
+	 * Event triggered when a QoS ping updated the ping of a search result
+	 */
+	DECLARE_EVENT_OneParam(AShooterGameSession, FOnSearchResultPingUpdated, int32 /*SearchResultIdx*/);
+	FOnSearchResultPingUpdated SearchResultPingUpdatedEvent;
+
+	/** Start QoS pings for search results that arrived since the last tick */
+	void StartQosPings();
+
+	/** QoS ping reply or timeout */
+	void OnQosPingComplete(FIcmpEchoResult Result, int32 SearchId, int32 SearchResultIdx);
+
 public:
 
 	/** Default number of players allowed in a game */
@@ -227,6 +275,12 @@ public:
 	/** @return the delegate fired when search of session completes */
 	FOnFindSessionsComplete& OnFindSessionsComplete() { return FindSessionsCompleteEvent; }
 
+	/** @return the delegate fired when a QoS ping updated a search result */
+	FOnSearchResultPingUpdated& OnSearchResultPingUpdated() { return SearchResultPingUpdatedEvent; }
+
+	/** Pings search results as they arrive */
+	virtual void Tick(float DeltaSeconds) override;
+
 	/** Handle starting the match */
 	virtual void HandleMatchHasStarted() override;
 
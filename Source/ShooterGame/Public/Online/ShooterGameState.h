@@ -4,11 +4,16 @@
 
 #include "ShooterGameState.generated.h"
 
+class FShooterCorpseManager;
+
 /** ranked PlayerState map, created from the GameState */
 typedef TMap<int32, TWeakObjectPtr<AShooterPlayerState> > RankedPlayerMap; 
 
+/** kills, deaths, score, team or name of a player changed; PlayerState is null when players joined or left */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlayerScoreChanged, AShooterPlayerState* /*PlayerState*/);
+
 UCLASS()
-class AShooterGameState : public AGameState
+class SHOOTERGAME_API AShooterGameState : public AGameState
 {
 	GENERATED_UCLASS_BODY()
 
@@ -30,8 +35,44 @@ public:
 	UPROPERTY(Transient, Replicated, BlueprintReadWrite)
 	bool bTimerPaused;
 
+	/** map the server travels to after the match, set when the match ends so clients can preload it */
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_NextMapName, BlueprintReadOnly)
+	FString NextMapName;
+
+	/** [server] set the next map and start preloading it */
+	void SetNextMapName(const FString& InNextMapName);
+
+	/** start preloading the next map announced by the server */
+	UFUNCTION()
+	void OnRep_NextMapName();
+
 	/** gets ranked PlayerState map for specific team */
 	void GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const;	
 
+	/** broadcast a scoreboard change of a player, or of the player list when PlayerState is null */
+	void NotifyPlayerScoreChanged(AShooterPlayerState* PlayerState);
+
+	/** event fired when anything shown on the scoreboard changes */
+	FOnPlayerScoreChanged& OnPlayerScoreChanged() { return PlayerScoreChangedEvent; }
+
+	// Begin AGameStateBase interface
+	virtual void AddPlayerState(APlayerState* PlayerState) override;
+	virtual void RemovePlayerState(APlayerState* PlayerState) override;
+	// End AGameStateBase interface
+
+	/** counts outgoing RPCs for stat ShooterGame */
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, FFrame* Stack) override;
+
 	void RequestFinishAndExitToMainMenu();
+
+	/** keeps the number of ragdolls and corpses in this world bounded */
+	FShooterCorpseManager* GetCorpseManager();
+
+private:
+
+	/** scoreboard change event */
+	FOnPlayerScoreChanged PlayerScoreChangedEvent;
+
+	/** created with the first corpse */
+	TSharedPtr<FShooterCorpseManager> CorpseManager;
 };
@@ -5,7 +5,7 @@
 /**
  * General session settings for a Shooter game
  */
-class FShooterOnlineSessionSettings : public FOnlineSessionSettings
+class SHOOTERGAME_API FShooterOnlineSessionSettings : public FOnlineSessionSettings
 {
 public:
 
@@ -16,7 +16,7 @@ public:
 /**
  * General search setting for a Shooter game
  */
-class FShooterOnlineSearchSettings : public FOnlineSessionSearch
+class SHOOTERGAME_API FShooterOnlineSearchSettings : public FOnlineSessionSearch
 {
 public:
 	FShooterOnlineSearchSettings(bool bSearchingLAN = false, bool bSearchingPresence = false);
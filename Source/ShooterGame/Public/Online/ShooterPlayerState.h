@@ -4,8 +4,10 @@
 
 #include "ShooterPlayerState.generated.h"
 
+class AShooterWeapon;
+
 UCLASS()
-class AShooterPlayerState : public APlayerState
+class SHOOTERGAME_API AShooterPlayerState : public APlayerState
 {
 	GENERATED_UCLASS_BODY()
 
@@ -23,6 +25,12 @@ class AShooterPlayerState : public APlayerState
 
 	virtual void UnregisterPlayerWithSession() override;
 
+	/** refresh HUD ranking when scores replicate */
+	virtual void OnRep_Score() override;
+
+	/** counts outgoing RPCs for stat ShooterGame */
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, FFrame* Stack) override;
+
 	// End APlayerState interface
 
 	/**
@@ -62,6 +70,10 @@ class AShooterPlayerState : public APlayerState
 	UFUNCTION(BlueprintCallable, Category = ShooterPlayerState)
 	int32 GetNumRocketsFired() const;
 
+	/** get number of bullets that hit a pawn this match, as seen by the shooter */
+	UFUNCTION(BlueprintCallable, Category = ShooterPlayerState)
+	int32 GetNumBulletHits() const;
+
 	/** get whether the player quit the match */
 	UFUNCTION(BlueprintCallable, Category = ShooterPlayerState)
 	bool IsQuitter() const;
@@ -82,14 +94,49 @@ class AShooterPlayerState : public APlayerState
 	UFUNCTION()
 	void OnRep_TeamColor();
 
+	/** refresh HUD kill count */
+	UFUNCTION()
+	void OnRep_Kills();
+
+	UFUNCTION()
+	void OnRep_Deaths();
+
+	virtual void OnRep_PlayerName() override;
+
 	//We don't need stats about amount of ammo fired to be server authenticated, so just increment these with local functions
 	void AddBulletsFired(int32 NumBullets);
 	void AddRocketsFired(int32 NumRockets);
+	void AddBulletHits(int32 NumHits);
+
+	/** [server] count a client side pawn hit report that passed or failed verification */
+	void AddHitReport(bool bConfirmed);
+
+	/** [server] count a client side miss report */
+	void AddMissReport();
+
+	/** [server] get number of client side hits confirmed this match */
+	int32 GetNumHitsConfirmed() const;
+
+	/** [server] get number of client side hits rejected this match */
+	int32 GetNumHitsRejected() const;
+
+	/** [server] get number of client side misses reported this match */
+	int32 GetNumMissReports() const;
 
 	/** Set whether the player is a quitter */
 	void SetQuitter(bool bInQuitter);
 
 	virtual void CopyProperties(class APlayerState* PlayerState) override;
+
+	/** destroys the kept weapons */
+	virtual void Destroyed() override;
+
+	/** [server] keep a weapon of the dead pawn for the next one */
+	void StoreWeapon(AShooterWeapon* Weapon);
+
+	/** [server] hand over the kept weapons */
+	void TakeStoredWeapons(TArray<AShooterWeapon*>& OutWeapons);
+
 protected:
 
 	/** Set the mesh colors based on the current teamnum variable */
@@ -100,11 +147,11 @@ protected:
 	int32 TeamNumber;
 
 	/** number of kills */
-	UPROPERTY(Transient, Replicated)
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_Kills)
 	int32 NumKills;
 
 	/** number of deaths */
-	UPROPERTY(Transient, Replicated)
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_Deaths)
 	int32 NumDeaths;
 
 	/** number of bullets fired this match */
@@ -115,10 +162,36 @@ protected:
 	UPROPERTY()
 	int32 NumRocketsFired;
 
+	/** number of bullets that hit a pawn this match */
+	UPROPERTY()
+	int32 NumBulletHits;
+
+	/** number of client side hits confirmed this match */
+	UPROPERTY()
+	int32 NumHitsConfirmed;
+
+	/** number of client side hits rejected this match */
+	UPROPERTY()
+	int32 NumHitsRejected;
+
+	/** number of client side misses reported this match */
+	UPROPERTY()
+	int32 NumMissReports;
+
 	/** whether the user quit the match */
 	UPROPERTY()
 	uint8 bQuitter : 1;
 
+	/** [server] weapons of the dead pawn, reused by the next one */
+	UPROPERTY(Transient)
+	TArray<AShooterWeapon*> StoredWeapons;
+
 	/** helper for scoring points */
 	void ScorePoints(int32 Points);
+
+	/** push kills and ranking to the HUD view models of all local players */
+	void UpdateHUDViewModels();
+
+	/** tell the HUD view models and the scoreboard that kills, deaths, score, team or name changed */
+	void NotifyScoreChanged();
 };
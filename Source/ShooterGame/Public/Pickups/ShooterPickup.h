@@ -16,6 +16,9 @@ class AShooterPickup : public AActor
 	/** check if pawn can use this pickup */
 	virtual bool CanBePickedUp(class AShooterCharacter* TestPawn) const;
 
+	/** counts outgoing RPCs for stat ShooterGame */
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, FFrame* Stack) override;
+
 protected:
 	/** initial setup */
 	virtual void BeginPlay() override;
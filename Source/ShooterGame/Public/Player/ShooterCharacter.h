@@ -6,7 +6,7 @@
 #include "ShooterCharacter.generated.h"
 
 UCLASS(Abstract)
-class AShooterCharacter : public ACharacter
+class SHOOTERGAME_API AShooterCharacter : public ACharacter
 {
 	GENERATED_UCLASS_BODY()
 
@@ -21,6 +21,14 @@ class AShooterCharacter : public ACharacter
 	/** cleanup inventory */
 	virtual void Destroyed() override;
 
+	/** character blueprints are ShooterCharacter primary assets */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+#if WITH_EDITOR
+	/** collect the bundles of the soft references */
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+#endif
+
 	/** update mesh for first person view */
 	virtual void PawnClientRestart() override;
 
@@ -266,6 +274,10 @@ private:
 	/** pawn mesh: 1st person view */
 	UPROPERTY(VisibleDefaultsOnly, Category = Mesh)
 	USkeletalMeshComponent* Mesh1P;
+
+	/** [server] weapon trace proxy for the 3rd person mesh */
+	UPROPERTY(VisibleDefaultsOnly, Category = Mesh)
+	class UShooterHitboxComponent* HitboxComponent;
 protected:
 
 	/** socket or bone name for attaching weapon mesh */
@@ -331,32 +343,38 @@ protected:
 	UAnimMontage* DeathAnim;
 
 	/** sound played on death, local player only */
-	UPROPERTY(EditDefaultsOnly, Category = Pawn)
-	USoundCue* DeathSound;
+	UPROPERTY(EditDefaultsOnly, Category = Pawn, meta = (AssetBundles = "Client"))
+	TSoftObjectPtr<USoundCue> DeathSound;
 
 	/** effect played on respawn */
-	UPROPERTY(EditDefaultsOnly, Category = Pawn)
-	UParticleSystem* RespawnFX;
+	UPROPERTY(EditDefaultsOnly, Category = Pawn, meta = (AssetBundles = "Client"))
+	TSoftObjectPtr<UParticleSystem> RespawnFX;
 
 	/** sound played on respawn */
-	UPROPERTY(EditDefaultsOnly, Category = Pawn)
-	USoundCue* RespawnSound;
+	UPROPERTY(EditDefaultsOnly, Category = Pawn, meta = (AssetBundles = "Client"))
+	TSoftObjectPtr<USoundCue> RespawnSound;
 
 	/** sound played when health is low */
-	UPROPERTY(EditDefaultsOnly, Category = Pawn)
-	USoundCue* LowHealthSound;
+	UPROPERTY(EditDefaultsOnly, Category = Pawn, meta = (AssetBundles = "Client"))
+	TSoftObjectPtr<USoundCue> LowHealthSound;
 
 	/** sound played when running */
-	UPROPERTY(EditDefaultsOnly, Category = Pawn)
-	USoundCue* RunLoopSound;
+	UPROPERTY(EditDefaultsOnly, Category = Pawn, meta = (AssetBundles = "Client"))
+	TSoftObjectPtr<USoundCue> RunLoopSound;
 
 	/** sound played when stop running */
-	UPROPERTY(EditDefaultsOnly, Category = Pawn)
-	USoundCue* RunStopSound;
+	UPROPERTY(EditDefaultsOnly, Category = Pawn, meta = (AssetBundles = "Client"))
+	TSoftObjectPtr<USoundCue> RunStopSound;
 
 	/** sound played when targeting state changes */
-	UPROPERTY(EditDefaultsOnly, Category = Pawn)
-	USoundCue* TargetingSound;
+	UPROPERTY(EditDefaultsOnly, Category = Pawn, meta = (AssetBundles = "Client"))
+	TSoftObjectPtr<USoundCue> TargetingSound;
+
+#if WITH_EDITORONLY_DATA
+	/** bundles of the soft references, saved to the asset registry so cooked builds can stream them */
+	UPROPERTY(AssetRegistrySearchable)
+	FAssetBundleData AssetBundleData;
+#endif
 
 	/** used to manipulate with run loop sound */
 	UPROPERTY()
@@ -393,9 +411,12 @@ public:
 	uint32 bIsDying : 1;
 
 	// Current health of the Pawn
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = Health)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, ReplicatedUsing=OnRep_Health, Category = Health)
 	float Health;
 
+	/** [local] push health, weapon and crosshair state to the owner's HUD view model */
+	void UpdateHUDViewModel();
+
 	/** Take damage, handle death */
 	virtual float TakeDamage(float Damage, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, class AActor* DamageCauser) override;
 
@@ -405,6 +426,9 @@ public:
 	/** Kill this pawn */
 	virtual void KilledBy(class APawn* EventInstigator);
 
+	/** stop simulating and animating the corpse, it keeps its current pose */
+	void FreezeCorpse();
+
 	/** Returns True if the pawn can die in the current state */
 	virtual bool CanDie(float KillingDamage, FDamageEvent const& DamageEvent, AController* Killer, AActor* DamageCauser) const;
 
@@ -423,6 +447,9 @@ public:
 
 	/** Called on the actor right before replication occurs */
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
+
+	/** counts outgoing RPCs for stat ShooterGame */
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, FFrame* Stack) override;
 protected:
 	/** notification when killed, for both the server and client. */
 	virtual void OnDeath(float KillingDamage, struct FDamageEvent const& DamageEvent, class APawn* InstigatingPawn, class AActor* DamageCauser);
@@ -440,6 +467,10 @@ protected:
 	UFUNCTION()
 	void OnRep_LastTakeHitInfo();
 
+	/** health rep handler */
+	UFUNCTION()
+	void OnRep_Health();
+
 	//////////////////////////////////////////////////////////////////////////
 	// Inventory
 
@@ -453,9 +484,15 @@ protected:
 	/** [server] spawns default inventory */
 	void SpawnDefaultInventory();
 
+	/** [server] swap the default inventory for the weapons the player state kept from the previous life */
+	void ReuseStoredWeapons();
+
 	/** [server] remove all weapons from inventory and destroy them */
 	void DestroyInventory();
 
+	/** [server] remove all weapons from inventory and hand them to the player state for the next life */
+	void StoreInventory();
+
 	/** equip weapon */
 	UFUNCTION(reliable, server, WithValidation)
 	void ServerEquipWeapon(class AShooterWeapon* NewWeapon);
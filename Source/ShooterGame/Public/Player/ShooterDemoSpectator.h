@@ -4,17 +4,14 @@
 
 #include "ShooterDemoSpectator.generated.h"
 
-class SShooterDemoHUD;
+class IShooterDemoUI;
 
 UCLASS(config=Game)
-class AShooterDemoSpectator : public APlayerController
+class SHOOTERGAME_API AShooterDemoSpectator : public APlayerController
 {
 	GENERATED_UCLASS_BODY()
 
 public:
-	/** shooter in-game menu */
-	TSharedPtr<class FShooterDemoPlaybackMenu> ShooterDemoPlaybackMenu;
-
 	virtual void SetupInputComponent() override;
 	virtual void SetPlayer( UPlayer* Player ) override;
 	virtual void Destroyed() override;
@@ -25,7 +22,22 @@ public:
 
 	int32 PlaybackSpeed;
 
+	/** replay is played back fast enough that cosmetics are thinned out */
+	static bool IsFastPlayback(const UWorld* World);
+
+	/** during fast playback, true for all but one in every few cosmetic effects, fewer the faster the replay plays */
+	static bool ShouldSkipCosmeticEffect(const UWorld* World);
+
 private:
-	TSharedPtr<SShooterDemoHUD> DemoHUD;
+	/** playback speed from which impacts, trails, weapon sounds, ragdolls and most of the HUD are suppressed */
+	UPROPERTY(config)
+	float FastPlaybackSpeed;
+
+	/** at FastPlaybackSpeed one in this many effects is kept, scaled up with faster playback */
+	UPROPERTY(config)
+	int32 FastPlaybackEffectInterval;
+
+	/** replay HUD and menu, from the ClientOnly UI module */
+	TSharedPtr<IShooterDemoUI> DemoUI;
 };
 
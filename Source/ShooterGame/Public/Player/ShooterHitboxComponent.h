@@ -0,0 +1,143 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Components/SceneComponent.h"
+#include "ShooterHitboxComponent.generated.h"
+
+class UAnimSequence;
+class UCapsuleComponent;
+
+/** movement states with a cached hitbox pose */
+namespace EShooterHitboxPose
+{
+	enum Type
+	{
+		Idle,
+		Run,
+		Sprint,
+		Fall,
+		MAX,
+	};
+}
+
+/** one capsule of the hitbox proxy, spanning a bone group */
+USTRUCT()
+struct FShooterHitboxShape
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** bone at one end of the capsule */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	FName StartBone;
+
+	/** bone at the other end, none for a sphere around StartBone */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	FName EndBone;
+
+	/** capsule radius */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	float Radius;
+
+	/** rotates with the aim pitch around the AimPivotBone */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	bool bFollowsAim;
+
+	FShooterHitboxShape()
+		: Radius(10.0f)
+		, bFollowsAim(false)
+	{
+	}
+
+	FShooterHitboxShape(FName InStartBone, FName InEndBone, float InRadius, bool bInFollowsAim)
+		: StartBone(InStartBone)
+		, EndBone(InEndBone)
+		, Radius(InRadius)
+		, bFollowsAim(bInFollowsAim)
+	{
+	}
+};
+
+/**
+ * Server hit detection proxy.
+ *
+ * Dedicated servers don't need animated, physically simulated character meshes, only something for COLLISION_WEAPON
+ * traces to hit. With p.ShooterServerHitboxes 1 the mesh stops blocking weapon traces and the server can run with
+ * bSimulateSkeletalMeshOnDedicatedServer=False; instead a handful of query-only capsules, one per bone group, are
+ * placed from a pose cache. The cache holds one pose per movement state, sampled once per mesh from the pose
+ * animations, so keeping the hitboxes up to date is a table lookup and a few relative transforms when the movement
+ * state or the aim pitch changes.
+ */
+UCLASS()
+class UShooterHitboxComponent : public USceneComponent
+{
+	GENERATED_UCLASS_BODY()
+
+	/** should characters in this world use hitbox proxies */
+	static bool ShouldUseHitboxes(const UWorld* World);
+
+	/** create the capsules for Mesh and take over weapon traces from it */
+	void EnableHitboxes(USkeletalMeshComponent* Mesh);
+
+	/** remove the capsules, e.g. on death */
+	void DisableHitboxes();
+
+	/** are the capsules in use */
+	bool AreHitboxesEnabled() const;
+
+	/** [debug] also trace the skeletal meshes of characters using hitboxes and count where the two disagree */
+	static void CompareWithMeshTrace(const UWorld* World, const AActor* IgnoreActor, const FVector& StartTrace, const FVector& EndTrace, const FHitResult& Hit);
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+
+	/** capsules making up the proxy */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	TArray<FShooterHitboxShape> Shapes;
+
+	/** bone the aim pitch rotates upper body shapes around */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	FName AimPivotBone;
+
+	/** aim pitch change (degrees) before the shapes following it are moved again */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	float AimPitchTolerance;
+
+	/** pose sampled for standing still, the reference pose is used if unset */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	TSoftObjectPtr<UAnimSequence> IdlePoseAnimation;
+
+	/** pose sampled for moving */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	TSoftObjectPtr<UAnimSequence> RunPoseAnimation;
+
+	/** pose sampled for running */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	TSoftObjectPtr<UAnimSequence> SprintPoseAnimation;
+
+	/** pose sampled for falling */
+	UPROPERTY(EditDefaultsOnly, Category = Hitbox)
+	TSoftObjectPtr<UAnimSequence> FallPoseAnimation;
+
+	/** capsules created for Shapes */
+	UPROPERTY(Transient)
+	TArray<UCapsuleComponent*> Capsules;
+
+private:
+
+	/** movement state of the owner */
+	EShooterHitboxPose::Type GetCurrentPose() const;
+
+	/** move the capsules to Pose, rotating the ones that follow the aim by AimPitch */
+	void ApplyPose(EShooterHitboxPose::Type Pose, float AimPitch);
+
+	/** cached shape transforms for the mesh we were enabled with */
+	TSharedPtr<struct FShooterHitboxPoseSet> PoseSet;
+
+	/** pose the capsules are in */
+	EShooterHitboxPose::Type AppliedPose;
+
+	/** aim pitch the capsules are in */
+	float AppliedAimPitch;
+};
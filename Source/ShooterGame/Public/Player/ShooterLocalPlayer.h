@@ -6,7 +6,7 @@
 #include "ShooterLocalPlayer.generated.h"
 
 UCLASS(BlueprintType, config=Engine, transient)
-class UShooterLocalPlayer : public ULocalPlayer
+class SHOOTERGAME_API UShooterLocalPlayer : public ULocalPlayer
 {
 	GENERATED_UCLASS_BODY()
 
@@ -0,0 +1,160 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** result of one match, stored as a fixed-size record in the match history file */
+struct FShooterMatchRecord
+{
+	/** when the match ended (UTC) */
+	FDateTime Timestamp;
+
+	/** map short name, truncated to fit the record */
+	FString MapName;
+
+	/** game type (FFA, TDM), truncated to fit the record */
+	FString GameType;
+
+	int32 Kills;
+	int32 Deaths;
+	int32 BulletsFired;
+	int32 BulletHits;
+	int32 RocketsFired;
+
+	/** time the match was in progress */
+	int32 DurationSeconds;
+
+	bool bIsWinner;
+
+	FShooterMatchRecord()
+		: Kills(0)
+		, Deaths(0)
+		, BulletsFired(0)
+		, BulletHits(0)
+		, RocketsFired(0)
+		, DurationSeconds(0)
+		, bIsWinner(false)
+	{
+	}
+
+	/** fraction of bullets that hit, 0 if none were fired */
+	float GetAccuracy() const
+	{
+		return BulletsFired > 0 ? (float)BulletHits / BulletsFired : 0.0f;
+	}
+};
+
+/** sums over a range of matches */
+struct FShooterMatchTotals
+{
+	int64 NumMatches;
+	int64 Wins;
+	int64 Kills;
+	int64 Deaths;
+	int64 BulletsFired;
+	int64 BulletHits;
+	int64 RocketsFired;
+	int64 DurationSeconds;
+
+	FShooterMatchTotals()
+		: NumMatches(0)
+		, Wins(0)
+		, Kills(0)
+		, Deaths(0)
+		, BulletsFired(0)
+		, BulletHits(0)
+		, RocketsFired(0)
+		, DurationSeconds(0)
+	{
+	}
+
+	void Add(const FShooterMatchRecord& Match);
+
+	/** kills per death, kills if there were no deaths */
+	float GetKillDeathRatio() const
+	{
+		return Deaths > 0 ? (float)Kills / Deaths : (float)Kills;
+	}
+
+	/** fraction of bullets that hit, 0 if none were fired */
+	float GetAccuracy() const
+	{
+		return BulletsFired > 0 ? (float)BulletHits / BulletsFired : 0.0f;
+	}
+};
+
+/**
+ * Per-user match history in Saved/SaveGames/<Slot>.history and <Slot>.historyindex.
+ *
+ * The history file is a small fixed header followed by fixed-size match records in the order they were played, and
+ * is only ever appended to, so saving a match costs the same no matter how long the history is. The record count is
+ * the file size, and the last N matches are a single read at a known offset from the end. The index file holds the
+ * totals over all records, so lifetime aggregates never touch the records; it is replaced as a whole after every
+ * append. If a write was interrupted, the complete records win: a partial record is cut off and the index rebuilt.
+ */
+class FShooterMatchHistory : public TSharedFromThis<FShooterMatchHistory>
+{
+public:
+
+	FShooterMatchHistory(const FString& InSlotName);
+
+	/** read the header of the history file, only the header is loaded; an invalid file is deleted */
+	void Load();
+
+	/** queue a match to be appended in the background */
+	void AddMatch(const FShooterMatchRecord& Match);
+
+	/** number of recorded matches, including ones still being written */
+	int32 GetNumMatches() const;
+
+	/** totals over all recorded matches */
+	const FShooterMatchTotals& GetTotals() const;
+
+	/** up to NumMatches most recent matches, newest first; waits for queued appends */
+	void GetRecentMatches(int32 NumMatches, TArray<FShooterMatchRecord>& OutMatches);
+
+	/** totals over the NumMatches most recent matches */
+	FShooterMatchTotals GetRecentTotals(int32 NumMatches);
+
+	/** block until all queued matches are on disk */
+	void Flush();
+
+private:
+
+	/** location of the history file */
+	FString GetFilename() const;
+
+	/** location of the totals over the records in the history file */
+	FString GetIndexFilename() const;
+
+	/** append the queued matches, runs on the thread pool until the queue is empty or a write fails */
+	void WritePendingMatches();
+
+	/** append to the history file and WrittenTotals, returns how many of Matches made it into the file */
+	int32 AppendRecords(const TArray<FShooterMatchRecord>& Matches);
+
+	/** make WrittenTotals match the complete records in the history file, cutting off a partial record */
+	bool SyncWithHistoryFile();
+
+	/** save slot the history belongs to */
+	FString SlotName;
+
+	/** totals including queued matches, only touched on the game thread */
+	FShooterMatchTotals Totals;
+
+	/** matches waiting to be appended, including ones whose write failed */
+	TArray<FShooterMatchRecord> PendingMatches;
+
+	/** totals over the records in the history file, only touched by the writer, or by Load while none runs */
+	FShooterMatchTotals WrittenTotals;
+
+	/** a background write is draining PendingMatches */
+	bool bWriting;
+
+	/** guards PendingMatches and bWriting */
+	FCriticalSection Lock;
+
+	/** background write, only touched on the game thread */
+	TFuture<void> WriteTask;
+};
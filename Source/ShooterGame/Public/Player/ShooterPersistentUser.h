@@ -1,10 +1,19 @@
 // Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
 
 #pragma once
+#include "Player/ShooterMatchHistory.h"
 #include "ShooterPersistentUser.generated.h"
 
+/**
+ * Lifetime stats and options of a local player.
+ *
+ * Every setter marks the record dirty, SaveIfDirty only serializes it when something changed. The serialized record
+ * is written on a background thread (to a temporary file renamed over the old save on desktop platforms), and saves
+ * requested while a write is in flight are coalesced so only the newest one is written. Per-match results are kept
+ * separately in the match history of the slot.
+ */
 UCLASS(BlueprintType)
-class UShooterPersistentUser : public USaveGame
+class SHOOTERGAME_API UShooterPersistentUser : public USaveGame
 {
 	GENERATED_UCLASS_BODY()
 
@@ -12,12 +21,18 @@ public:
 	/** Loads user persistence data if it exists, creates an empty record otherwise. */
 	static UShooterPersistentUser* LoadPersistentUser(FString SlotName, const int32 UserIndex);
 
+	/** Blocks until all saves queued so far are on disk. */
+	static void FlushPendingSaves();
+
 	/** Saves data if anything has changed. */
 	UFUNCTION(BlueprintCallable)
 	void SaveIfDirty();
 
-	/** Records the result of a match. */
-	void AddMatchResult(int32 MatchKills, int32 MatchDeaths, int32 MatchBulletsFired, int32 MatchRocketsFired, bool bIsMatchWinner);
+	/** Records the result of a match in the lifetime stats and the match history. */
+	void AddMatchResult(const FShooterMatchRecord& Match);
+
+	/** Match history of this save slot. */
+	TSharedPtr<FShooterMatchHistory> GetMatchHistory() const;
 
 	/** needed because we can recreate the subsystem that stores it */
 	UFUNCTION(BlueprintCallable)
@@ -119,13 +134,7 @@ public:
 protected:
 	void SetToDefaults();
 
-	/** Checks if the Mouse Sensitivity user setting is different from current */
-	bool IsAimSensitivityDirty() const;
-
-	/** Checks if the Inverted Mouse user setting is different from current */
-	bool IsInvertedYAxisDirty() const;
-
-	/** Triggers a save of this data. */
+	/** Serializes this data and queues it to be written in the background. */
 	void SavePersistentUser();
 
 	/** Lifetime count of kills */
@@ -182,4 +191,7 @@ private:
 	/** The string identifier used to save/load this persistent user. */
 	FString SlotName;
 	int32 UserIndex;
+
+	/** Per-match results, shared by all records of the slot. */
+	TSharedPtr<FShooterMatchHistory> MatchHistory;
 };
\ No newline at end of file
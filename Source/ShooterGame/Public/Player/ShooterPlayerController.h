@@ -3,9 +3,10 @@
 #pragma once
 
 #include "Online.h"
+#include "ShooterTypes.h"
 #include "ShooterPlayerController.generated.h"
 
-class AShooterHUD;
+class IShooterPlayerUI;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FPlayerKilledDelegate, class AShooterPlayerState*, KillerPlayerState, class AShooterPlayerState*, KilledPlayerState, const UDamageType*, KillerDamageType);
 
@@ -16,7 +17,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FEnemyHitDelegate);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOutOfAmmoDelegate);
 
 UCLASS(BlueprintType, config=Game)
-class AShooterPlayerController : public APlayerController
+class SHOOTERGAME_API AShooterPlayerController : public APlayerController
 {
 	GENERATED_UCLASS_BODY()
 
@@ -58,6 +59,9 @@ public:
 	/* Overriden Message implementation. */
 	virtual void ClientTeamMessage_Implementation( APlayerState* SenderPlayerState, const FString& S, FName Type, float MsgLifeTime ) override;
 
+	/** counts outgoing RPCs for stat ShooterGame */
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, FFrame* Stack) override;
+
 	/* Tell the HUD to toggle the chat window. */
 	void ToggleChatWindow();
 
@@ -69,6 +73,10 @@ public:
 	UFUNCTION(unreliable, server, WithValidation)
 	void ServerSay(const FString& Msg);	
 
+	/** chat lines said by other players since the last server tick */
+	UFUNCTION(reliable, client)
+	void ClientReceiveChat(const TArray<FShooterChatMessage>& Messages);
+
 	/** Local function run an emote */
 // 	UFUNCTION(exec)
 // 	virtual void Emote(const FString& Msg);
@@ -190,8 +198,8 @@ public:
 	 */
 	void UpdateAchievementProgress( const FString& Id, float Percent );
 
-	/** Returns a pointer to the shooter game hud. May return NULL. */
-	AShooterHUD* GetShooterHUD() const;
+	/** Returns the HUD and menus of this local player, null on servers and for remote players. */
+	IShooterPlayerUI* GetPlayerUI() const;
 
 	/** Returns the persistent user record associated with this player, or null if there is't one. */
 	class UShooterPersistentUser* GetPersistentUser() const;
@@ -236,11 +244,34 @@ protected:
 	/** true for the first frame after the game has ended */
 	uint8 bGameEndedFrame : 1;
 
+	/** if set, this player is driven by scripted input for headless load tests (-LoadTestBot) */
+	uint8 bLoadTestAutopilot : 1;
+
+	/** time left before the load test autopilot picks a new strafe direction */
+	float LoadTestStrafeTimer;
+
+	/** current load test autopilot strafe direction */
+	float LoadTestStrafeDir;
+
+	/** chat messages a player may send per second once the burst is used up */
+	UPROPERTY(config)
+	float ChatMessagesPerSecond;
+
+	/** chat messages a player may send back to back */
+	UPROPERTY(config)
+	float ChatBurstSize;
+
+	/** [server] chat token bucket, one token per message */
+	float ChatTokens;
+
+	/** [server] time the chat token bucket was last refilled */
+	float LastChatTokenTime;
+
 	/** stores pawn location at last player death, used where player scores a kill after they died **/
 	FVector LastDeathLocation;
 
-	/** shooter in-game menu */
-	TSharedPtr<class FShooterIngameMenu> ShooterIngameMenu;
+	/** HUD, in-game menu and Noesis HUD data context, from the ClientOnly UI module */
+	TSharedPtr<IShooterPlayerUI> PlayerUI;
 
 	/** Achievements write object */
 	FOnlineAchievementsWritePtr WriteObject;
@@ -257,6 +288,9 @@ protected:
 	UPROPERTY(BlueprintAssignable)
 	FOutOfAmmoDelegate OutOfAmmoDelegate;
 
+	/** [local] scripted movement, aiming and firing for load test clients */
+	void UpdateLoadTestAutopilot(float DeltaTime);
+
 	/** try to find spot for death cam */
 	bool FindDeathCameraSpot(FVector& CameraLocation, FRotator& CameraRotation);
 
@@ -279,6 +313,9 @@ public:
 	/** update camera when pawn dies */
 	virtual void PawnPendingDestroy(APawn* P) override;
 
+	/** refresh HUD view model for the new pawn */
+	virtual void SetPawn(APawn* InPawn) override;
+
 	//End AController interface
 
 	// Begin APlayerController interface
@@ -300,6 +337,9 @@ public:
 	/** Return the client to the main menu gracefully.  ONLY sets GI state. */
 	void ClientReturnToMainMenu_Implementation(const FString& ReturnReason) override;
 
+	/** Spawns the HUD of the UI module when the game mode asks for the default one. */
+	virtual void ClientSetHUD_Implementation(TSubclassOf<AHUD> NewHUDClass) override;
+
 	/** Causes the player to commit suicide */
 	UFUNCTION(exec)
 	virtual void Suicide();
@@ -321,9 +361,6 @@ public:
 
 	FName	ServerSayString;
 
-	// Timer used for updating friends in the player tick.
-	float ShooterFriendUpdateTimer;
-
 	// For tracking whether or not to send the end event
 	bool bHasSentStartEvents;
 
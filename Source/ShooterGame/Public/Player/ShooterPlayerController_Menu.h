@@ -6,7 +6,7 @@
 #include "ShooterPlayerController_Menu.generated.h"
 
 UCLASS(BlueprintType)
-class AShooterPlayerController_Menu : public APlayerController
+class SHOOTERGAME_API AShooterPlayerController_Menu : public APlayerController
 {
 	GENERATED_UCLASS_BODY()
 
@@ -0,0 +1,80 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/AssetManager.h"
+#include "ShooterAssetManager.generated.h"
+
+/**
+ * Streams ShooterGame content through primary assets.
+ *
+ * Weapon, character and impact effect blueprints are primary assets (see PrimaryAssetTypesToScan in DefaultGame.ini).
+ * Their cosmetic assets are soft references tagged with the Client bundle, so loading a weapon class no longer
+ * pulls in its sounds and particles. All of them are streamed in the background at startup, with the Client bundle
+ * everywhere but on dedicated servers, so the first spawn doesn't hitch on loading.
+ */
+UCLASS()
+class SHOOTERGAME_API UShooterAssetManager : public UAssetManager
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** primary asset types */
+	static const FPrimaryAssetType WeaponType;
+	static const FPrimaryAssetType CharacterType;
+	static const FPrimaryAssetType ImpactEffectType;
+
+	/** sounds, particles and feedback only needed to present the game */
+	static const FName ClientBundle;
+
+	/** the asset manager configured in DefaultEngine.ini */
+	static UShooterAssetManager& Get();
+
+	/** id of a blueprint class default object of one of our primary asset types, invalid for anything else */
+	static FPrimaryAssetId GetBlueprintPrimaryAssetId(const UObject* Object, const FPrimaryAssetType& AssetType);
+
+#if WITH_EDITOR
+	/** collect the AssetBundles metadata of Object's soft references, called when the blueprint is saved */
+	static void UpdateAssetBundleData(const UObject* Object, FAssetBundleData& OutBundleData);
+#endif
+
+	/**
+	 * Resolves a soft reference of the Client bundle. Never loads anything on a dedicated server, and loads
+	 * synchronously (with a warning) if the asset wasn't streamed in yet.
+	 */
+	template<typename AssetType>
+	static AssetType* GetClientAsset(const TSoftObjectPtr<AssetType>& AssetPointer)
+	{
+		AssetType* Asset = AssetPointer.Get();
+		if (Asset == nullptr && !AssetPointer.IsNull() && !IsRunningDedicatedServer())
+		{
+			WarnClientAssetNotLoaded(AssetPointer.ToSoftObjectPath());
+			Asset = AssetPointer.LoadSynchronous();
+		}
+		return Asset;
+	}
+
+	/** are the preloaded primary assets in memory */
+	bool AreGameAssetsLoaded() const;
+
+	// UAssetManager interface
+	virtual void StartInitialLoading() override;
+
+private:
+
+	/** stream all weapons, characters and impact effects, with the Client bundle unless this is a dedicated server */
+	void PreloadGameAssets();
+
+	/** all preloaded primary assets are in memory */
+	void OnGameAssetsLoaded(int32 NumAssets);
+
+	/** log a Client bundle asset that has to be loaded synchronously */
+	static void WarnClientAssetNotLoaded(const FSoftObjectPath& AssetPath);
+
+	/** keeps the preloaded primary assets and bundles in memory */
+	TSharedPtr<FStreamableHandle> GameAssetsHandle;
+
+	/** time the preload started */
+	double PreloadStartTime;
+};
@@ -8,6 +8,8 @@
 #include "ParticleDefinitions.h"
 #include "SoundDefinitions.h"
 #include "Net/UnrealNetwork.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Online/ShooterGameMode.h"
 #include "Online/ShooterGameState.h"
 #include "Player/ShooterCharacter.h"
@@ -17,8 +19,52 @@
 
 class UBehaviorTreeComponent;
 
-DECLARE_LOG_CATEGORY_EXTERN(LogShooter, Log, All);
-DECLARE_LOG_CATEGORY_EXTERN(LogShooterWeapon, Log, All);
+SHOOTERGAME_API DECLARE_LOG_CATEGORY_EXTERN(LogShooter, Log, All);
+SHOOTERGAME_API DECLARE_LOG_CATEGORY_EXTERN(LogShooterWeapon, Log, All);
+
+/** gameplay stats, visible with "stat ShooterGame" and in CSV profiles under the ShooterGame category */
+DECLARE_STATS_GROUP(TEXT("ShooterGame"), STATGROUP_ShooterGame, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FireWeapon"), STAT_ShooterFireWeapon, STATGROUP_ShooterGame, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ServerNotifyHit"), STAT_ShooterServerNotifyHit, STATGROUP_ShooterGame, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HandleFiring"), STAT_ShooterHandleFiring, STATGROUP_ShooterGame, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FindClosestEnemyWithLOS"), STAT_ShooterFindClosestEnemyWithLOS, STATGROUP_ShooterGame, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ChoosePlayerStart"), STAT_ShooterChoosePlayerStart, STATGROUP_ShooterGame, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GetRankedMap"), STAT_ShooterGetRankedMap, STATGROUP_ShooterGame, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("DrawHUD"), STAT_ShooterDrawHUD, STATGROUP_ShooterGame, SHOOTERGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("IsReplicationPausedForConnection"), STAT_ShooterIsReplicationPaused, STATGROUP_ShooterGame, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Scoreboard Tick"), STAT_ShooterScoreboardTick, STATGROUP_ShooterGame, SHOOTERGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateHitboxes"), STAT_ShooterUpdateHitboxes, STATGROUP_ShooterGame, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces"), STAT_ShooterTraces, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RPCs Sent"), STAT_ShooterRPCsSent, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actors Spawned"), STAT_ShooterActorsSpawned, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("HUD Text Rebuilds"), STAT_ShooterHUDTextRebuilds, STATGROUP_ShooterGame, SHOOTERGAME_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Chat Messages Dropped"), STAT_ShooterChatMessagesDropped, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hitbox Agreed Hits"), STAT_ShooterHitboxAgreedHits, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hitbox Only Hits"), STAT_ShooterHitboxOnlyHits, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mesh Only Hits"), STAT_ShooterMeshOnlyHits, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Traces Skipped"), STAT_ShooterTracesSkipped, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Animation Only Deaths"), STAT_ShooterAnimationOnlyDeaths, STATGROUP_ShooterGame, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Weapons Reused"), STAT_ShooterWeaponsReused, STATGROUP_ShooterGame, );
+
+/** corpses are part of the physics cost, they show up in stat Physics */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Shooter Corpse Manager"), STAT_ShooterCorpseManager, STATGROUP_Physics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Shooter Active Ragdolls"), STAT_ShooterActiveRagdolls, STATGROUP_Physics, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Shooter Corpses"), STAT_ShooterCorpses, STATGROUP_Physics, );
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(SHOOTERGAME_API, ShooterGame);
+
+/** times the enclosing scope in stat ShooterGame, Unreal Insights (cpu trace channel) and CSV profiles */
+#define SHOOTER_SCOPE_CYCLE_COUNTER(StatName) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Shooter##StatName); \
+	SCOPE_CYCLE_COUNTER(STAT_Shooter##StatName); \
+	CSV_SCOPED_TIMING_STAT(ShooterGame, StatName)
+
+/** bumps one of the per-frame ShooterGame counters */
+#define SHOOTER_INC_COUNTER(StatName) \
+	INC_DWORD_STAT(STAT_Shooter##StatName); \
+	CSV_CUSTOM_STAT(ShooterGame, StatName, 1, ECsvCustomStatOp::Accumulate)
 
 /** when you modify this, please note that this information can be saved with instances
  * also DefaultEngine.ini [/Script/Engine.CollisionProfile] should match with this list **/
@@ -26,7 +72,13 @@ DECLARE_LOG_CATEGORY_EXTERN(LogShooterWeapon, Log, All);
 #define COLLISION_PROJECTILE	ECC_GameTraceChannel2
 #define COLLISION_PICKUP		ECC_GameTraceChannel3
 
+/** 0 compiles out particles, sounds and other effects that only present the game, set per target in ShooterGame.Build.cs */
+#ifndef SHOOTER_WITH_COSMETICS
+	#define SHOOTER_WITH_COSMETICS 1
+#endif
+
 #define MAX_PLAYER_NAME_LENGTH 16
+#define MAX_CHAT_MESSAGE_LENGTH 128
 
 
 /** Set to 1 to pretend we're building for console even on a PC, for testing purposes */
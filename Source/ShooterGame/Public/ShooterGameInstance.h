@@ -10,10 +10,10 @@
 #include "ShooterGameInstance.generated.h"
 
 class FVariantData;
-class FShooterMainMenu;
-class FShooterWelcomeMenu;
-class FShooterMessageMenu;
 class AShooterGameSession;
+class FShooterReplayBenchmark;
+class FShooterReplayIndex;
+class IShooterGameInstanceUI;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FStateStartedDelegate, FName, PrevState, FName, NewState);
 
@@ -23,12 +23,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FServerSearchEndedDelegate, bool, b
 
 namespace ShooterGameInstanceState
 {
-	extern const FName None;
-	extern const FName PendingInvite;
-	extern const FName WelcomeScreen;
-	extern const FName MainMenu;
-	extern const FName MessageMenu;
-	extern const FName Playing;
+	extern SHOOTERGAME_API const FName None;
+	extern SHOOTERGAME_API const FName PendingInvite;
+	extern SHOOTERGAME_API const FName WelcomeScreen;
+	extern SHOOTERGAME_API const FName MainMenu;
+	extern SHOOTERGAME_API const FName MessageMenu;
+	extern SHOOTERGAME_API const FName Playing;
 }
 
 /** This class holds the value of what message to display when we are in the "MessageMenu" state */
@@ -67,28 +67,6 @@ struct FShooterPlayTogetherInfo
 	TArray<TSharedPtr<const FUniqueNetId>> UserIdList;
 };
 
-class SShooterWaitDialog : public SCompoundWidget
-{
-public:
-	SLATE_BEGIN_ARGS(SShooterWaitDialog)
-	{}
-	SLATE_ARGUMENT(FText, MessageText)
-	SLATE_END_ARGS()
-
-	void Construct(const FArguments& InArgs);
-
-private:
-
-	/** our curve sequence and the related handles */
-	FCurveSequence WidgetAnimation;
-
-	/** used for animating the text color. */
-	FCurveHandle TextColorCurve;
-
-	/** Gets the animated text color */
-	FSlateColor GetTextColor() const;
-};
-
 UENUM()
 enum class EOnlineMode : uint8
 {
@@ -99,7 +77,7 @@ enum class EOnlineMode : uint8
 
 
 UCLASS(BlueprintType, config=Game)
-class UShooterGameInstance : public UGameInstance
+class SHOOTERGAME_API UShooterGameInstance : public UGameInstance
 {
 public:
 	GENERATED_UCLASS_BODY()
@@ -141,6 +119,18 @@ public:
 	UFUNCTION(BlueprintCallable)
 	bool FindSessions(ULocalPlayer* PlayerOwner, bool bIsDedicatedServer, bool bLANMatch);
 
+	/** Returns the menus, null where the UI module isn't loaded (dedicated servers) */
+	IShooterGameInstanceUI* GetUI() const;
+
+	/** Returns the index of local replays used by the demo browser */
+	TSharedPtr<FShooterReplayIndex> GetReplayIndex() const;
+
+	/** Starts loading the map the match will travel to next in the background, disabled with -NoMapPreload */
+	void PreloadNextMap(const FString& MapPackageName);
+
+	/** Starts timing the load of the map being traveled to, reported once it's loaded */
+	void NotifyMapTravelStarted();
+
 	/** Sends the game to the specified state. */
 	UFUNCTION(BlueprintCallable)
 	void GotoState(FName NewState);
@@ -258,17 +248,27 @@ private:
 	/** Whether the user has an active license to play the game */
 	bool bIsLicensed;
 
-	/** Main menu UI */
-	TSharedPtr<FShooterMainMenu> MainMenuUI;
+	/** Welcome, main and message menus, created by the UI module */
+	TSharedPtr<IShooterGameInstanceUI> GameInstanceUI;
 
-	/** Message menu (Shown in the even of errors - unable to connect etc) */
-	TSharedPtr<FShooterMessageMenu> MessageMenuUI;
+	/** Replay benchmark, only valid when started with -ReplayBenchmark */
+	TSharedPtr<FShooterReplayBenchmark> ReplayBenchmark;
 
-	/** Welcome menu UI (for consoles) */
-	TSharedPtr<FShooterWelcomeMenu> WelcomeMenuUI;
+	/** Cached metadata of local replays, loaded in the background on Init */
+	TSharedPtr<FShooterReplayIndex> ReplayIndex;
 
-	/** Dialog widget to show non-interactive waiting messages for network timeouts and such. */
-	TSharedPtr<SShooterWaitDialog> WaitMessageWidget;
+	/** Next map being preloaded, the world is referenced so it survives the garbage collection of travel */
+	UPROPERTY(Transient)
+	UWorld* PreloadedMapWorld;
+
+	/** Package name of the map being preloaded */
+	FString PreloadMapName;
+
+	/** Time the preload started, 0 once it finished */
+	double PreloadStartTime;
+
+	/** Time travel to a new map started, 0 if no travel is being timed */
+	double MapTravelStartTime;
 
 	/** Controller to ignore for pairing changes. -1 to skip ignore. */
 	int32 IgnorePairingChangeForControllerId;
@@ -304,6 +304,9 @@ private:
 	
 	void OnPreLoadMap(const FString& MapName);
 	void OnPostLoadMap(UWorld*);
+
+	/** Next map finished loading in the background */
+	void OnNextMapPreloaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
 	void OnPostDemoPlay();
 
 	virtual void HandleDemoPlaybackFailure( EDemoPlayFailure::Type FailureType, const FString& ErrorString ) override;
@@ -0,0 +1,124 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Modules/ModuleInterface.h"
+#include "Modules/ModuleManager.h"
+#include "ShooterTypes.h"
+
+class AShooterDemoSpectator;
+class AShooterWeapon;
+class UShooterGameInstance;
+class FShooterPendingMessage;
+
+/** menus owned by the game instance */
+class IShooterGameInstanceUI
+{
+public:
+	virtual ~IShooterGameInstanceUI() {}
+
+	/** welcome screen, on consoles the first player to press a button becomes the owner */
+	virtual void ShowWelcomeMenu() = 0;
+	virtual void HideWelcomeMenu() = 0;
+
+	/** ignores welcome screen input while an online privilege check runs */
+	virtual void LockWelcomeMenu(bool bLock) = 0;
+
+	/** signs in ControllerIndex and leaves the welcome screen for the main menu */
+	virtual void AdvanceWelcomeMenu(int32 ControllerIndex) = 0;
+
+	/** main menu, owned by PlayerOwner */
+	virtual void ShowMainMenu(ULocalPlayer* PlayerOwner) = 0;
+	virtual void HideMainMenu() = 0;
+
+	/** lets the main menu handle a PS4 Play Together event */
+	virtual void NotifyPlayTogether() = 0;
+
+	/** message shown in the "MessageMenu" state */
+	virtual void ShowMessageMenu(const FShooterPendingMessage& Message) = 0;
+	virtual void HideMessageMenu() = 0;
+
+	/** non-interactive message, for network timeouts and such */
+	virtual void ShowWaitMessage(const FText& Message) = 0;
+	virtual void HideWaitMessage() = 0;
+
+	virtual void Tick(float DeltaSeconds) = 0;
+};
+
+/** HUD, in-game menu and Noesis HUD data context of a local player */
+class IShooterPlayerUI
+{
+public:
+	virtual ~IShooterPlayerUI() {}
+
+	virtual void Tick(float DeltaTime) = 0;
+
+	/** in-game menu */
+	virtual void ToggleGameMenu() = 0;
+	virtual bool IsGameMenuUp() const = 0;
+
+	/** scoreboard, see AShooterHUD */
+	virtual void ShowScoreboard(bool bEnable, bool bFocus = false) = 0;
+	virtual void ToggleScoreboard() = 0;
+	virtual void ConditionalCloseScoreboard() = 0;
+
+	virtual bool IsMatchOver() const = 0;
+	virtual void SetMatchState(EShooterMatchState::Type NewState) = 0;
+
+	/** HUD notifications */
+	virtual void ShowDeathMessage(AShooterPlayerState* KillerPlayerState, AShooterPlayerState* VictimPlayerState, const UDamageType* KillerDamageType) = 0;
+	virtual void ShowRecentlyKilled(const FString& VictimName) = 0;
+	virtual void NotifyWeaponHit(float DamageTaken, struct FDamageEvent const& DamageEvent, APawn* PawnInstigator) = 0;
+	virtual void NotifyEnemyHit() = 0;
+	virtual void NotifyOutOfAmmo() = 0;
+
+	/** chat */
+	virtual void ToggleChat() = 0;
+	virtual void AddChatLine(const FText& ChatString) = 0;
+
+	/** refresh the HUD data context */
+	virtual void UpdatePawn(const AShooterCharacter* Pawn) = 0;
+	virtual void UpdateCrosshair(const AShooterCharacter* Pawn) = 0;
+	virtual void UpdateWeapon(const AShooterWeapon* Weapon) = 0;
+	virtual void UpdateScore() = 0;
+};
+
+/** replay HUD and menu of a demo spectator */
+class IShooterDemoUI
+{
+public:
+	virtual ~IShooterDemoUI() {}
+
+	virtual void ToggleGameMenu() = 0;
+
+	/** widget that takes input during playback, null when nothing is shown */
+	virtual TSharedPtr<SWidget> GetFocusWidget() const = 0;
+};
+
+/**
+ * Module interface for the menus, HUD and Slate/Noesis widgets.
+ *
+ * Owned by the game module and implemented by the ClientOnly ShooterGameUI module, which depends on the game.
+ * The game reaches the UI only through Get(), which is null on dedicated servers, so they never load Slate styles,
+ * fonts, textures or Noesis.
+ */
+class IShooterGameUIModule : public IModuleInterface
+{
+public:
+	/** the UI module, null where it isn't loaded */
+	static IShooterGameUIModule* Get()
+	{
+		return FModuleManager::GetModulePtr<IShooterGameUIModule>("ShooterGameUI");
+	}
+
+	/** HUD spawned for shooter players */
+	virtual TSubclassOf<AHUD> GetHUDClass() const = 0;
+
+	virtual TSharedRef<IShooterGameInstanceUI> CreateGameInstanceUI(UShooterGameInstance* GameInstance) = 0;
+	virtual TSharedRef<IShooterPlayerUI> CreatePlayerUI(AShooterPlayerController* PlayerController) = 0;
+	virtual TSharedRef<IShooterDemoUI> CreateDemoUI(AShooterDemoSpectator* DemoSpectator) = 0;
+
+	/** widgets hosted by UShooterGameViewportClient */
+	virtual TSharedRef<SWidget> CreateDialogWidget(TWeakObjectPtr<ULocalPlayer> PlayerOwner, EShooterDialogType::Type DialogType, const FText& Message, const FText& Confirm, const FText& Cancel, const FOnClicked& OnConfirm, const FOnClicked& OnCancel) = 0;
+	virtual TSharedRef<SWidget> CreateLoadingScreenWidget() = 0;
+};
@@ -5,7 +5,7 @@
 #include "ShooterGameUserSettings.generated.h"
 
 UCLASS(BlueprintType)
-class UShooterGameUserSettings : public UGameUserSettings
+class SHOOTERGAME_API UShooterGameUserSettings : public UGameUserSettings
 {
 	GENERATED_UCLASS_BODY()
 
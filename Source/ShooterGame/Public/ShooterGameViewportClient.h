@@ -5,42 +5,9 @@
 #include "ShooterTypes.h"
 #include "ShooterGameViewportClient.generated.h"
 
-class SShooterConfirmationDialog;
-
-struct FShooterGameLoadingScreenBrush : public FSlateDynamicImageBrush, public FGCObject
-{
-	FShooterGameLoadingScreenBrush( const FName InTextureName, const FVector2D& InImageSize )
-		: FSlateDynamicImageBrush( InTextureName, InImageSize )
-	{
-		SetResourceObject(LoadObject<UObject>( NULL, *InTextureName.ToString() ));
-	}
-
-	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
-	{
-		FSlateBrush::AddReferencedObjects(Collector);
-	}
-};
-
-class SShooterLoadingScreen : public SCompoundWidget
-{
-public:
-	SLATE_BEGIN_ARGS(SShooterLoadingScreen) {}
-	SLATE_END_ARGS()
-
-	void Construct(const FArguments& InArgs);
-
-private:
-	EVisibility GetLoadIndicatorVisibility() const
-	{
-		return EVisibility::Visible;
-	}
-
-	/** loading screen image brush */
-	TSharedPtr<FSlateDynamicImageBrush> LoadingScreenBrush;
-};
-
+/** hosts the dialogs and loading screen, their widgets come from IShooterGameUIModule */
 UCLASS(Within=Engine, transient, config=Engine)
-class UShooterGameViewportClient : public UGameViewportClient
+class SHOOTERGAME_API UShooterGameViewportClient : public UGameViewportClient
 {
 	GENERATED_UCLASS_BODY()
 
@@ -62,8 +29,6 @@ public:
 	EShooterDialogType::Type GetDialogType() const;
 	TWeakObjectPtr<ULocalPlayer> GetDialogOwner() const;
 
-	TSharedPtr<SShooterConfirmationDialog> GetDialogWidget() { return DialogWidget; }
-
 	//FTicker Funcs
 	virtual void Tick(float DeltaSeconds) override;	
 
@@ -88,7 +53,13 @@ protected:
 	TSharedPtr<class SWidget>						OldFocusWidget;
 
 	/** Dialog widget to show temporary messages ("Controller disconnected", "Parental Controls don't allow you to play online", etc) */
-	TSharedPtr<SShooterConfirmationDialog>			DialogWidget;
+	TSharedPtr<class SWidget>						DialogWidget;
+
+	/** type of the dialog being shown */
+	EShooterDialogType::Type						DialogType;
+
+	/** The player that owns the dialog. */
+	TWeakObjectPtr<ULocalPlayer>					DialogOwner;
 
-	TSharedPtr<SShooterLoadingScreen>				LoadingScreenWidget;
+	TSharedPtr<class SWidget>						LoadingScreenWidget;
 };
\ No newline at end of file
@@ -13,7 +13,7 @@
 /**
  *	'AllTime' leaderboard read object
  */
-class FShooterAllTimeMatchResultsRead : public FOnlineLeaderboardRead
+class SHOOTERGAME_API FShooterAllTimeMatchResultsRead : public FOnlineLeaderboardRead
 {
 public:
 
@@ -0,0 +1,138 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "NetworkReplayStreaming.h"
+
+/** what the demo browser shows about a replay, without opening it */
+struct FShooterReplayInfo
+{
+	/** stream name, used to play and delete the replay */
+	FString Name;
+
+	/** name shown in the browser */
+	FString FriendlyName;
+
+	/** when recording started (UTC) */
+	FDateTime Timestamp;
+
+	/** replay length */
+	int32 LengthInMS;
+
+	/** size of the replay on disk */
+	int64 SizeInBytes;
+
+	/** map the match was played on, empty if the replay wasn't recorded by this game */
+	FString MapName;
+
+	/** game type option of the match */
+	FString GameType;
+
+	/** kills in the match */
+	int32 NumKills;
+
+	/** player with the highest score */
+	FString TopPlayerName;
+
+	/** score of TopPlayerName */
+	int32 TopPlayerScore;
+
+	/** can be played by this build */
+	bool bCompatible;
+
+	FShooterReplayInfo()
+		: LengthInMS(0)
+		, SizeInBytes(0)
+		, NumKills(0)
+		, TopPlayerScore(0)
+		, bCompatible(true)
+	{
+	}
+};
+
+/**
+ * Local index of recorded replays, kept in Saved/Demos/ReplayIndex.json.
+ *
+ * The demo browser reads the index instead of enumerating and opening every replay. Loading and saving happen on
+ * the thread pool. Match metadata (map, game type, kills) is added by the game mode when a recorded match ends,
+ * and the replay streamer is enumerated in the background at most once per session (or when the player refreshes)
+ * to pick up lengths, sizes, deleted replays and replays recorded elsewhere.
+ */
+class SHOOTERGAME_API FShooterReplayIndex : public TSharedFromThis<FShooterReplayIndex>
+{
+public:
+
+	FShooterReplayIndex();
+	~FShooterReplayIndex();
+
+	/** read the index file in the background */
+	void Load();
+
+	/** has the index file been read */
+	bool IsLoaded() const;
+
+	/** indexed replays, newest first */
+	const TArray<FShooterReplayInfo>& GetReplays() const;
+
+	/** incremented whenever the indexed replays change */
+	int32 GetRevision() const;
+
+	/** add or update a replay recorded by this game */
+	void AddRecordedReplay(const FShooterReplayInfo& ReplayInfo);
+
+	/** forget a deleted replay */
+	void RemoveReplay(const FString& ReplayName);
+
+	/** sync the index with the replay streamer, only once per session unless forced */
+	void Rescan(bool bForce);
+
+	/** is a rescan running */
+	bool IsRescanning() const;
+
+private:
+
+	/** location of the index file */
+	static FString GetIndexFilename();
+
+	/** parse the index file contents */
+	static void ParseIndex(const FString& Json, TArray<FShooterReplayInfo>& OutReplays);
+
+	/** index file loaded on the thread pool */
+	void OnLoaded(const TArray<FShooterReplayInfo>& LoadedReplays);
+
+	/** replays this build can play */
+	void OnEnumerateCompatibleComplete(const FEnumerateStreamsResult& Result);
+
+	/** replays of all versions, merged into the index */
+	void OnEnumerateAllComplete(const FEnumerateStreamsResult& Result);
+
+	/** newest first, bumps the revision and writes the index file in the background */
+	void OnReplaysChanged();
+
+	/** indexed replays */
+	TArray<FShooterReplayInfo> Replays;
+
+	/** names of the compatible replays found by the running rescan */
+	TSet<FString> CompatibleReplayNames;
+
+	/** streamer used for rescans */
+	TSharedPtr<INetworkReplayStreamer> ReplayStreamer;
+
+	/** last write of the index file */
+	TFuture<void> PendingSave;
+
+	/** incremented whenever Replays changes */
+	int32 Revision;
+
+	/** index file has been read */
+	bool bLoaded;
+
+	/** rescan requested before the index file was read */
+	bool bRescanPending;
+
+	/** rescan is running */
+	bool bRescanning;
+
+	/** a rescan finished this session */
+	bool bRescanned;
+};
@@ -69,6 +69,13 @@ namespace EShooterDialogType
 	};
 }
 
+/** event groups added to recorded replays, the demo HUD lists them on the timeline */
+namespace ShooterReplayEvents
+{
+	const TCHAR* const Kill = TEXT("ShooterKill");
+	const TCHAR* const Round = TEXT("ShooterRound");
+}
+
 #define SHOOTER_SURFACE_Default		SurfaceType_Default
 #define SHOOTER_SURFACE_Concrete	SurfaceType1
 #define SHOOTER_SURFACE_Dirt		SurfaceType2
@@ -158,4 +165,30 @@ public:
 	FDamageEvent& GetDamageEvent();
 	void SetDamageEvent(const FDamageEvent& DamageEvent);
 	void EnsureReplication();
-};
\ No newline at end of file
+};
+
+/** chat line queued on the server and sent to clients in batches */
+USTRUCT()
+struct FShooterChatMessage
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** who said it */
+	UPROPERTY()
+	APlayerState* SenderPlayerState;
+
+	/** message text */
+	UPROPERTY()
+	FString Text;
+
+	FShooterChatMessage()
+		: SenderPlayerState(NULL)
+	{
+	}
+
+	FShooterChatMessage(APlayerState* InSenderPlayerState, const FString& InText)
+		: SenderPlayerState(InSenderPlayerState)
+		, Text(InText)
+	{
+	}
+};
@@ -0,0 +1,35 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "ShooterVisibilityBakeCommandlet.generated.h"
+
+/**
+ * Bakes the cell to cell visibility maps used to skip line of sight traces, see FShooterVisibilityMap.
+ *
+ *   UE4Editor-Cmd ShooterGame -run=ShooterVisibilityBake -Map=Sanctuary,Highrise [-CellSize=300]
+ *
+ * Each map is cut into cubic cells. Floors are found with downward traces against static geometry (and kept only
+ * if they are on the navmesh, when the map has one), and every cell between a floor and the top of a standing
+ * character is a baked cell, sampled at several heights from the feet to the top of the head. Two cells see each
+ * other if any trace between their sample points gets through on the visibility or weapon channel, and the result
+ * is dilated by one cell on both ends so points the samples miss are never rejected. Cells with identical visibility
+ * are merged into clusters, and the result is written to Content/Visibility/<Map>.pvs. Rebake whenever the level
+ * geometry changes.
+ */
+UCLASS()
+class UShooterVisibilityBakeCommandlet : public UCommandlet
+{
+	GENERATED_UCLASS_BODY()
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+
+	/** bake the visibility of a map and write its file */
+	bool BakeMap(const FString& MapName, float CellSize);
+
+	/** bake the visibility of a loaded world */
+	bool BakeWorld(UWorld* World, const FString& Filename, float CellSize);
+};
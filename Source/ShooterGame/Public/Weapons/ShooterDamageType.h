@@ -6,7 +6,7 @@
 
 // DamageType class that specifies an icon to display
 UCLASS(const, Blueprintable, BlueprintType)
-class UShooterDamageType : public UDamageType
+class SHOOTERGAME_API UShooterDamageType : public UDamageType
 {
 	GENERATED_UCLASS_BODY()
 
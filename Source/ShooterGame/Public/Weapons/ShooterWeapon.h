@@ -86,7 +86,7 @@ struct FWeaponAnim
 };
 
 UCLASS(Abstract, Blueprintable)
-class AShooterWeapon : public AActor
+class SHOOTERGAME_API AShooterWeapon : public AActor
 {
 	GENERATED_UCLASS_BODY()
 
@@ -95,6 +95,17 @@ class AShooterWeapon : public AActor
 
 	virtual void Destroyed() override;
 
+	/** weapon blueprints are ShooterWeapon primary assets */
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+#if WITH_EDITOR
+	/** collect the bundles of the soft references */
+	virtual void PreSave(const class ITargetPlatform* TargetPlatform) override;
+#endif
+
+	/** counts outgoing RPCs for stat ShooterGame */
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, struct FOutParmRec* OutParms, FFrame* Stack) override;
+
 	//////////////////////////////////////////////////////////////////////////
 	// Ammo
 	
@@ -135,6 +146,12 @@ class AShooterWeapon : public AActor
 	/** [server] weapon was removed from pawn's inventory */
 	virtual void OnLeaveInventory();
 
+	/** [server] weapon is kept for the owner's next life, it stops replicating until then */
+	void OnStored();
+
+	/** [server] weapon is given to the owner's next pawn: replicating again, full ammo and nothing pending */
+	void ResetForReuse();
+
 	/** check if it's currently equipped */
 	bool IsEquipped() const;
 
@@ -308,8 +325,8 @@ protected:
 	FName MuzzleAttachPoint;
 
 	/** FX for muzzle flash */
-	UPROPERTY(EditDefaultsOnly, Category=Effects)
-	UParticleSystem* MuzzleFX;
+	UPROPERTY(EditDefaultsOnly, Category=Effects, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> MuzzleFX;
 
 	/** spawned component for muzzle FX */
 	UPROPERTY(Transient)
@@ -324,36 +341,36 @@ protected:
 	TSubclassOf<UMatineeCameraShake> FireCameraShake;
 
 	/** force feedback effect to play when the weapon is fired */
-	UPROPERTY(EditDefaultsOnly, Category=Effects)
-	UForceFeedbackEffect *FireForceFeedback;
+	UPROPERTY(EditDefaultsOnly, Category=Effects, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UForceFeedbackEffect> FireForceFeedback;
 
 	/** single fire sound (bLoopedFireSound not set) */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* FireSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> FireSound;
 
 	/** looped fire sound (bLoopedFireSound set) */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* FireLoopSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> FireLoopSound;
 
 	/** finished burst sound (bLoopedFireSound set) */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* FireFinishSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> FireFinishSound;
 
 	/** out of ammo sound */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* OutOfAmmoSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> OutOfAmmoSound;
 
 	/** reload sound */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* ReloadSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> ReloadSound;
 
 	/** reload animations */
 	UPROPERTY(EditDefaultsOnly, Category=Animation)
 	FWeaponAnim ReloadAnim;
 
 	/** equip sound */
-	UPROPERTY(EditDefaultsOnly, Category=Sound)
-	USoundCue* EquipSound;
+	UPROPERTY(EditDefaultsOnly, Category=Sound, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<USoundCue> EquipSound;
 
 	/** equip animations */
 	UPROPERTY(EditDefaultsOnly, Category=Animation)
@@ -375,6 +392,12 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category=Animation)
 	uint32 bLoopedFireAnim : 1;
 
+#if WITH_EDITORONLY_DATA
+	/** bundles of the soft references, saved to the asset registry so cooked builds can stream them */
+	UPROPERTY(AssetRegistrySearchable)
+	FAssetBundleData AssetBundleData;
+#endif
+
 	/** is fire animation playing? */
 	uint32 bPlayingFireAnim : 1;
 
@@ -407,11 +430,11 @@ protected:
 	float EquipDuration;
 
 	/** current total ammo */
-	UPROPERTY(Transient, Replicated)
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_Ammo)
 	int32 CurrentAmmo;
 
 	/** current ammo - inside clip */
-	UPROPERTY(Transient, Replicated)
+	UPROPERTY(Transient, ReplicatedUsing=OnRep_Ammo)
 	int32 CurrentAmmoInClip;
 
 	/** burst counter, used for replicating fire events to remote clients */
@@ -430,6 +453,9 @@ protected:
 	/** Handle for efficient management of HandleFiring timer */
 	FTimerHandle TimerHandle_HandleFiring;
 
+	/** Handle for efficient management of OnStoredReplicated timer */
+	FTimerHandle TimerHandle_OnStoredReplicated;
+
 	//////////////////////////////////////////////////////////////////////////
 	// Input - server side
 
@@ -458,6 +484,12 @@ protected:
 	UFUNCTION()
 	void OnRep_Reload();
 
+	UFUNCTION()
+	void OnRep_Ammo();
+
+	/** [local] push ammo state to the owner's HUD view model */
+	void UpdateHUDViewModel();
+
 	/** Called in network play to do the cosmetic fx for firing */
 	virtual void SimulateWeaponFire();
 
@@ -500,12 +532,15 @@ protected:
 	/** detaches weapon mesh from pawn */
 	void DetachMeshFromPawn();
 
+	/** [server] stored weapon stops replicating, once clients got the unequip */
+	void OnStoredReplicated();
+
 
 	//////////////////////////////////////////////////////////////////////////
 	// Weapon usage helpers
 
 	/** play weapon sounds */
-	UAudioComponent* PlayWeaponSound(USoundCue* Sound);
+	UAudioComponent* PlayWeaponSound(const TSoftObjectPtr<USoundCue>& Sound);
 
 	/** play weapon animations */
 	float PlayWeaponAnimation(const FWeaponAnim& Animation);
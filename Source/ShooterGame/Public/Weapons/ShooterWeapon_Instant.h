@@ -80,7 +80,7 @@ struct FInstantWeaponData
 
 // A weapon where the damage impact occurs instantly upon firing
 UCLASS(Abstract)
-class AShooterWeapon_Instant : public AShooterWeapon
+class SHOOTERGAME_API AShooterWeapon_Instant : public AShooterWeapon
 {
 	GENERATED_UCLASS_BODY()
 
@@ -107,8 +107,8 @@ protected:
 	TSubclassOf<AShooterImpactEffect> ImpactTemplate;
 
 	/** smoke trail */
-	UPROPERTY(EditDefaultsOnly, Category=Effects)
-	UParticleSystem* TrailFX;
+	UPROPERTY(EditDefaultsOnly, Category=Effects, meta=(AssetBundles="Client"))
+	TSoftObjectPtr<UParticleSystem> TrailFX;
 
 	/** param name for beam target in smoke trail */
 	UPROPERTY(EditDefaultsOnly, Category=Effects)
@@ -139,6 +139,12 @@ protected:
 	/** continue processing the instant hit, as if it has been confirmed by the server */
 	void ProcessInstantHit_Confirmed(const FHitResult& Impact, const FVector& Origin, const FVector& ShootDir, int32 RandomSeed, float ReticleSpread);
 
+	/** [server] record hit verification result on the instigator's player state, if a pawn was hit */
+	void RecordHitReport(const AActor* HitActor, bool bConfirmed);
+
+	/** [server] record a reported miss on the instigator's player state */
+	void RecordMissReport();
+
 	/** check if weapon should deal damage to actor */
 	bool ShouldDealDamage(AActor* TestActor) const;
 
@@ -13,10 +13,6 @@ public class ShooterGame : ModuleRules
 			new string[] { 
 				"ShooterGame/Private/Player",
 				"ShooterGame/Private",
-				"ShooterGame/Private/UI",
-				"ShooterGame/Private/UI/Menu",
-				"ShooterGame/Private/UI/Style",
-				"ShooterGame/Private/UI/Widgets",
             }
 		);
 
@@ -39,11 +35,11 @@ public class ShooterGame : ModuleRules
 				"InputCore",
 				"Slate",
 				"SlateCore",
-				"ShooterGameLoadingScreen",
 				"Json",
 				"ApplicationCore",
 				"PhysicsCore",
-				"GameplayCameras"
+				"GameplayCameras",
+				"Icmp"
 			}
 		);
 
@@ -52,14 +48,30 @@ public class ShooterGame : ModuleRules
 				"OnlineSubsystemNull",
 				"NetworkReplayStreaming",
 				"NullNetworkReplayStreaming",
-				"HttpNetworkReplayStreaming"
+				"HttpNetworkReplayStreaming",
+				"ShooterReplayStreaming"
 			}
 		);
 
+		// menus, HUD and Noesis live in the ClientOnly ShooterGameUI module, which depends on this one and implements
+		// IShooterGameUIModule from ShooterGameUIInterface.h, so dedicated servers never load the widgets
 		PrivateIncludePathModuleNames.AddRange(
 			new string[] {
 				"NetworkReplayStreaming"
 			}
 		);
+
+		// the loading screen is a ClientOnly module, dedicated servers only see its interface and never load it
+		if (Target.Type == TargetType.Server)
+		{
+			PrivateIncludePathModuleNames.Add("ShooterGameLoadingScreen");
+		}
+		else
+		{
+			PrivateDependencyModuleNames.Add("ShooterGameLoadingScreen");
+		}
+
+		// dedicated servers never play effects or sounds, see SHOOTER_WITH_COSMETICS in ShooterGame.h
+		PublicDefinitions.Add("SHOOTER_WITH_COSMETICS=" + (Target.Type == TargetType.Server ? "0" : "1"));
 	}
 }
@@ -0,0 +1,69 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGameUI.h"
+#include "ShooterGameInstanceUI.h"
+#include "ShooterPlayerUI.h"
+#include "ShooterDemoUI.h"
+#include "UI/ShooterHUD.h"
+#include "UI/Style/ShooterStyle.h"
+#include "SShooterConfirmationDialog.h"
+#include "SShooterLoadingScreen.h"
+
+class FShooterGameUIModule : public IShooterGameUIModule
+{
+	virtual void StartupModule() override
+	{
+		//Hot reload hack
+		FSlateStyleRegistry::UnRegisterSlateStyle(FShooterStyle::GetStyleSetName());
+		FShooterStyle::Initialize();
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FShooterStyle::Shutdown();
+	}
+
+	virtual bool IsGameModule() const override
+	{
+		return true;
+	}
+
+	virtual TSubclassOf<AHUD> GetHUDClass() const override
+	{
+		return AShooterHUD::StaticClass();
+	}
+
+	virtual TSharedRef<IShooterGameInstanceUI> CreateGameInstanceUI(UShooterGameInstance* GameInstance) override
+	{
+		return MakeShareable(new FShooterGameInstanceUI(GameInstance));
+	}
+
+	virtual TSharedRef<IShooterPlayerUI> CreatePlayerUI(AShooterPlayerController* PlayerController) override
+	{
+		return MakeShareable(new FShooterPlayerUI(PlayerController));
+	}
+
+	virtual TSharedRef<IShooterDemoUI> CreateDemoUI(AShooterDemoSpectator* DemoSpectator) override
+	{
+		return MakeShareable(new FShooterDemoUI(DemoSpectator));
+	}
+
+	virtual TSharedRef<SWidget> CreateDialogWidget(TWeakObjectPtr<ULocalPlayer> PlayerOwner, EShooterDialogType::Type DialogType, const FText& Message, const FText& Confirm, const FText& Cancel, const FOnClicked& OnConfirm, const FOnClicked& OnCancel) override
+	{
+		return SNew( SShooterConfirmationDialog )
+			.PlayerOwner(PlayerOwner)
+			.DialogType(DialogType)
+			.MessageText(Message)
+			.ConfirmText(Confirm)
+			.CancelText(Cancel)
+			.OnConfirmClicked(OnConfirm)
+			.OnCancelClicked(OnCancel);
+	}
+
+	virtual TSharedRef<SWidget> CreateLoadingScreenWidget() override
+	{
+		return SNew( SShooterLoadingScreen );
+	}
+};
+
+IMPLEMENT_GAME_MODULE(FShooterGameUIModule, ShooterGameUI);
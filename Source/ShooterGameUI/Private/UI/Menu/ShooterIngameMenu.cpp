@@ -151,7 +151,7 @@ void FShooterIngameMenu::DetachGameMenu()
 		PCOwner->SetPause(false);
 
 		// If the game is over enable the scoreboard
-		AShooterHUD* const ShooterHUD = PCOwner->GetShooterHUD();
+		AShooterHUD* const ShooterHUD = Cast<AShooterHUD>(PCOwner->GetHUD());
 		if( ( ShooterHUD != NULL ) && ( ShooterHUD->IsMatchOver() == true ) && ( PCOwner->IsPrimaryPlayer() == true ) )
 		{
 			ShooterHUD->ShowScoreboard( true, true );
@@ -189,7 +189,7 @@ void FShooterIngameMenu::ToggleGameMenu()
 		// Hide the scoreboard
 		if (PCOwner)
 		{
-			AShooterHUD* const ShooterHUD = PCOwner->GetShooterHUD();
+			AShooterHUD* const ShooterHUD = Cast<AShooterHUD>(PCOwner->GetHUD());
 			if( ShooterHUD != NULL )
 			{
 				ShooterHUD->ShowScoreboard( false );
@@ -231,7 +231,7 @@ void FShooterIngameMenu::ToggleGameMenu()
 			FSlateApplication::Get().SetAllUserFocusToGameViewport();
 
 			// Don't renable controls if the match is over
-			AShooterHUD* const ShooterHUD = PCOwner->GetShooterHUD();
+			AShooterHUD* const ShooterHUD = Cast<AShooterHUD>(PCOwner->GetHUD());
 			if( ( ShooterHUD != NULL ) && ( ShooterHUD->IsMatchOver() == false ) )
 			{
 				PCOwner->SetCinematicMode(false,false,false,true,true);
@@ -9,15 +9,20 @@
 #include "ShooterGameInstance.h"
 #include "NetworkReplayStreaming.h"
 #include "ShooterGameViewportClient.h"
+#include "ShooterReplayIndex.h"
 
 #define LOCTEXT_NAMESPACE "ShooterGame.HUD.Menu"
 
+/** demos shown per page, the list never builds more rows than this */
+static const int32 DemosPerPage = 50;
+
 struct FDemoEntry
 {
-	FNetworkReplayStreamInfo StreamInfo;
+	FShooterReplayInfo Info;
 	FString		Date;
+	FString		Length;
 	FString		Size;
-	int32		ResultsIndex;
+	FText		Summary;
 };
 
 void SShooterDemoList::Construct(const FArguments& InArgs)
@@ -26,12 +31,15 @@ void SShooterDemoList::Construct(const FArguments& InArgs)
 	OwnerWidget			= InArgs._OwnerWidget;
 	bUpdatingDemoList	= false;
 	StatusText			= FText::GetEmpty();
-	
-	EnumerateStreamsVersion = FNetworkVersion::GetReplayVersion();
-
-	const int32 NameWidth		= 280;
-	const int32 ViewersWidth	= 64;
-	const int32 DateWidth		= 210;
+	bShowAllReplays		= false;
+	ReplayIndexRevision	= INDEX_NONE;
+	PageIdx				= 0;
+	NumListedDemos		= 0;
+
+	const int32 NameWidth		= 200;
+	const int32 MapWidth		= 110;
+	const int32 ModeWidth		= 60;
+	const int32 DateWidth		= 190;
 	const int32 LengthWidth		= 64;
 
 	ChildSlot
@@ -70,7 +78,8 @@ void SShooterDemoList::Construct(const FArguments& InArgs)
 				.HeaderRow(
 					SNew(SHeaderRow)
 					+ SHeaderRow::Column("DemoName").FixedWidth(NameWidth).DefaultLabel(NSLOCTEXT("DemoList", "DemoNameColumn", "Demo Name"))
-					+ SHeaderRow::Column("Viewers").FixedWidth(ViewersWidth).DefaultLabel(NSLOCTEXT("Viewers", "ViewersColumn", "Viewers"))
+					+ SHeaderRow::Column("Map").FixedWidth(MapWidth).DefaultLabel(NSLOCTEXT("DemoList", "MapColumn", "Map"))
+					+ SHeaderRow::Column("Mode").FixedWidth(ModeWidth).DefaultLabel(NSLOCTEXT("DemoList", "ModeColumn", "Mode"))
 					+ SHeaderRow::Column("Date").FixedWidth(DateWidth).DefaultLabel(NSLOCTEXT("DemoList", "DateColumn", "Date"))
 					+ SHeaderRow::Column("Length").FixedWidth(LengthWidth).DefaultLabel(NSLOCTEXT("Length", "LengthColumn", "Length"))
 					+ SHeaderRow::Column("Size").HAlignHeader(HAlign_Left).HAlignCell(HAlign_Right).DefaultLabel(NSLOCTEXT("DemoList", "SizeColumn", "Size")))
@@ -78,6 +87,15 @@ void SShooterDemoList::Construct(const FArguments& InArgs)
 		]
 		+SVerticalBox::Slot()
 		.AutoHeight()
+		.HAlign(HAlign_Left)
+		.Padding(FMargin(0.0f, 4.0f, 0.0f, 4.0f))
+		[
+			SNew(STextBlock)
+			.Text(this, &SShooterDemoList::GetSummaryText)
+			.TextStyle(FShooterStyle::Get(), "ShooterGame.MenuServerListTextStyle")
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
 		[
 			SNew(SOverlay)
 			+SOverlay::Slot()
@@ -93,51 +111,22 @@ void SShooterDemoList::Construct(const FArguments& InArgs)
 
 	ReplayStreamer = FNetworkReplayStreaming::Get().GetFactory().CreateReplayStreamer();
 
+	UShooterGameInstance* const GI = PlayerOwner.IsValid() ? Cast<UShooterGameInstance>(PlayerOwner->GetGameInstance()) : nullptr;
+	ReplayIndex = GI ? GI->GetReplayIndex() : nullptr;
+
+	// the list opens with what the index already knows, the once per session rescan updates it in the background
 	BuildDemoList();
+	RefreshDemoList();
 }
 
-void SShooterDemoList::OnEnumerateStreamsComplete(const FEnumerateStreamsResult &Result)
+FText SShooterDemoList::GetBottomText() const
 {
-	check(bUpdatingDemoList); // should not be called otherwise
-
-	bool bFinished = true;
-
-	for ( const auto& StreamInfo : Result.FoundStreams )
-	{
-		float SizeInKilobytes = StreamInfo.SizeInBytes / 1024.0f;
-
-		TSharedPtr<FDemoEntry> NewDemoEntry = MakeShareable( new FDemoEntry() );
-
-		NewDemoEntry->StreamInfo	= StreamInfo;
-		NewDemoEntry->Date			= StreamInfo.Timestamp.ToString( TEXT( "%m/%d/%Y %h:%M %A" ) );	// UTC time
-		NewDemoEntry->Size			= SizeInKilobytes >= 1024.0f ? FString::Printf( TEXT("%2.2f MB" ), SizeInKilobytes / 1024.0f ) : FString::Printf( TEXT("%i KB" ), (int)SizeInKilobytes );
-
-		DemoList.Add( NewDemoEntry );
-	}
-
-	// Sort demo names by date
-	struct FCompareDateTime
-	{
-		FORCEINLINE bool operator()( const TSharedPtr<FDemoEntry> & A, const TSharedPtr<FDemoEntry> & B ) const
-		{
-			return A->StreamInfo.Timestamp.GetTicks() > B->StreamInfo.Timestamp.GetTicks();
-		}
-	};
-
-	Sort( DemoList.GetData(), DemoList.Num(), FCompareDateTime() );
-
-	//StatusText = "";
-	StatusText = LOCTEXT("DemoSelectionInfo","Press ENTER to Play. Press DEL to delete.");
-
-	if ( bFinished )
-	{		
-		OnBuildDemoListFinished();
-	}
+	 return StatusText;
 }
 
-FText SShooterDemoList::GetBottomText() const
+FText SShooterDemoList::GetSummaryText() const
 {
-	 return StatusText;
+	return SelectedItem.IsValid() ? SelectedItem->Summary : FText::GetEmpty();
 }
 
 /**
@@ -150,29 +139,23 @@ FText SShooterDemoList::GetBottomText() const
 void SShooterDemoList::Tick( const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime )
 {
 	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
-}
 
-ECheckBoxState SShooterDemoList::IsShowAllReplaysChecked() const
-{
-	if (EnumerateStreamsVersion.NetworkVersion == 0 && EnumerateStreamsVersion.Changelist == 0)
+	// picks up the index file once loaded, rescans and replays recorded meanwhile
+	if (ReplayIndex.IsValid() && ReplayIndex->IsLoaded() && ReplayIndex->GetRevision() != ReplayIndexRevision)
 	{
-		return ECheckBoxState::Checked;
+		BuildDemoList();
 	}
+}
 
-	return ECheckBoxState::Unchecked;
+ECheckBoxState SShooterDemoList::IsShowAllReplaysChecked() const
+{
+	return bShowAllReplays ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
 void SShooterDemoList::OnShowAllReplaysChecked(ECheckBoxState NewCheckedState)
 {
-	EnumerateStreamsVersion = FNetworkVersion::GetReplayVersion();
-
-	// Always set CL to 0, we only want to ever check NetworkVersion (now that we have backwards compat)
-	EnumerateStreamsVersion.Changelist = 0;
-
-	if (NewCheckedState == ECheckBoxState::Checked)
-	{
-		EnumerateStreamsVersion.NetworkVersion = 0;
-	}
+	bShowAllReplays = NewCheckedState == ECheckBoxState::Checked;
+	PageIdx = 0;
 
 	BuildDemoList();
 }
@@ -180,12 +163,94 @@ void SShooterDemoList::OnShowAllReplaysChecked(ECheckBoxState NewCheckedState)
 /** Populates the demo list */
 void SShooterDemoList::BuildDemoList()
 {
+	DemoList.Empty(DemosPerPage);
+	NumListedDemos = 0;
+
+	if (!ReplayIndex.IsValid() || !ReplayIndex->IsLoaded())
+	{
+		// Tick builds the list once the index file has been read
+		bUpdatingDemoList = true;
+		StatusText = LOCTEXT("LoadingDemos", "LOADING DEMOS...");
+		DemoListWidget->RequestListRefresh();
+		return;
+	}
+
 	bUpdatingDemoList = true;
-	DemoList.Empty();
+	ReplayIndexRevision = ReplayIndex->GetRevision();
+
+	// the index is kept newest first, only the rows of the shown page are built
+	const TArray<FShooterReplayInfo>& Replays = ReplayIndex->GetReplays();
+	const int32 FirstListedIdx = PageIdx * DemosPerPage;
+	for (const FShooterReplayInfo& Info : Replays)
+	{
+		if (!bShowAllReplays && !Info.bCompatible)
+		{
+			continue;
+		}
+
+		const int32 ListedIdx = NumListedDemos++;
+		if (ListedIdx < FirstListedIdx || ListedIdx >= FirstListedIdx + DemosPerPage)
+		{
+			continue;
+		}
+
+		const float SizeInKilobytes = Info.SizeInBytes / 1024.0f;
+
+		TSharedPtr<FDemoEntry> NewDemoEntry = MakeShareable( new FDemoEntry() );
+
+		NewDemoEntry->Info		= Info;
+		NewDemoEntry->Date		= Info.Timestamp.ToString( TEXT( "%m/%d/%Y %h:%M %A" ) );	// UTC time
+		NewDemoEntry->Length	= FString::Printf( TEXT( "%02i:%02i" ), Info.LengthInMS / ( 1000 * 60 ), ( Info.LengthInMS / 1000 ) % 60 );
+		NewDemoEntry->Size		= SizeInKilobytes >= 1024.0f ? FString::Printf( TEXT("%2.2f MB" ), SizeInKilobytes / 1024.0f ) : FString::Printf( TEXT("%i KB" ), (int)SizeInKilobytes );
+
+		if (!Info.TopPlayerName.IsEmpty())
+		{
+			NewDemoEntry->Summary = FText::Format(LOCTEXT("DemoSummaryFmt", "{0} kills, top player {1} with {2} points"), FText::AsNumber(Info.NumKills), FText::FromString(Info.TopPlayerName), FText::AsNumber(Info.TopPlayerScore));
+		}
+
+		DemoList.Add( NewDemoEntry );
+	}
+
+	const int32 NumPages = FMath::Max(1, FMath::DivideAndRoundUp(NumListedDemos, DemosPerPage));
+	if (PageIdx >= NumPages)
+	{
+		// demos were deleted from the last page
+		PageIdx = NumPages - 1;
+		BuildDemoList();
+		return;
+	}
+
+	if (NumListedDemos == 0)
+	{
+		StatusText = ReplayIndex->IsRescanning() ? LOCTEXT("SearchingDemos", "SEARCHING FOR DEMOS...") : LOCTEXT("NoDemos", "NO DEMOS FOUND");
+	}
+	else
+	{
+		StatusText = FText::Format(LOCTEXT("DemoSelectionInfoFmt", "Page {0}/{1}. Press ENTER to Play. Press DEL to delete. LEFT/RIGHT to change page."), FText::AsNumber(PageIdx + 1), FText::AsNumber(NumPages));
+	}
+
+	OnBuildDemoListFinished();
+}
+
+void SShooterDemoList::RefreshDemoList()
+{
+	if (ReplayIndex.IsValid())
+	{
+		// the first call this session does the work, later calls return immediately
+		ReplayIndex->Rescan(false);
+	}
+}
 
-	if ( ReplayStreamer.IsValid() )
+void SShooterDemoList::ChangePage(int32 MoveBy)
+{
+	const int32 NumPages = FMath::Max(1, FMath::DivideAndRoundUp(NumListedDemos, DemosPerPage));
+	const int32 NewPageIdx = FMath::Clamp(PageIdx + MoveBy, 0, NumPages - 1);
+	if (NewPageIdx != PageIdx)
 	{
-		//ReplayStreamer->EnumerateStreams(EnumerateStreamsVersion, FString(), FString(), FEnumerateStreamsCallback::CreateSP(this, &SShooterDemoList::OnEnumerateStreamsComplete));
+		PageIdx = NewPageIdx;
+		SelectedItem.Reset();
+		BuildDemoList();
+		DemoListWidget->RequestScrollIntoView(SelectedItem);
 	}
 }
 
@@ -194,7 +259,13 @@ void SShooterDemoList::OnBuildDemoListFinished()
 {
 	bUpdatingDemoList = false;
 
-	int32 SelectedItemIndex = DemoList.IndexOfByKey(SelectedItem);
+	// entries are rebuilt from the index, keep the selection on the same demo
+	int32 SelectedItemIndex = INDEX_NONE;
+	if (SelectedItem.IsValid())
+	{
+		const FString SelectedName = SelectedItem->Info.Name;
+		SelectedItemIndex = DemoList.IndexOfByPredicate([&SelectedName](const TSharedPtr<FDemoEntry>& Entry) { return Entry->Info.Name == SelectedName; });
+	}
 
 	DemoListWidget->RequestListRefresh();
 	if (DemoList.Num() > 0)
@@ -218,7 +289,7 @@ void SShooterDemoList::PlayDemo()
 
 		if ( GI != NULL )
 		{
-			FString DemoName = SelectedItem->StreamInfo.Name;
+			FString DemoName = SelectedItem->Info.Name;
 
 			// Play the demo
 			GI->PlayDemo( PlayerOwner.Get(), DemoName );
@@ -247,7 +318,7 @@ void SShooterDemoList::DeleteDemo()
 				ShooterViewport->ShowDialog( 
 					PlayerOwner,
 					EShooterDialogType::Generic,
-					FText::Format(LOCTEXT("DeleteDemoFmt", "Delete {0}?"), FText::FromString(SelectedItem->StreamInfo.FriendlyName)),
+					FText::Format(LOCTEXT("DeleteDemoFmt", "Delete {0}?"), FText::FromString(SelectedItem->Info.FriendlyName)),
 					LOCTEXT("EnterYes", "ENTER - YES"),
 					LOCTEXT("EscapeNo", "ESC - NO"),
 					FOnClicked::CreateRaw(this, &SShooterDemoList::OnDemoDeleteConfirm),
@@ -263,9 +334,9 @@ FReply SShooterDemoList::OnDemoDeleteConfirm()
 	if (SelectedItem.IsValid() && ReplayStreamer.IsValid())
 	{
 		bUpdatingDemoList = true;
-		DemoList.Empty();
+		PendingDeleteName = SelectedItem->Info.Name;
 
-		ReplayStreamer->DeleteFinishedStream(SelectedItem->StreamInfo.Name, FDeleteFinishedStreamCallback::CreateSP(this, &SShooterDemoList::OnDeleteFinishedStreamComplete));
+		ReplayStreamer->DeleteFinishedStream(PendingDeleteName, FDeleteFinishedStreamCallback::CreateSP(this, &SShooterDemoList::OnDeleteFinishedStreamComplete));
 	}
 
 	UShooterGameInstance* const GI = Cast<UShooterGameInstance>(PlayerOwner->GetGameInstance());
@@ -300,8 +371,14 @@ FReply SShooterDemoList::OnDemoDeleteCancel()
 	return FReply::Handled();
 }
 
-void SShooterDemoList::OnDeleteFinishedStreamComplete(const FDeleteFinishedStreamResult&)
+void SShooterDemoList::OnDeleteFinishedStreamComplete(const FDeleteFinishedStreamResult& Result)
 {
+	if (Result.WasSuccessful() && ReplayIndex.IsValid())
+	{
+		ReplayIndex->RemoveReplay(PendingDeleteName);
+	}
+	PendingDeleteName.Empty();
+
 	BuildDemoList();
 }
 
@@ -365,7 +442,22 @@ FReply SShooterDemoList::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent&
 	else if (Key == EKeys::SpaceBar || Key == EKeys::Gamepad_FaceButton_Left)
 	{
 		// Refresh demo list
+		if (ReplayIndex.IsValid())
+		{
+			ReplayIndex->Rescan(true);
+		}
 		BuildDemoList();
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::Left || Key == EKeys::Gamepad_DPad_Left || Key == EKeys::Gamepad_LeftShoulder)
+	{
+		ChangePage(-1);
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::Right || Key == EKeys::Gamepad_DPad_Right || Key == EKeys::Gamepad_RightShoulder)
+	{
+		ChangePage(1);
+		Result = FReply::Handled();
 	}
 	else if (Key == EKeys::Up || Key == EKeys::Gamepad_DPad_Up || Key == EKeys::Gamepad_LeftStick_Up)
 	{
@@ -400,7 +492,7 @@ TSharedRef<ITableRow> SShooterDemoList::MakeListViewWidget(TSharedPtr<FDemoEntry
 
 			if (ColumnName == "DemoName")
 			{
-				FString NameString = Item->StreamInfo.FriendlyName.IsEmpty() ? Item->StreamInfo.Name : Item->StreamInfo.FriendlyName;
+				FString NameString = Item->Info.FriendlyName.IsEmpty() ? Item->Info.Name : Item->Info.FriendlyName;
 
 				const int MAX_DEMO_NAME_DISPLAY_LEN = 18;
 				if ( NameString.Len() > MAX_DEMO_NAME_DISPLAY_LEN )
@@ -408,16 +500,15 @@ TSharedRef<ITableRow> SShooterDemoList::MakeListViewWidget(TSharedPtr<FDemoEntry
 					NameString = NameString.Left( MAX_DEMO_NAME_DISPLAY_LEN ) + TEXT( "..." );
 				}
 
-				if (Item->StreamInfo.bIsLive)
-				{
-					NameString += " (Live)";
-				}
-
 				ItemText = FText::FromString(NameString);
 			}
-			else if (ColumnName == "Viewers")
+			else if (ColumnName == "Map")
 			{
-				ItemText = FText::FromString( FString::Printf( TEXT( "%i" ), Item->StreamInfo.NumViewers ) );
+				ItemText = FText::FromString(Item->Info.MapName);
+			}
+			else if (ColumnName == "Mode")
+			{
+				ItemText = FText::FromString(Item->Info.GameType);
 			}
 			else if (ColumnName == "Date")
 			{
@@ -425,10 +516,7 @@ TSharedRef<ITableRow> SShooterDemoList::MakeListViewWidget(TSharedPtr<FDemoEntry
 			}
 			else if (ColumnName == "Length")
 			{
-				const int32 Minutes = Item->StreamInfo.LengthInMS / ( 1000 * 60 );
-				const int32 Seconds = ( Item->StreamInfo.LengthInMS / 1000 ) % 60;
-
-				ItemText = FText::FromString( FString::Printf( TEXT( "%02i:%02i" ), Minutes, Seconds ) );
+				ItemText = FText::FromString(Item->Length);
 			}
 			else if (ColumnName == "Size")
 			{
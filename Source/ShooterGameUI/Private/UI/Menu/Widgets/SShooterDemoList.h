@@ -7,9 +7,9 @@
 #include "ShooterGame.h"
 #include "SShooterMenuWidget.h"
 #include "NetworkReplayStreaming.h"
-#include "Misc/NetworkVersion.h"
 
 struct FDemoEntry;
+class FShooterReplayIndex;
 
 //class declare
 class SShooterDemoList : public SShooterMenuWidget
@@ -50,14 +50,17 @@ public:
 	/** Updates the list until it's completely populated */
 	void UpdateBuildDemoListStatus();
 
-	/** Populates the demo list */
+	/** Populates the demo list with the current page of the replay index */
 	void BuildDemoList();
 
 	/** Called when demo list building finished */
 	void OnBuildDemoListFinished();
 
-	/** Called when we get results from the replay streaming interface */
-	void OnEnumerateStreamsComplete(const FEnumerateStreamsResult &Result);
+	/** Sync the replay index with the replay streamer */
+	void RefreshDemoList();
+
+	/** shows the previous or next page of demos */
+	void ChangePage(int32 MoveBy);
 
 	/** Play chosen demo */
 	void PlayDemo();
@@ -93,8 +96,8 @@ private:
 	/** Callback fired when "show all replay versions" checkbox is changed */
 	void OnShowAllReplaysChecked(ECheckBoxState NewCheckedState);
 
-	/** Version used for enumerating replays. This is manipulated depending on whether we want to show all versions or not. */
-	FNetworkReplayVersion EnumerateStreamsVersion;
+	/** Whether demos recorded by incompatible versions are listed */
+	bool bShowAllReplays;
 
 protected:
 
@@ -113,6 +116,9 @@ protected:
 	/** get current status text */
 	FText GetBottomText() const;
 
+	/** get match summary of the selected demo */
+	FText GetSummaryText() const;
+
 	/** current status text */
 	FText StatusText;
 
@@ -124,6 +130,21 @@ protected:
 
 	/** Network replay streaming interface */
 	TSharedPtr<INetworkReplayStreamer> ReplayStreamer;
+
+	/** Cached replay metadata the list is built from */
+	TSharedPtr<FShooterReplayIndex> ReplayIndex;
+
+	/** Index revision the list was built from */
+	int32 ReplayIndexRevision;
+
+	/** Page of demos shown */
+	int32 PageIdx;
+
+	/** Number of demos passing the version filter */
+	int32 NumListedDemos;
+
+	/** Demo being deleted */
+	FString PendingDeleteName;
 };
 
 
@@ -0,0 +1,640 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "SShooterServerList.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "ShooterStyle.h"
+#include "ShooterGameLoadingScreen.h"
+#include "ShooterGameInstance.h"
+#include "Online/ShooterGameSession.h"
+#include "Algo/BinarySearch.h"
+
+#define LOCTEXT_NAMESPACE "ShooterGame.HUD.Menu"
+
+/** search results turned into list entries per frame, keeps the menu responsive while thousands of results stream in */
+static const int32 MaxServerEntriesAddedPerTick = 64;
+
+/** max ping filter choices in ms, 0 shows all */
+static const int32 PingFilterChoices[] = { 0, 50, 100, 150, 250 };
+
+/** game type filter choices, the first one shows all */
+static const TCHAR* GameTypeFilterChoices[] = { TEXT("Any"), TEXT("FFA"), TEXT("TDM") };
+
+/** columns in the order CycleSortColumn steps through them */
+static const FName SortColumnNames[] = { FName("Ping"), FName("Players"), FName("ServerName"), FName("GameType"), FName("Map") };
+
+void SShooterServerList::Construct(const FArguments& InArgs)
+{
+	PlayerOwner = InArgs._PlayerOwner;
+	OwnerWidget = InArgs._OwnerWidget;
+	MapFilterName = "Any";
+	bSearchingForServers = false;
+	bLANMatchSearch = false;
+	StatusText = FText::GetEmpty();
+	BoxWidth = 125;
+	LastSearchTime = 0.0f;
+	SortColumn = FName("Ping");
+	SortMode = EColumnSortMode::Ascending;
+	PingFilterIdx = 0;
+	GameTypeFilterIdx = 0;
+	bHideFullServers = false;
+	bServerListDirty = false;
+	bSortDirty = false;
+	
+#if PLATFORM_SWITCH
+	MinTimeBetweenSearches = 6.0;
+#else
+	MinTimeBetweenSearches = 0.0;
+#endif
+
+	ChildSlot
+	.VAlign(VAlign_Fill)
+	.HAlign(HAlign_Fill)
+	[
+		SNew(SVerticalBox)
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBox)  
+			.WidthOverride(600)
+			.HeightOverride(300)
+			[
+				SAssignNew(ServerListWidget, SListView<TSharedPtr<FServerEntry>>)
+				.ItemHeight(20)
+				.ListItemsSource(&ServerList)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &SShooterServerList::MakeListViewWidget)
+				.OnSelectionChanged(this, &SShooterServerList::EntrySelectionChanged)
+				.OnMouseButtonDoubleClick(this,&SShooterServerList::OnListItemDoubleClicked)
+				.HeaderRow(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column("ServerName").FixedWidth(BoxWidth*2) .DefaultLabel(NSLOCTEXT("ServerList", "ServerNameColumn", "Server Name"))
+						.SortMode(this, &SShooterServerList::GetColumnSortMode, FName("ServerName")) .OnSort(this, &SShooterServerList::OnColumnSortModeChanged)
+					+ SHeaderRow::Column("GameType") .DefaultLabel(NSLOCTEXT("ServerList", "GameTypeColumn", "Game Type"))
+						.SortMode(this, &SShooterServerList::GetColumnSortMode, FName("GameType")) .OnSort(this, &SShooterServerList::OnColumnSortModeChanged)
+					+ SHeaderRow::Column("Map").DefaultLabel(NSLOCTEXT("ServerList", "MapNameColumn", "Map"))
+						.SortMode(this, &SShooterServerList::GetColumnSortMode, FName("Map")) .OnSort(this, &SShooterServerList::OnColumnSortModeChanged)
+					+ SHeaderRow::Column("Players") .DefaultLabel(NSLOCTEXT("ServerList", "PlayersColumn", "Players"))
+						.SortMode(this, &SShooterServerList::GetColumnSortMode, FName("Players")) .OnSort(this, &SShooterServerList::OnColumnSortModeChanged)
+					+ SHeaderRow::Column("Ping") .DefaultLabel(NSLOCTEXT("ServerList", "NetworkPingColumn", "Ping"))
+						.SortMode(this, &SShooterServerList::GetColumnSortMode, FName("Ping")) .OnSort(this, &SShooterServerList::OnColumnSortModeChanged))
+			]
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBox)
+			.HAlign(HAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &SShooterServerList::GetFilterText)
+				.TextStyle(FShooterStyle::Get(), "ShooterGame.MenuServerListTextStyle")
+			]
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SOverlay)
+			+SOverlay::Slot()
+			.VAlign(VAlign_Center)
+			.HAlign(HAlign_Center)
+			[
+				SNew(SRichTextBlock)
+				.Text(this, &SShooterServerList::GetBottomText)
+				.TextStyle(FShooterStyle::Get(), "ShooterGame.MenuServerListTextStyle")
+				.DecoratorStyleSet(&FShooterStyle::Get())
+				+ SRichTextBlock::ImageDecorator()
+			]
+		]
+		
+	];
+}
+
+/** 
+ * Get the current game session
+ */
+AShooterGameSession* SShooterServerList::GetGameSession() const
+{
+	UShooterGameInstance* const GI = Cast<UShooterGameInstance>(PlayerOwner->GetGameInstance());
+	return GI ? GI->GetGameSession() : nullptr;
+}
+
+/** Updates current search status */
+void SShooterServerList::UpdateSearchStatus()
+{
+	check(bSearchingForServers); // should not be called otherwise
+
+	bool bFinishSearch = true;
+	AShooterGameSession* ShooterSession = GetGameSession();
+	if (ShooterSession)
+	{
+		int32 CurrentSearchIdx, NumSearchResults;
+		EOnlineAsyncTaskState::Type SearchState = ShooterSession->GetSearchResultStatus(CurrentSearchIdx, NumSearchResults);
+
+		UE_LOG(LogOnlineGame, VeryVerbose, TEXT("ShooterSession->GetSearchResultStatus: %s"), EOnlineAsyncTaskState::ToString(SearchState) );
+
+		switch(SearchState)
+		{
+			case EOnlineAsyncTaskState::InProgress:
+				// show sessions as the online subsystem reports them
+				AddNewSearchResults();
+				StatusText = FText::Format(LOCTEXT("SearchingFound","SEARCHING... {0} FOUND"), FText::AsNumber(AllServers.Num()));
+				bFinishSearch = false;
+				break;
+
+			case EOnlineAsyncTaskState::Done:
+				AddNewSearchResults();
+				if (AllServers.Num() < ShooterSession->GetSearchResults().Num())
+				{
+					// keep going until every result made it into the list
+					StatusText = FText::Format(LOCTEXT("SearchingFound","SEARCHING... {0} FOUND"), FText::AsNumber(AllServers.Num()));
+					bFinishSearch = false;
+				}
+				else if (AllServers.Num() == 0)
+				{
+#if PLATFORM_PS4
+					StatusText = LOCTEXT("NoServersFound","NO SERVERS FOUND, PRESS SQUARE TO TRY AGAIN");
+#elif PLATFORM_XBOXONE
+					StatusText = LOCTEXT("NoServersFound","NO SERVERS FOUND, PRESS X TO TRY AGAIN");
+#elif PLATFORM_SWITCH
+					StatusText = LOCTEXT("NoServersFound", "NO SERVERS FOUND, PRESS <img src=\"ShooterGame.Switch.Left\"/> TO TRY AGAIN");
+#else
+					StatusText = LOCTEXT("NoServersFound","NO SERVERS FOUND, PRESS SPACE TO TRY AGAIN");
+#endif
+				}
+				else
+				{
+#if PLATFORM_PS4
+					StatusText = LOCTEXT("ServersRefresh","PRESS SQUARE TO REFRESH SERVER LIST");
+#elif PLATFORM_XBOXONE
+					StatusText = LOCTEXT("ServersRefresh","PRESS X TO REFRESH SERVER LIST");
+#elif PLATFORM_SWITCH
+					StatusText = LOCTEXT("ServersRefresh", "PRESS <img src=\"ShooterGame.Switch.Left\"/> TO REFRESH SERVER LIST");
+#else
+					StatusText = LOCTEXT("ServersRefresh","PRESS SPACE TO REFRESH SERVER LIST");
+#endif
+				}
+				break;
+
+			case EOnlineAsyncTaskState::Failed:
+				// intended fall-through
+			case EOnlineAsyncTaskState::NotStarted:
+				StatusText = FText::GetEmpty();
+				// intended fall-through
+			default:
+				break;
+		}
+	}
+
+	if (bFinishSearch)
+	{		
+		OnServerSearchFinished();
+	}
+}
+
+void SShooterServerList::AddNewSearchResults()
+{
+	AShooterGameSession* ShooterSession = GetGameSession();
+	if (ShooterSession == nullptr)
+	{
+		return;
+	}
+
+	// the online subsystem appends to the live results array while the search is running
+	const TArray<FOnlineSessionSearchResult>& SearchResults = ShooterSession->GetSearchResults();
+	const int32 LastIdx = FMath::Min(SearchResults.Num(), AllServers.Num() + MaxServerEntriesAddedPerTick);
+	for (int32 IdxResult = AllServers.Num(); IdxResult < LastIdx; ++IdxResult)
+	{
+		TSharedPtr<FServerEntry> NewServerEntry = MakeShareable(new FServerEntry());
+
+		const FOnlineSessionSearchResult& Result = SearchResults[IdxResult];
+
+		NewServerEntry->ServerName = Result.Session.OwningUserName;
+		NewServerEntry->Ping = Result.PingInMs;
+		NewServerEntry->MaxPlayers = Result.Session.SessionSettings.NumPublicConnections
+			+ Result.Session.SessionSettings.NumPrivateConnections;
+		NewServerEntry->CurrentPlayers = NewServerEntry->MaxPlayers
+			- Result.Session.NumOpenPublicConnections 
+			- Result.Session.NumOpenPrivateConnections;
+		NewServerEntry->SearchResultsIndex = IdxResult;
+
+		Result.Session.SessionSettings.Get(SETTING_GAMEMODE, NewServerEntry->GameType);
+		Result.Session.SessionSettings.Get(SETTING_MAPNAME, NewServerEntry->MapName);
+
+		AllServers.Add(NewServerEntry);
+
+		// insert in sort order, the list only generates widgets for the rows on screen
+		if (!bServerListDirty && PassesFilters(*NewServerEntry))
+		{
+			const int32 InsertIdx = Algo::UpperBound(ServerList, NewServerEntry, [this](const TSharedPtr<FServerEntry>& A, const TSharedPtr<FServerEntry>& B) { return IsSortedBefore(A, B); });
+			ServerList.Insert(NewServerEntry, InsertIdx);
+			ServerListWidget->RequestListRefresh();
+		}
+	}
+}
+
+void SShooterServerList::OnSearchResultPingUpdated(int32 SearchResultIdx)
+{
+	AShooterGameSession* ShooterSession = GetGameSession();
+	if (ShooterSession && AllServers.IsValidIndex(SearchResultIdx) && ShooterSession->GetSearchResults().IsValidIndex(SearchResultIdx))
+	{
+		AllServers[SearchResultIdx]->Ping = ShooterSession->GetSearchResults()[SearchResultIdx].PingInMs;
+
+		// applied once per tick, pings arrive in bursts
+		bServerListDirty |= PingFilterIdx != 0;
+		bSortDirty |= SortColumn == FName("Ping");
+	}
+}
+
+bool SShooterServerList::PassesFilters(const FServerEntry& Entry) const
+{
+	/** Only filter maps if a specific map is specified */
+	if (MapFilterName != "Any" && Entry.MapName != MapFilterName)
+	{
+		return false;
+	}
+	if (GameTypeFilterIdx != 0 && Entry.GameType != GameTypeFilterChoices[GameTypeFilterIdx])
+	{
+		return false;
+	}
+	if (PingFilterIdx != 0 && Entry.Ping > PingFilterChoices[PingFilterIdx])
+	{
+		return false;
+	}
+	if (bHideFullServers && Entry.CurrentPlayers >= Entry.MaxPlayers)
+	{
+		return false;
+	}
+	return true;
+}
+
+bool SShooterServerList::IsSortedBefore(const TSharedPtr<FServerEntry>& A, const TSharedPtr<FServerEntry>& B) const
+{
+	int32 Compare = 0;
+	if (SortColumn == FName("ServerName"))
+	{
+		Compare = A->ServerName.Compare(B->ServerName, ESearchCase::IgnoreCase);
+	}
+	else if (SortColumn == FName("GameType"))
+	{
+		Compare = A->GameType.Compare(B->GameType, ESearchCase::IgnoreCase);
+	}
+	else if (SortColumn == FName("Map"))
+	{
+		Compare = A->MapName.Compare(B->MapName, ESearchCase::IgnoreCase);
+	}
+	else if (SortColumn == FName("Players"))
+	{
+		Compare = A->CurrentPlayers - B->CurrentPlayers;
+	}
+	else
+	{
+		Compare = A->Ping - B->Ping;
+	}
+
+	if (Compare == 0)
+	{
+		// keep equal entries in the order they were found
+		return A->SearchResultsIndex < B->SearchResultsIndex;
+	}
+	return SortMode == EColumnSortMode::Descending ? Compare > 0 : Compare < 0;
+}
+
+void SShooterServerList::SortServerList()
+{
+	bSortDirty = false;
+
+	ServerList.Sort([this](const TSharedPtr<FServerEntry>& A, const TSharedPtr<FServerEntry>& B) { return IsSortedBefore(A, B); });
+	ServerListWidget->RequestListRefresh();
+}
+
+void SShooterServerList::RebuildServerList()
+{
+	bServerListDirty = false;
+
+	ServerList.Reset();
+	for (const TSharedPtr<FServerEntry>& Entry : AllServers)
+	{
+		if (PassesFilters(*Entry))
+		{
+			ServerList.Add(Entry);
+		}
+	}
+	SortServerList();
+}
+
+EColumnSortMode::Type SShooterServerList::GetColumnSortMode(FName ColumnName) const
+{
+	return ColumnName == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SShooterServerList::OnColumnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnName, EColumnSortMode::Type NewSortMode)
+{
+	SortColumn = ColumnName;
+	SortMode = NewSortMode;
+	SortServerList();
+}
+
+void SShooterServerList::CycleSortColumn()
+{
+	int32 ColumnIdx = 0;
+	for (int32 i = 0; i < UE_ARRAY_COUNT(SortColumnNames); ++i)
+	{
+		if (SortColumnNames[i] == SortColumn)
+		{
+			ColumnIdx = (i + 1) % UE_ARRAY_COUNT(SortColumnNames);
+		}
+	}
+
+	// fullest servers first, everything else ascending
+	SortColumn = SortColumnNames[ColumnIdx];
+	SortMode = SortColumn == FName("Players") ? EColumnSortMode::Descending : EColumnSortMode::Ascending;
+	SortServerList();
+}
+
+FText SShooterServerList::GetFilterText() const
+{
+	const FText PingText = PingFilterIdx != 0 ? FText::Format(LOCTEXT("PingFilterMs", "{0}ms"), FText::AsNumber(PingFilterChoices[PingFilterIdx])) : LOCTEXT("FilterAny", "ANY");
+	const FText GameTypeText = GameTypeFilterIdx != 0 ? FText::FromString(GameTypeFilterChoices[GameTypeFilterIdx]) : LOCTEXT("FilterAny", "ANY");
+	const FText FullText = bHideFullServers ? LOCTEXT("FullServersHidden", "HIDDEN") : LOCTEXT("FullServersShown", "SHOWN");
+
+	return FText::Format(LOCTEXT("ServerListFilters", "SHOWING {0} OF {1}   (P) MAX PING: {2}   (G) MODE: {3}   (F) FULL SERVERS: {4}   (TAB) SORT"),
+		FText::AsNumber(ServerList.Num()), FText::AsNumber(AllServers.Num()), PingText, GameTypeText, FullText);
+}
+
+FText SShooterServerList::GetBottomText() const
+{
+	 return StatusText;
+}
+
+/**
+ * Ticks this widget.  Override in derived classes, but always call the parent implementation.
+ *
+ * @param  InCurrentTime  Current absolute real time
+ * @param  InDeltaTime  Real time passed since last tick
+ */
+void SShooterServerList::Tick( const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime )
+{
+	SCompoundWidget::Tick( AllottedGeometry, InCurrentTime, InDeltaTime );
+
+	if ( bSearchingForServers )
+	{
+		UpdateSearchStatus();
+	}
+
+	if (bServerListDirty)
+	{
+		RebuildServerList();
+	}
+	else if (bSortDirty)
+	{
+		SortServerList();
+	}
+}
+
+/** Starts searching for servers */
+void SShooterServerList::BeginServerSearch(bool bLANMatch, bool bIsDedicatedServer, const FString& InMapFilterName)
+{
+	double CurrentTime = FApp::GetCurrentTime();
+	if (!bLANMatch && CurrentTime - LastSearchTime < MinTimeBetweenSearches)
+	{
+		OnServerSearchFinished();
+	}
+	else
+	{
+		bLANMatchSearch = bLANMatch;
+		bDedicatedServer = bIsDedicatedServer;
+		MapFilterName = InMapFilterName;
+		bSearchingForServers = true;
+		AllServers.Empty();
+		ServerList.Empty();
+		SelectedItem.Reset();
+		LastSearchTime = CurrentTime;
+
+		UShooterGameInstance* const GI = Cast<UShooterGameInstance>(PlayerOwner->GetGameInstance());
+		if (GI)
+		{
+			GI->FindSessions(PlayerOwner.Get(), bIsDedicatedServer, bLANMatchSearch);
+		}
+
+		AShooterGameSession* const ShooterSession = GetGameSession();
+		if (ShooterSession && BoundGameSession != ShooterSession)
+		{
+			if (BoundGameSession.IsValid())
+			{
+				BoundGameSession->OnSearchResultPingUpdated().Remove(PingUpdatedDelegateHandle);
+			}
+			BoundGameSession = ShooterSession;
+			PingUpdatedDelegateHandle = ShooterSession->OnSearchResultPingUpdated().AddSP(this, &SShooterServerList::OnSearchResultPingUpdated);
+		}
+	}
+}
+
+/** Called when server search is finished */
+void SShooterServerList::OnServerSearchFinished()
+{
+	bSearchingForServers = false;
+
+	UpdateServerList();
+}
+
+void SShooterServerList::UpdateServerList()
+{
+	RebuildServerList();
+
+	int32 SelectedItemIndex = ServerList.IndexOfByKey(SelectedItem);
+	if (SelectedItemIndex == INDEX_NONE && !bSearchingForServers)
+	{
+		// default to the session quick match would pick
+		AShooterGameSession* const ShooterSession = GetGameSession();
+		const int32 BestSessionIdx = ShooterSession ? ShooterSession->FindBestSessionIdx() : -1;
+		SelectedItemIndex = ServerList.IndexOfByPredicate([BestSessionIdx](const TSharedPtr<FServerEntry>& Entry) { return Entry->SearchResultsIndex == BestSessionIdx; });
+	}
+
+	if (ServerList.Num() > 0)
+	{
+		ServerListWidget->UpdateSelectionSet();
+		ServerListWidget->SetSelection(ServerList[SelectedItemIndex > -1 ? SelectedItemIndex : 0],ESelectInfo::OnNavigation);
+		ServerListWidget->RequestScrollIntoView(ServerList[SelectedItemIndex > -1 ? SelectedItemIndex : 0]);
+	}
+}
+
+void SShooterServerList::ConnectToServer()
+{
+	if (bSearchingForServers)
+	{
+		// unsafe
+		return;
+	}
+#if WITH_EDITOR
+	if (GIsEditor == true)
+	{
+		return;
+	}
+#endif
+	if (SelectedItem.IsValid())
+	{
+		int ServerToJoin = SelectedItem->SearchResultsIndex;
+
+		if (GEngine && GEngine->GameViewport)
+		{
+			GEngine->GameViewport->RemoveAllViewportWidgets();
+		}
+		
+		UShooterGameInstance* const GI = Cast<UShooterGameInstance>(PlayerOwner->GetGameInstance());
+		if (GI)
+		{
+			GI->JoinSession(PlayerOwner.Get(), ServerToJoin);
+		}
+	}
+}
+
+void SShooterServerList::OnFocusLost( const FFocusEvent& InFocusEvent )
+{
+	if (InFocusEvent.GetCause() != EFocusCause::SetDirectly)
+	{
+		FSlateApplication::Get().SetKeyboardFocus(SharedThis( this ));
+	}
+}
+
+FReply SShooterServerList::OnFocusReceived(const FGeometry& MyGeometry, const FFocusEvent& InFocusEvent)
+{
+	return FReply::Handled().SetUserFocus(ServerListWidget.ToSharedRef(), EFocusCause::SetDirectly).SetUserFocus(SharedThis(this), EFocusCause::SetDirectly, true);
+}
+
+void SShooterServerList::EntrySelectionChanged(TSharedPtr<FServerEntry> InItem, ESelectInfo::Type SelectInfo)
+{
+	SelectedItem = InItem;
+}
+
+void SShooterServerList::OnListItemDoubleClicked(TSharedPtr<FServerEntry> InItem)
+{
+	SelectedItem = InItem;
+	ConnectToServer();
+	FSlateApplication::Get().SetKeyboardFocus(SharedThis(this));
+}
+
+void SShooterServerList::MoveSelection(int32 MoveBy)
+{
+	int32 SelectedItemIndex = ServerList.IndexOfByKey(SelectedItem);
+
+	if (SelectedItemIndex+MoveBy > -1 && SelectedItemIndex+MoveBy < ServerList.Num())
+	{
+		ServerListWidget->SetSelection(ServerList[SelectedItemIndex+MoveBy]);
+		ServerListWidget->RequestScrollIntoView(ServerList[SelectedItemIndex+MoveBy]);
+	}
+}
+
+FReply SShooterServerList::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) 
+{
+	FReply Result = FReply::Unhandled();
+	const FKey Key = InKeyEvent.GetKey();
+	
+	// browsing, sorting and filtering work while results stream in
+	if (Key == EKeys::Tab || Key == EKeys::Gamepad_FaceButton_Top)
+	{
+		CycleSortColumn();
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::P || Key == EKeys::Gamepad_LeftShoulder)
+	{
+		PingFilterIdx = (PingFilterIdx + 1) % UE_ARRAY_COUNT(PingFilterChoices);
+		RebuildServerList();
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::G || Key == EKeys::Gamepad_RightShoulder)
+	{
+		GameTypeFilterIdx = (GameTypeFilterIdx + 1) % UE_ARRAY_COUNT(GameTypeFilterChoices);
+		RebuildServerList();
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::F || Key == EKeys::Gamepad_RightTrigger)
+	{
+		bHideFullServers = !bHideFullServers;
+		RebuildServerList();
+		Result = FReply::Handled();
+	}
+	else if (bSearchingForServers) // lock joining and refreshing
+	{
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::Up || Key == EKeys::Gamepad_DPad_Up || Key == EKeys::Gamepad_LeftStick_Up)
+	{
+		MoveSelection(-1);
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::Down || Key == EKeys::Gamepad_DPad_Down || Key == EKeys::Gamepad_LeftStick_Down)
+	{
+		MoveSelection(1);
+		Result = FReply::Handled();
+	}
+	else if (Key == EKeys::Enter || Key == EKeys::Virtual_Accept)
+	{
+		ConnectToServer();
+		Result = FReply::Handled();
+		FSlateApplication::Get().SetKeyboardFocus(SharedThis(this));
+	}
+	//hit space bar to search for servers again / refresh the list, only when not searching already
+	else if (Key == EKeys::SpaceBar || Key == EKeys::Gamepad_FaceButton_Left)
+	{
+		BeginServerSearch(bLANMatchSearch, bDedicatedServer, MapFilterName);
+	}
+	return Result;
+}
+
+TSharedRef<ITableRow> SShooterServerList::MakeListViewWidget(TSharedPtr<FServerEntry> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	class SServerEntryWidget : public SMultiColumnTableRow< TSharedPtr<FServerEntry> >
+	{
+	public:
+		SLATE_BEGIN_ARGS(SServerEntryWidget){}
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable, TSharedPtr<FServerEntry> InItem)
+		{
+			Item = InItem;
+			SMultiColumnTableRow< TSharedPtr<FServerEntry> >::Construct(FSuperRowType::FArguments(), InOwnerTable);
+		}
+
+		TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName)
+		{
+			FText ItemText = FText::GetEmpty();
+			if (ColumnName == "ServerName")
+			{
+				ItemText = FText::FromString(Item->ServerName + "'s Server");
+			}
+			else if (ColumnName == "GameType")
+			{
+				ItemText = FText::FromString(Item->GameType);
+			}
+			else if (ColumnName == "Map")
+			{
+				ItemText = FText::FromString(Item->MapName);
+			}
+			else if (ColumnName == "Players")
+			{
+				ItemText = FText::Format( FText::FromString("{0}/{1}"), FText::AsNumber(Item->CurrentPlayers), FText::AsNumber(Item->MaxPlayers) );
+			}
+			else if (ColumnName == "Ping")
+			{
+				// QoS pings update while the row is on screen
+				return SNew(STextBlock)
+					.Text(this, &SServerEntryWidget::GetPingText)
+					.TextStyle(FShooterStyle::Get(), "ShooterGame.MenuServerListTextStyle");
+			} 
+			return SNew(STextBlock)
+				.Text(ItemText)
+				.TextStyle(FShooterStyle::Get(), "ShooterGame.MenuServerListTextStyle");
+		}
+
+		FText GetPingText() const
+		{
+			return FText::AsNumber(Item->Ping);
+		}
+
+		TSharedPtr<FServerEntry> Item;
+	};
+	return SNew(SServerEntryWidget, OwnerTable, Item);
+}
+
+#undef LOCTEXT_NAMESPACE
\ No newline at end of file
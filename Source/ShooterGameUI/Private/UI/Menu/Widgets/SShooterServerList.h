@@ -12,11 +12,11 @@ class AShooterGameSession;
 struct FServerEntry
 {
 	FString ServerName;
-	FString CurrentPlayers;
-	FString MaxPlayers;
+	int32 CurrentPlayers;
+	int32 MaxPlayers;
 	FString GameType;
 	FString MapName;
-	FString Ping;
+	int32 Ping;
 	int32 SearchResultsIndex;
 };
 
@@ -81,6 +81,12 @@ public:
 	/** selects item at current + MoveBy index */
 	void MoveSelection(int32 MoveBy);
 
+	/** header sort mode of a column */
+	EColumnSortMode::Type GetColumnSortMode(FName ColumnName) const;
+
+	/** header column clicked */
+	void OnColumnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnName, EColumnSortMode::Type NewSortMode);
+
 	/**
 	 * Ticks this widget.  Override in derived classes, but always call the parent implementation.
 	 *
@@ -107,10 +113,64 @@ protected:
 	/** Minimum time between searches (platform dependent) */
 	double MinTimeBetweenSearches;
 
-	/** action bindings array */
+	/** every search result, in search result order */
+	TArray< TSharedPtr<FServerEntry> > AllServers;
+
+	/** search results passing the filters, in sort order, this is what the list shows */
 	TArray< TSharedPtr<FServerEntry> > ServerList;
 
-	/** action bindings list slate widget */
+	/** column the list is sorted by */
+	FName SortColumn;
+
+	/** sort direction */
+	EColumnSortMode::Type SortMode;
+
+	/** index into the max ping filter choices, 0 shows all */
+	int32 PingFilterIdx;
+
+	/** index into the game type filter choices, 0 shows all */
+	int32 GameTypeFilterIdx;
+
+	/** hide servers without open slots */
+	bool bHideFullServers;
+
+	/** filters or pings changed, ServerList is rebuilt on the next tick */
+	bool bServerListDirty;
+
+	/** pings changed while sorted by ping, ServerList is sorted on the next tick */
+	bool bSortDirty;
+
+	/** handle of the QoS ping update event of the game session */
+	FDelegateHandle PingUpdatedDelegateHandle;
+
+	/** game session the ping update event is bound to */
+	TWeakObjectPtr<AShooterGameSession> BoundGameSession;
+
+	/** add entries for search results that arrived since the last tick, keeping ServerList sorted */
+	void AddNewSearchResults();
+
+	/** refill ServerList from AllServers with the current filters and sort */
+	void RebuildServerList();
+
+	/** sort ServerList with the current sort column and mode */
+	void SortServerList();
+
+	/** does the entry pass the current filters */
+	bool PassesFilters(const FServerEntry& Entry) const;
+
+	/** sort predicate for the current sort column and mode */
+	bool IsSortedBefore(const TSharedPtr<FServerEntry>& A, const TSharedPtr<FServerEntry>& B) const;
+
+	/** QoS ping of a search result changed */
+	void OnSearchResultPingUpdated(int32 SearchResultIdx);
+
+	/** sort by the next column */
+	void CycleSortColumn();
+
+	/** get current sort and filter text */
+	FText GetFilterText() const;
+
+	/** server list slate widget */
 	TSharedPtr< SListView< TSharedPtr<FServerEntry> > > ServerListWidget; 
 
 	/** currently selected list item */
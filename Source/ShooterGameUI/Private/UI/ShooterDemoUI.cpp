@@ -0,0 +1,47 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterDemoUI.h"
+#include "Player/ShooterDemoSpectator.h"
+#include "UI/Menu/ShooterDemoPlaybackMenu.h"
+#include "UI/Widgets/SShooterDemoHUD.h"
+#include "Engine/DemoNetDriver.h"
+
+FShooterDemoUI::FShooterDemoUI(AShooterDemoSpectator* DemoSpectator)
+{
+	// Build menu only after game is initialized
+	DemoPlaybackMenu = MakeShareable( new FShooterDemoPlaybackMenu() );
+	DemoPlaybackMenu->Construct( Cast< ULocalPlayer >( DemoSpectator->Player ) );
+
+	// Create HUD if this is playback
+	UWorld* World = DemoSpectator->GetWorld();
+	if (World != nullptr && World->GetDemoNetDriver() != nullptr && !World->GetDemoNetDriver()->IsServer())
+	{
+		if (GEngine != nullptr && GEngine->GameViewport != nullptr)
+		{
+			DemoHUD = SNew(SShooterDemoHUD)
+				.PlayerOwner(DemoSpectator);
+
+			GEngine->GameViewport->AddViewportWidgetContent(DemoHUD.ToSharedRef());
+		}
+	}
+}
+
+FShooterDemoUI::~FShooterDemoUI()
+{
+	if (GEngine != nullptr && GEngine->GameViewport != nullptr && DemoHUD.IsValid())
+	{
+		// Remove HUD
+		GEngine->GameViewport->RemoveViewportWidgetContent(DemoHUD.ToSharedRef());
+	}
+}
+
+void FShooterDemoUI::ToggleGameMenu()
+{
+	DemoPlaybackMenu->ToggleGameMenu();
+}
+
+TSharedPtr<SWidget> FShooterDemoUI::GetFocusWidget() const
+{
+	return DemoHUD;
+}
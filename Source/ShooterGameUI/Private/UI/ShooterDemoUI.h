@@ -0,0 +1,28 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterGameUI.h"
+
+class FShooterDemoPlaybackMenu;
+class SShooterDemoHUD;
+
+/** replay HUD and menu of a demo spectator, the HUD is only shown during playback */
+class FShooterDemoUI : public IShooterDemoUI
+{
+public:
+
+	FShooterDemoUI(AShooterDemoSpectator* DemoSpectator);
+	virtual ~FShooterDemoUI();
+
+	// IShooterDemoUI interface
+	virtual void ToggleGameMenu() override;
+	virtual TSharedPtr<SWidget> GetFocusWidget() const override;
+
+private:
+
+	/** shooter in-game menu */
+	TSharedPtr<FShooterDemoPlaybackMenu> DemoPlaybackMenu;
+
+	TSharedPtr<SShooterDemoHUD> DemoHUD;
+};
@@ -0,0 +1,133 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterGameInstanceUI.h"
+#include "ShooterGameInstance.h"
+#include "ShooterMainMenu.h"
+#include "ShooterWelcomeMenu.h"
+#include "ShooterMessageMenu.h"
+#include "SShooterWaitDialog.h"
+#include "UI/ShooterMainMenuViewModel.h"
+
+FShooterGameInstanceUI::FShooterGameInstanceUI(UShooterGameInstance* InGameInstance)
+	: GameInstance(InGameInstance)
+	, MainMenuViewModel(nullptr)
+{
+}
+
+UShooterMainMenuViewModel* FShooterGameInstanceUI::GetMainMenuViewModel()
+{
+	if (MainMenuViewModel == nullptr && GameInstance.IsValid())
+	{
+		MainMenuViewModel = NewObject<UShooterMainMenuViewModel>(GameInstance.Get());
+		MainMenuViewModel->Init(GameInstance.Get());
+	}
+	return MainMenuViewModel;
+}
+
+void FShooterGameInstanceUI::ShowWelcomeMenu()
+{
+	check(!WelcomeMenuUI.IsValid());
+	WelcomeMenuUI = MakeShareable(new FShooterWelcomeMenu);
+	WelcomeMenuUI->Construct( GameInstance );
+	WelcomeMenuUI->AddToGameViewport();
+}
+
+void FShooterGameInstanceUI::HideWelcomeMenu()
+{
+	if (WelcomeMenuUI.IsValid())
+	{
+		WelcomeMenuUI->RemoveFromGameViewport();
+		WelcomeMenuUI = nullptr;
+	}
+}
+
+void FShooterGameInstanceUI::LockWelcomeMenu(bool bLock)
+{
+	if (WelcomeMenuUI.IsValid())
+	{
+		WelcomeMenuUI->LockControls(bLock);
+	}
+}
+
+void FShooterGameInstanceUI::AdvanceWelcomeMenu(int32 ControllerIndex)
+{
+	if (WelcomeMenuUI.IsValid())
+	{
+		WelcomeMenuUI->SetControllerAndAdvanceToMainMenu(ControllerIndex);
+	}
+}
+
+void FShooterGameInstanceUI::ShowMainMenu(ULocalPlayer* PlayerOwner)
+{
+	MainMenuUI = MakeShareable(new FShooterMainMenu());
+	MainMenuUI->Construct(GameInstance, PlayerOwner);
+	MainMenuUI->AddMenuToGameViewport();
+}
+
+void FShooterGameInstanceUI::HideMainMenu()
+{
+	if (MainMenuUI.IsValid())
+	{
+		MainMenuUI->RemoveMenuFromGameViewport();
+		MainMenuUI = nullptr;
+	}
+}
+
+void FShooterGameInstanceUI::NotifyPlayTogether()
+{
+	if (MainMenuUI.IsValid())
+	{
+		MainMenuUI->OnPlayTogetherEventReceived();
+	}
+}
+
+void FShooterGameInstanceUI::ShowMessageMenu(const FShooterPendingMessage& Message)
+{
+	check(!MessageMenuUI.IsValid());
+	MessageMenuUI = MakeShareable(new FShooterMessageMenu);
+	MessageMenuUI->Construct(GameInstance, Message.PlayerOwner, Message.DisplayString, Message.OKButtonString, Message.CancelButtonString, Message.NextState);
+}
+
+void FShooterGameInstanceUI::HideMessageMenu()
+{
+	if (MessageMenuUI.IsValid())
+	{
+		MessageMenuUI->RemoveFromGameViewport();
+		MessageMenuUI = nullptr;
+	}
+}
+
+void FShooterGameInstanceUI::ShowWaitMessage(const FText& Message)
+{
+	WaitMessageWidget = SNew(SShooterWaitDialog)
+		.MessageText(Message);
+
+	if (GEngine && GEngine->GameViewport)
+	{
+		UGameViewportClient* const GVC = GEngine->GameViewport;
+		GVC->AddViewportWidgetContent(WaitMessageWidget.ToSharedRef());
+	}
+}
+
+void FShooterGameInstanceUI::HideWaitMessage()
+{
+	if (GEngine && GEngine->GameViewport && WaitMessageWidget.IsValid())
+	{
+		UGameViewportClient* const GVC = GEngine->GameViewport;
+		GVC->RemoveViewportWidgetContent(WaitMessageWidget.ToSharedRef());
+	}
+}
+
+void FShooterGameInstanceUI::Tick(float DeltaSeconds)
+{
+	if (MainMenuViewModel)
+	{
+		MainMenuViewModel->Tick(DeltaSeconds);
+	}
+}
+
+void FShooterGameInstanceUI::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(MainMenuViewModel);
+}
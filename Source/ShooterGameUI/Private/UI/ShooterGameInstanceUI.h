@@ -0,0 +1,60 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterGameUI.h"
+#include "UObject/GCObject.h"
+
+class FShooterMainMenu;
+class FShooterWelcomeMenu;
+class FShooterMessageMenu;
+class SShooterWaitDialog;
+class UShooterMainMenuViewModel;
+
+/** welcome, main and message menus of the shooter game instance */
+class FShooterGameInstanceUI : public IShooterGameInstanceUI, public FGCObject
+{
+public:
+
+	FShooterGameInstanceUI(UShooterGameInstance* InGameInstance);
+
+	/** Returns the data context for the Noesis main menu, created on first use. */
+	UShooterMainMenuViewModel* GetMainMenuViewModel();
+
+	// IShooterGameInstanceUI interface
+	virtual void ShowWelcomeMenu() override;
+	virtual void HideWelcomeMenu() override;
+	virtual void LockWelcomeMenu(bool bLock) override;
+	virtual void AdvanceWelcomeMenu(int32 ControllerIndex) override;
+	virtual void ShowMainMenu(ULocalPlayer* PlayerOwner) override;
+	virtual void HideMainMenu() override;
+	virtual void NotifyPlayTogether() override;
+	virtual void ShowMessageMenu(const FShooterPendingMessage& Message) override;
+	virtual void HideMessageMenu() override;
+	virtual void ShowWaitMessage(const FText& Message) override;
+	virtual void HideWaitMessage() override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	// FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+private:
+
+	/** owning game instance */
+	TWeakObjectPtr<UShooterGameInstance> GameInstance;
+
+	/** Main menu UI */
+	TSharedPtr<FShooterMainMenu> MainMenuUI;
+
+	/** Message menu (Shown in the even of errors - unable to connect etc) */
+	TSharedPtr<FShooterMessageMenu> MessageMenuUI;
+
+	/** Welcome menu UI (for consoles) */
+	TSharedPtr<FShooterWelcomeMenu> WelcomeMenuUI;
+
+	/** Dialog widget to show non-interactive waiting messages for network timeouts and such. */
+	TSharedPtr<SShooterWaitDialog> WaitMessageWidget;
+
+	/** Data context for the Noesis main menu */
+	UShooterMainMenuViewModel* MainMenuViewModel;
+};
@@ -9,6 +9,7 @@
 #include "Weapons/ShooterDamageType.h"
 #include "Weapons/ShooterWeapon_Instant.h"
 #include "Online/ShooterPlayerState.h"
+#include "Player/ShooterDemoSpectator.h"
 #include "Misc/NetworkVersion.h"
 
 
@@ -28,26 +29,25 @@ AShooterHUD::AShooterHUD(const FObjectInitializer& ObjectInitializer) : Super(Ob
 
 	OnPlayerTalkingStateChangedDelegate = FOnPlayerTalkingStateChangedDelegate::CreateUObject(this, &AShooterHUD::OnPlayerTalkingStateChanged);
 
-	static ConstructorHelpers::FObjectFinder<UTexture2D> HitTextureOb(TEXT("/Game/UI/HUD/HitIndicator"));
-	static ConstructorHelpers::FObjectFinder<UTexture2D> HUDMainTextureOb(TEXT("/Game/UI/HUD/HUDMain"));
-	static ConstructorHelpers::FObjectFinder<UTexture2D> HUDAssets02TextureOb(TEXT("/Game/UI/HUD/HUDAssets02"));
-	static ConstructorHelpers::FObjectFinder<UTexture2D> LowHealthOverlayTextureOb(TEXT("/Game/UI/HUD/LowHealthOverlay"));
-
-	// Fonts are not included in dedicated server builds.
+	// Fonts and textures are not included in dedicated server builds, the HUD is only spawned on clients.
 	#if !UE_SERVER
 	{
+		static ConstructorHelpers::FObjectFinder<UTexture2D> HitTextureOb(TEXT("/Game/UI/HUD/HitIndicator"));
+		static ConstructorHelpers::FObjectFinder<UTexture2D> HUDMainTextureOb(TEXT("/Game/UI/HUD/HUDMain"));
+		static ConstructorHelpers::FObjectFinder<UTexture2D> HUDAssets02TextureOb(TEXT("/Game/UI/HUD/HUDAssets02"));
+		static ConstructorHelpers::FObjectFinder<UTexture2D> LowHealthOverlayTextureOb(TEXT("/Game/UI/HUD/LowHealthOverlay"));
 		static ConstructorHelpers::FObjectFinder<UFont> BigFontOb(TEXT("/Game/UI/HUD/Roboto51"));
 		static ConstructorHelpers::FObjectFinder<UFont> NormalFontOb(TEXT("/Game/UI/HUD/Roboto18"));
 		BigFont = BigFontOb.Object;
 		NormalFont = NormalFontOb.Object;
+
+		HitNotifyTexture = HitTextureOb.Object;
+		HUDMainTexture = HUDMainTextureOb.Object;
+		HUDAssets02Texture = HUDAssets02TextureOb.Object;
+		LowHealthOverlayTexture = LowHealthOverlayTextureOb.Object;
 	}
 	#endif //!UE_SERVER
 
-	HitNotifyTexture = HitTextureOb.Object;
-	HUDMainTexture = HUDMainTextureOb.Object;
-	HUDAssets02Texture = HUDAssets02TextureOb.Object;
-	LowHealthOverlayTexture = LowHealthOverlayTextureOb.Object;
-
 	HitNotifyIcon[EShooterHudPosition::Left] = UCanvas::MakeIcon(HitNotifyTexture,  158, 831, 585, 392);	
 	HitNotifyIcon[EShooterHudPosition::FrontLeft] = UCanvas::MakeIcon(HitNotifyTexture, 369, 434, 460, 378);	
 	HitNotifyIcon[EShooterHudPosition::Front] = UCanvas::MakeIcon(HitNotifyTexture,  848, 284, 361, 395);	
@@ -94,12 +94,23 @@ AShooterHUD::AShooterHUD(const FObjectInitializer& ObjectInitializer) : Super(Ob
 	HUDLight = FColor(175,202,213,255);
 	HUDDark = FColor(110,124,131,255);
 	ShadowedFont.bEnableShadow = true;
+	CachedScaleUI = 0.0f;
+	CachedRankedPos = 0;
+	CachedNumPositions = 0;
+	bRankingDirty = true;
 }
 
 void AShooterHUD::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	ConditionalCloseScoreboard(true);
 
+	if (BoundGameState.IsValid())
+	{
+		BoundGameState->OnPlayerScoreChanged().Remove(PlayerScoreChangedHandle);
+	}
+	PlayerScoreChangedHandle.Reset();
+	BoundGameState = nullptr;
+
 	AShooterPlayerController* ShooterPC = Cast<AShooterPlayerController>(PlayerOwner);
 	if (ShooterPC != NULL )
 	{
@@ -131,6 +142,89 @@ FString AShooterHUD::GetTimeString(float TimeSeconds)
 	return TimeDesc;
 }
 
+void AShooterHUD::UpdateCachedText(FShooterHUDText& CachedText, int64 NewValue, UFont* Font, TFunctionRef<FText()> FormatText)
+{
+	if (CachedText.NeedsUpdate(NewValue))
+	{
+		CachedText.Text = FormatText();
+		CachedText.Value = NewValue;
+		CachedText.bValid = true;
+		Canvas->StrLen(Font, CachedText.Text.ToString(), CachedText.Size.X, CachedText.Size.Y);
+
+		SHOOTER_INC_COUNTER(HUDTextRebuilds);
+	}
+}
+
+void AShooterHUD::InvalidateCachedTexts()
+{
+	FShooterHUDText* const CachedTexts[] = { &KillsLabelText, &KillsText, &MatchTimerText, &WarmupText, &PositionText, &AmmoInClipText,
+		&AmmoInPocketText, &SecondaryAmmoText, &RespawnText, &NoAmmoText, &RecentlyKilledText, &NetModeText };
+	for (FShooterHUDText* CachedText : CachedTexts)
+	{
+		CachedText->bValid = false;
+	}
+}
+
+void AShooterHUD::BindToGameState()
+{
+	AShooterGameState* const GameState = GetWorld()->GetGameState<AShooterGameState>();
+	if (GameState == BoundGameState.Get() && (GameState != nullptr || !BoundGameState.IsStale()))
+	{
+		return;
+	}
+
+	if (BoundGameState.IsValid())
+	{
+		BoundGameState->OnPlayerScoreChanged().Remove(PlayerScoreChangedHandle);
+	}
+	PlayerScoreChangedHandle.Reset();
+
+	BoundGameState = GameState;
+	if (GameState)
+	{
+		PlayerScoreChangedHandle = GameState->OnPlayerScoreChanged().AddUObject(this, &AShooterHUD::OnPlayerScoreChanged);
+	}
+	bRankingDirty = true;
+}
+
+void AShooterHUD::OnPlayerScoreChanged(AShooterPlayerState* PlayerState)
+{
+	// also broadcast when players join, leave or change teams
+	bRankingDirty = true;
+}
+
+void AShooterHUD::UpdateRanking(AShooterGameState* MyGameState, AShooterPlayerState* MyPlayerState)
+{
+	if (!bRankingDirty)
+	{
+		return;
+	}
+	bRankingDirty = false;
+
+	CachedRankedPos = 0;
+	CachedNumPositions = 0;
+	if (MyGameState->NumTeams > 1) // team based game
+	{
+		for (int32 i=0; i < MyGameState->NumTeams; i++)
+		{
+			RankedPlayerMap PlayerStateMap;
+			MyGameState->GetRankedMap(i,PlayerStateMap);
+			if(PlayerStateMap.Num() > 0)
+			{
+				CachedNumPositions++;
+			}
+		}
+	}
+	else // free for all
+	{
+		RankedPlayerMap PlayerStateMap;
+		MyGameState->GetRankedMap(0,PlayerStateMap);
+		const int32* MyRank = PlayerStateMap.FindKey(MyPlayerState);
+		CachedRankedPos = MyRank ? *MyRank + 1 : 0;
+		CachedNumPositions = PlayerStateMap.Num();
+	}
+}
+
 void AShooterHUD::DrawWeaponHUD()
 {
 	AShooterCharacter* MyPawn = CastChecked<AShooterCharacter>(GetOwningPawn());
@@ -176,27 +270,25 @@ void AShooterHUD::DrawWeaponHUD()
 			Canvas->DrawIcon(MyWeapon->PrimaryIcon, PriWeapPosX, PriWeapPosY, ScaleUI);
 
 			const float TextOffset = 12;
-			float SizeX, SizeY;
-			float TopTextHeight;
-			FString Text = FString::FromInt(MyWeapon->GetCurrentAmmoInClip());
-
-			Canvas->StrLen(BigFont, Text, SizeX, SizeY);
+			const int32 AmmoInClip = MyWeapon->GetCurrentAmmoInClip();
+			UpdateCachedText(AmmoInClipText, AmmoInClip, BigFont, [AmmoInClip]() { return FText::FromString(FString::FromInt(AmmoInClip)); });
 
 			const float TopTextScale = 0.73f; // of 51pt font
-			const float TopTextPosX = Canvas->ClipX - Canvas->OrgX - (PriWeaponBoxWidth + Offset * 2 + (BoxWidth + SizeX * TopTextScale) / 2.0f)  * ScaleUI;
+			const float TopTextPosX = Canvas->ClipX - Canvas->OrgX - (PriWeaponBoxWidth + Offset * 2 + (BoxWidth + AmmoInClipText.Size.X * TopTextScale) / 2.0f)  * ScaleUI;
 			const float TopTextPosY = Canvas->ClipY - Canvas->OrgY - (PriWeapOffsetY + PrimaryWeapBg.VL + Offset - TextOffset / 2.0f) * ScaleUI; 
-			TextItem.Text = FText::FromString( Text );
+			TextItem.Text = AmmoInClipText.Text;
 			TextItem.Scale = FVector2D( TopTextScale * ScaleUI, TopTextScale * ScaleUI );
 			TextItem.FontRenderInfo = ShadowedFont;
 			Canvas->DrawItem( TextItem, TopTextPosX, TopTextPosY );
-			TopTextHeight = SizeY * TopTextScale;
-			Text = FString::FromInt(MyWeapon->GetCurrentAmmo() - MyWeapon->GetCurrentAmmoInClip());
-			Canvas->StrLen(BigFont, Text, SizeX, SizeY);
+			const float TopTextHeight = AmmoInClipText.Size.Y * TopTextScale;
+
+			const int32 AmmoInPocket = MyWeapon->GetCurrentAmmo() - AmmoInClip;
+			UpdateCachedText(AmmoInPocketText, AmmoInPocket, BigFont, [AmmoInPocket]() { return FText::FromString(FString::FromInt(AmmoInPocket)); });
 
 			const float BottomTextScale = 0.49f; // of 51pt font
-			const float BottomTextPosX = Canvas->ClipX - Canvas->OrgX - (PriWeaponBoxWidth + Offset * 2 + (BoxWidth + SizeX * BottomTextScale) / 2.0f) * ScaleUI; 
+			const float BottomTextPosX = Canvas->ClipX - Canvas->OrgX - (PriWeaponBoxWidth + Offset * 2 + (BoxWidth + AmmoInPocketText.Size.X * BottomTextScale) / 2.0f) * ScaleUI; 
 			const float BottomTextPosY = TopTextPosY + (TopTextHeight - 0.8f * TextOffset) * ScaleUI;
-			TextItem.Text = FText::FromString( Text );
+			TextItem.Text = AmmoInPocketText.Text;
 			TextItem.Scale = FVector2D( BottomTextScale*ScaleUI, BottomTextScale * ScaleUI );
 			TextItem.FontRenderInfo = ShadowedFont;
 			Canvas->DrawItem( TextItem, BottomTextPosX, BottomTextPosY );
@@ -295,19 +387,16 @@ void AShooterHUD::DrawWeaponHUD()
 			Canvas->SetDrawColor(FColor::White);
 			Canvas->DrawIcon(SecondaryWeapon->SecondaryIcon, SecWeapPosX, SecWeapPosY, ScaleUI);
 
-			const float TextOffset = 10;
-			float SizeX, SizeY;
-			float TopTextHeight;
-			FString Text = FString::FromInt(SecondaryWeapon->GetCurrentAmmo());
+			const int32 SecondaryAmmo = SecondaryWeapon->GetCurrentAmmo();
+			UpdateCachedText(SecondaryAmmoText, SecondaryAmmo, BigFont, [SecondaryAmmo]() { return FText::FromString(FString::FromInt(SecondaryAmmo)); });
 
-			Canvas->StrLen(BigFont,Text, SizeX, SizeY);
 			const float TopTextScale = 0.53f; // of 51pt font
-			TopTextHeight = SizeY * TopTextScale;
+			const float TopTextHeight = SecondaryAmmoText.Size.Y * TopTextScale;
 
-			const float TopTextPosX = Canvas->ClipX - Canvas->OrgX - (SecWeaponBoxWidth + Offset * 2 + (SecClipBoxWidth + SizeX * TopTextScale) / 2.0f)  * ScaleUI;
+			const float TopTextPosX = Canvas->ClipX - Canvas->OrgX - (SecWeaponBoxWidth + Offset * 2 + (SecClipBoxWidth + SecondaryAmmoText.Size.X * TopTextScale) / 2.0f)  * ScaleUI;
 			const float TopTextPosY = SecWeapBgPosY + (SecondaryWeapBg.VL - TopTextHeight) / 2.0f * ScaleUI; 
 
-			TextItem.Text = FText::FromString( Text );
+			TextItem.Text = SecondaryAmmoText.Text;
 			TextItem.Scale = FVector2D( TopTextScale * ScaleUI, TopTextScale * ScaleUI );
 			Canvas->DrawItem( TextItem, TopTextPosX, TopTextPosY );
 		}
@@ -335,6 +424,8 @@ void AShooterHUD::DrawHealth()
 
 void AShooterHUD::DrawMatchTimerAndPosition()
 {
+	BindToGameState();
+
 	AShooterGameState* const MyGameState = GetWorld()->GetGameState<AShooterGameState>();
 	Canvas->SetDrawColor(FColor::White);
 	const float TimerPosX = Canvas->ClipX - Canvas->OrgX - (TimePlaceBg.UL + Offset) * ScaleUI;
@@ -349,43 +440,45 @@ void AShooterHUD::DrawMatchTimerAndPosition()
 	{
 		FCanvasTextItem TextItem( FVector2D::ZeroVector, FText::GetEmpty(), BigFont, HUDDark );
 		TextItem.EnableShadow( FLinearColor::Black );
-		float SizeX, SizeY;
 		float TextScale = 0.57f;
-		FString Text;
+		const int32 RemainingTime = MyGameState->RemainingTime;
 		TextItem.FontRenderInfo = ShadowedFont;
 		TextItem.Scale = FVector2D( TextScale*ScaleUI, TextScale*ScaleUI );
 		if (MyGameState->GetMatchState() == MatchState::WaitingToStart)
 		{
+			UpdateCachedText(WarmupText, RemainingTime, BigFont, [RemainingTime]() { return FText::FromString(LOCTEXT("WarmupString","MATCH STARTS IN: ").ToString() + FString::FromInt(RemainingTime)); });
+
 			TextItem.Scale = FVector2D( ScaleUI, ScaleUI );
-			Text = LOCTEXT("WarmupString","MATCH STARTS IN: ").ToString() + FString::FromInt(MyGameState->RemainingTime);
 			TextItem.SetColor( HUDLight );
-			TextItem.Text = FText::FromString( Text );			
-			AddMatchInfoString(TextItem);
+			TextItem.Text = WarmupText.Text;
+			AddMatchInfoString(TextItem, WarmupText.Size);
 		}
 		else if (MyGameState->GetMatchState() == MatchState::InProgress)
 		{
-			Text = GetTimeString(MyGameState->RemainingTime);
-			Canvas->StrLen(BigFont, Text, SizeX, SizeY);
+			UpdateCachedText(MatchTimerText, RemainingTime, BigFont, [this, RemainingTime]() { return FText::FromString(GetTimeString(RemainingTime)); });
 
 			TextItem.SetColor( HUDDark );
-			TextItem.Text = FText::FromString( Text );
+			TextItem.Text = MatchTimerText.Text;
 			TextItem.Position = FVector2D( TimerPosX + Offset * 1.5f * ScaleUI + TimerIcon.UL * ScaleUI,
-				TimerPosY + (TimePlaceBg.VL * ScaleUI - SizeY * TextScale * ScaleUI) / 2 );
+				TimerPosY + (TimePlaceBg.VL * ScaleUI - MatchTimerText.Size.Y * TextScale * ScaleUI) / 2 );
 			Canvas->DrawItem(TextItem);
 		}
 
 		float BoxWidth = 45.0f * ScaleUI;
-		Text = FString();
 		AShooterPlayerController* MyPC = Cast<AShooterPlayerController>(PlayerOwner);
 		if (MyPC && MyGameState && MatchState == EShooterMatchState::Playing)
 		{
 			AShooterPlayerState* MyPlayerState = Cast<AShooterPlayerState>(MyPC->PlayerState);
 			if (MyPlayerState)
 			{
+				UpdateRanking(MyGameState, MyPlayerState);
+
+				int32 MyPos = 0;
+				const int32 NumPositions = CachedNumPositions;
 				if (MyGameState->NumTeams > 1) // team based game
 				{
 					int32 MyTeam = MyPlayerState->GetTeamNum();
-					int32 MyPos = FMath::Max(1, MyGameState->TeamScores.Num());
+					MyPos = FMath::Max(1, MyGameState->TeamScores.Num());
 					for (int32 i=0; i < MyGameState->TeamScores.Num(); i++)
 					{
 						if (MyGameState->TeamScores.Num() > MyTeam &&
@@ -394,36 +487,24 @@ void AShooterHUD::DrawMatchTimerAndPosition()
 							MyPos--;
 						}
 					}
-					int32 NumTeams = 0;
-					for (int32 i=0; i < MyGameState->NumTeams; i++)
-					{
-						RankedPlayerMap PlayerStateMap;
-						MyGameState->GetRankedMap(i,PlayerStateMap);
-						if(PlayerStateMap.Num() > 0)
-						{
-							NumTeams++;
-						}
-					}
-					Text = FString::Printf(TEXT("%d/%d"), MyPos, NumTeams);
 				}
 				else // free for all
 				{
-					RankedPlayerMap PlayerStateMap;
-					MyGameState->GetRankedMap(0,PlayerStateMap);
-					const int32* MyRank = PlayerStateMap.FindKey(MyPlayerState);
-					int32 MyPos = MyRank ? *MyRank + 1 : 0;
-					Text = FString::Printf(TEXT("%d/%d"), MyPos, PlayerStateMap.Num());
+					MyPos = CachedRankedPos;
 				}
-				Canvas->StrLen(BigFont, Text, SizeX, SizeY);
+
+				const int64 PositionKey = ((int64)MyPos << 32) | (uint32)NumPositions;
+				UpdateCachedText(PositionText, PositionKey, BigFont, [MyPos, NumPositions]() { return FText::FromString(FString::Printf(TEXT("%d/%d"), MyPos, NumPositions)); });
+
 				Canvas->DrawIcon(PlaceIcon,
-					Canvas->ClipX - Canvas->OrgX - BoxWidth  - (SizeX * TextScale + PlaceIcon.UL + Offset/4) * ScaleUI,
+					Canvas->ClipX - Canvas->OrgX - BoxWidth  - (PositionText.Size.X * TextScale + PlaceIcon.UL + Offset/4) * ScaleUI,
 					TimerPosY + (TimePlaceBg.VL - PlaceIcon.VL) / 2.0f * ScaleUI, ScaleUI);
 
-				TextItem.Text = FText::FromString( Text);
+				TextItem.Text = PositionText.Text;
 				TextItem.Scale = FVector2D(TextScale*ScaleUI, TextScale*ScaleUI);
 				TextItem.FontRenderInfo = ShadowedFont;
-				Canvas->DrawItem( TextItem, Canvas->ClipX - Canvas->OrgX - (BoxWidth  + SizeX * TextScale * ScaleUI),
-					TimerPosY + (TimePlaceBg.VL * ScaleUI - SizeY * TextScale * ScaleUI) / 2 );
+				Canvas->DrawItem( TextItem, Canvas->ClipX - Canvas->OrgX - (BoxWidth  + PositionText.Size.X * TextScale * ScaleUI),
+					TimerPosY + (TimePlaceBg.VL * ScaleUI - PositionText.Size.Y * TextScale * ScaleUI) / 2 );
 			}
 		}
 	}
@@ -447,32 +528,24 @@ void AShooterHUD::DrawKills()
 	FCanvasTextItem TextItem( FVector2D::ZeroVector, FText::GetEmpty(), BigFont, HUDDark );
 	TextItem.EnableShadow( FLinearColor::Black );
 
-	float SizeX, SizeY;
-	FString Text = LOCTEXT("Kills", "KILLS:").ToString();
-	Canvas->StrLen(BigFont, Text, SizeX, SizeY);
+	UpdateCachedText(KillsLabelText, 0, BigFont, []() { return LOCTEXT("Kills", "KILLS:"); });
 
-	TextItem.Text = FText::FromString( Text );
+	TextItem.Text = KillsLabelText.Text;
 	TextItem.Scale = FVector2D( TextScale * ScaleUI, TextScale * ScaleUI );
 	TextItem.FontRenderInfo = ShadowedFont;
 	TextItem.SetColor(HUDDark);
 	Canvas->DrawItem( TextItem, KillsPosX + Offset * ScaleUI + KillsIcon.UL * 1.5f * ScaleUI,
-		KillsPosY + (KillsBg.VL * ScaleUI - SizeY * TextScale * ScaleUI) / 2 );
+		KillsPosY + (KillsBg.VL * ScaleUI - KillsLabelText.Size.Y * TextScale * ScaleUI) / 2 );
+
+	const int32 Kills = MyPlayerState->GetKills();
+	UpdateCachedText(KillsText, Kills, BigFont, [Kills]() { return FText::FromString(FString::FromInt(Kills)); });
 
-	if (MyPlayerState)
-	{
-		Text = FString::FromInt(MyPlayerState->GetKills());
-	}
-	else 
-	{
-		Text = FString("0");
-	}
 	TextScale = 0.88f;
 	float BoxWidth = 135.0f * ScaleUI;
-	Canvas->StrLen(BigFont, Text, SizeX, SizeY);
-	TextItem.Text = FText::FromString( Text );
+	TextItem.Text = KillsText.Text;
 	TextItem.Scale = FVector2D( TextScale * ScaleUI, TextScale * ScaleUI );
-	Canvas->DrawItem( TextItem, KillsPosX + KillsBg.UL * ScaleUI - (BoxWidth + SizeX * TextScale * ScaleUI) /2,
-		KillsPosY + (KillsBg.VL* ScaleUI - SizeY * TextScale * ScaleUI) / 2 );
+	Canvas->DrawItem( TextItem, KillsPosX + KillsBg.UL * ScaleUI - (BoxWidth + KillsText.Size.X * TextScale * ScaleUI) /2,
+		KillsPosY + (KillsBg.VL* ScaleUI - KillsText.Size.Y * TextScale * ScaleUI) / 2 );
 
 }
 
@@ -488,6 +561,8 @@ void AShooterHUD::NotifyEnemyHit()
 
 void AShooterHUD::DrawHUD()
 {
+	SHOOTER_SCOPE_CYCLE_COUNTER(DrawHUD);
+
 	Super::DrawHUD();
 	if (Canvas == nullptr)
 	{
@@ -515,11 +590,18 @@ void AShooterHUD::DrawHUD()
 	}
 
 
-	// Empty the info item array
-	InfoItems.Empty();
+	// Empty the info item array, keeping the allocation for the next frame
+	InfoItems.Reset();
+	InfoItemSizes.Reset();
 	float TextScale = 1.0f;
 	// enforce min
 	ScaleUI = FMath::Max(ScaleUI, MinHudScale);
+
+	if (ScaleUI != CachedScaleUI)
+	{
+		InvalidateCachedTexts();
+		CachedScaleUI = ScaleUI;
+	}
 	
 	AShooterCharacter* MyPawn = Cast<AShooterCharacter>(GetOwningPawn());
 	if (MyPawn && MyPawn->IsAlive() && MyPawn->Health < MyPawn->GetMaxHealth() * MyPawn->GetLowHealthPercentage())
@@ -542,30 +624,44 @@ void AShooterHUD::DrawHUD()
 	// net mode
 	if (GetNetMode() != NM_Standalone)
 	{
-		FString NetModeDesc = (GetNetMode() == NM_Client) ? TEXT("Client") : TEXT("Server");
+		FNamedOnlineSession * Session = NULL;
 		IOnlineSubsystem * OnlineSubsystem = IOnlineSubsystem::Get();
 		if(OnlineSubsystem)
 		{
 			IOnlineSessionPtr SessionSubsystem = OnlineSubsystem->GetSessionInterface();
 			if(SessionSubsystem.IsValid())
 			{
-				FNamedOnlineSession * Session = SessionSubsystem->GetNamedSession(NAME_GameSession);
-				if(Session)
-				{
-					NetModeDesc += TEXT("\nSession: ");
-					NetModeDesc += Session->SessionInfo->GetSessionId().ToString();
-				}
+				Session = SessionSubsystem->GetNamedSession(NAME_GameSession);
 			}
 
 		}
 
-		NetModeDesc += FString::Printf( TEXT( "\nVersion: %i, %s, %s" ), FNetworkVersion::GetNetworkCompatibleChangelist(), UTF8_TO_TCHAR(__DATE__), UTF8_TO_TCHAR(__TIME__) );
+		// the description only changes with the net mode and the session
+		const int64 NetModeKey = (int64)(UPTRINT)Session ^ GetNetMode();
+		UpdateCachedText(NetModeText, NetModeKey, NormalFont, [this, Session]()
+		{
+			FString NetModeDesc = (GetNetMode() == NM_Client) ? TEXT("Client") : TEXT("Server");
+			if(Session)
+			{
+				NetModeDesc += TEXT("\nSession: ");
+				NetModeDesc += Session->SessionInfo->GetSessionId().ToString();
+			}
+
+			NetModeDesc += FString::Printf( TEXT( "\nVersion: %i, %s, %s" ), FNetworkVersion::GetNetworkCompatibleChangelist(), UTF8_TO_TCHAR(__DATE__), UTF8_TO_TCHAR(__TIME__) );
+			return FText::FromString(NetModeDesc);
+		});
 
-		DrawDebugInfoString(NetModeDesc, Canvas->OrgX + Offset*ScaleUI, Canvas->OrgY + 5*Offset*ScaleUI, true, true, HUDLight);
+		DrawDebugInfoText(NetModeText, Canvas->OrgX + Offset*ScaleUI, Canvas->OrgY + 5*Offset*ScaleUI, true, true, HUDLight);
 	}
 
 	DrawMatchTimerAndPosition();
 
+	// only the match timer is worth drawing while a replay is scrubbed through
+	if (AShooterDemoSpectator::IsFastPlayback(GetWorld()))
+	{
+		return;
+	}
+
 	float MessageOffset = (Canvas->ClipY / 4.0)* ScaleUI;
 	if (MatchState == EShooterMatchState::Playing)
 	{
@@ -582,14 +678,15 @@ void AShooterHUD::DrawHUD()
 		else
 		{
 			// respawn
-			FString Text = LOCTEXT("WaitingForRespawn", "WAITING FOR RESPAWN").ToString();
+			UpdateCachedText(RespawnText, 0, BigFont, []() { return LOCTEXT("WaitingForRespawn", "WAITING FOR RESPAWN"); });
+
 			FCanvasTextItem TextItem( FVector2D::ZeroVector, FText::GetEmpty(), BigFont, HUDDark );
 			TextItem.EnableShadow( FLinearColor::Black );
-			TextItem.Text = FText::FromString( Text );
+			TextItem.Text = RespawnText.Text;
 			TextItem.Scale = FVector2D( TextScale * ScaleUI, TextScale * ScaleUI );
 			TextItem.FontRenderInfo = ShadowedFont;
 			TextItem.SetColor(HUDLight);
-			AddMatchInfoString(TextItem);
+			AddMatchInfoString(TextItem, RespawnText.Size);
 		}
 
 		DrawDeathMessages();
@@ -603,18 +700,16 @@ void AShooterHUD::DrawHUD()
 		const float CurrentTime = GetWorld()->GetTimeSeconds();
 		if (CurrentTime - NoAmmoNotifyTime >= 0 && CurrentTime - NoAmmoNotifyTime <= NoAmmoFadeOutTime)
 		{
-			FString Text = FString();
-
 			const float Alpha = FMath::Min(1.0f, 1 - (CurrentTime - NoAmmoNotifyTime) / NoAmmoFadeOutTime);
-			Text = LOCTEXT("NoAmmo", "NO AMMO").ToString();
+			UpdateCachedText(NoAmmoText, 0, BigFont, []() { return LOCTEXT("NoAmmo", "NO AMMO"); });
 			
 			FCanvasTextItem TextItem( FVector2D::ZeroVector, FText::GetEmpty(), BigFont, HUDDark );
 			TextItem.EnableShadow( FLinearColor::Black );
-			TextItem.Text = FText::FromString( Text );
+			TextItem.Text = NoAmmoText.Text;
 			TextItem.Scale = FVector2D( TextScale * ScaleUI, TextScale * ScaleUI );
 			TextItem.FontRenderInfo = ShadowedFont;
 			TextItem.SetColor(FLinearColor(0.75f, 0.125f, 0.125f, Alpha ));
-			AddMatchInfoString(TextItem);			
+			AddMatchInfoString(TextItem, NoAmmoText.Size);
 		}
 	}
 
@@ -623,11 +718,11 @@ void AShooterHUD::DrawHUD()
 	
 }
 
-void AShooterHUD::DrawDebugInfoString(const FString& Text, float PosX, float PosY, bool bAlignLeft, bool bAlignTop, const FColor& TextColor)
+void AShooterHUD::DrawDebugInfoText(const FShooterHUDText& Text, float PosX, float PosY, bool bAlignLeft, bool bAlignTop, const FColor& TextColor)
 {
 #if !UE_BUILD_SHIPPING
-	float SizeX, SizeY;
-	Canvas->StrLen(NormalFont, Text, SizeX, SizeY);
+	const float SizeX = Text.Size.X;
+	const float SizeY = Text.Size.Y;
 
 	const float UsePosX = bAlignLeft ? PosX : PosX - SizeX;
 	const float UsePosY = bAlignTop ? PosY : PosY - SizeY;
@@ -644,7 +739,7 @@ void AShooterHUD::DrawDebugInfoString(const FString& Text, float PosX, float Pos
 	TileItem.BlendMode = SE_BLEND_Translucent;
 	Canvas->DrawItem( TileItem );
 
-	FCanvasTextItem TextItem( FVector2D( UsePosX, UsePosY), FText::FromString( Text ), NormalFont, TextColor );
+	FCanvasTextItem TextItem( FVector2D( UsePosX, UsePosY), Text.Text, NormalFont, TextColor );
 	TextItem.EnableShadow( FLinearColor::Black );
 	TextItem.FontRenderInfo = ShadowedFont;
 	TextItem.Scale = FVector2D( ScaleUI, ScaleUI );
@@ -855,6 +950,7 @@ void AShooterHUD::ShowDeathMessage(class AShooterPlayerState* KillerPlayerState,
 			{
 				LastKillTime = GetWorld()->GetTimeSeconds();
 				CenteredKillMessage = FText::FromString(NewMessage.VictimDesc);
+				RecentlyKilledText.bValid = false;
 			}
 		}
 	}
@@ -1122,9 +1218,10 @@ bool AShooterHUD::IsMatchOver() const
 	return GetMatchState() == EShooterMatchState::Lost || GetMatchState() == EShooterMatchState::Won;
 }
 
-void AShooterHUD::AddMatchInfoString(const FCanvasTextItem InInfoItem )
+void AShooterHUD::AddMatchInfoString(const FCanvasTextItem& InInfoItem, const FVector2D& TextSize)
 {
 	InfoItems.Add(InInfoItem);
+	InfoItemSizes.Add(TextSize);
 }
 
 float AShooterHUD::ShowInfoItems(float YOffset, float TextScale)
@@ -1134,12 +1231,10 @@ float AShooterHUD::ShowInfoItems(float YOffset, float TextScale)
 
 	for (int32 iItem = 0; iItem < InfoItems.Num() ; iItem++)
 	{
-		float X = 0.0f;
-		float SizeX, SizeY; 
-		Canvas->StrLen(InfoItems[iItem].Font, InfoItems[iItem].Text.ToString(), SizeX, SizeY);
-		X = CanvasCentre - ( SizeX * InfoItems[iItem].Scale.X)/2.0f;
+		const FVector2D& Size = InfoItemSizes[iItem];
+		const float X = CanvasCentre - ( Size.X * InfoItems[iItem].Scale.X)/2.0f;
 		Canvas->DrawItem(InfoItems[iItem], X, Y);
-		Y += SizeY * InfoItems[iItem].Scale.Y;
+		Y += Size.Y * InfoItems[iItem].Scale.Y;
 	}
 	return Y;
 }
@@ -1155,18 +1250,19 @@ float AShooterHUD::DrawRecentlyKilledPlayer()
 		{
 			FCanvasTextItem TextItem(FVector2D::ZeroVector, FText::GetEmpty(), NormalFont, HUDDark);
 			TextItem.EnableShadow(FLinearColor::Black);
-			float SizeX, SizeY;
 			float TextScale = 0.71f;
-			FString Text = CenteredKillMessage.ToString();
+
+			UpdateCachedText(RecentlyKilledText, 0, BigFont, [this]() { return CenteredKillMessage; });
+			const float SizeX = RecentlyKilledText.Size.X;
+			const float SizeY = RecentlyKilledText.Size.Y;
 
 			const float Alpha = FMath::Min(1.0f, 1 - (CurrentTime - LastKillTime) / KillFadeOutTime);
 			TextItem.Font = BigFont;
-			Canvas->StrLen(BigFont, Text, SizeX, SizeY);
 			Canvas->SetDrawColor(255, 255, 255, 255 * Alpha);
 			Canvas->DrawIcon(KilledIcon, Canvas->OrgX + Canvas->ClipX / 2 - (KilledIcon.UL * ScaleUI + SizeX * TextScale * ScaleUI) / 2.0f,
 				DrawPos - (Offset * 4 - SizeY / 2 * TextScale + KilledIcon.VL / 2) * ScaleUI, ScaleUI);
 			TextItem.SetColor(FColor(HUDLight.R, HUDLight.G, HUDLight.B, HUDLight.A*Alpha));
-			TextItem.Text = FText::FromString(Text);
+			TextItem.Text = RecentlyKilledText.Text;
 			TextItem.Scale = FVector2D(TextScale*ScaleUI, TextScale*ScaleUI);
 			LastYPos = (DrawPos - (Offset * 4 * ScaleUI)) + SizeY;
 			Canvas->DrawItem(TextItem, Canvas->OrgX + Canvas->ClipX / 2 - (KilledIcon.UL * ScaleUI + SizeX * TextScale * ScaleUI) / 2.0f + KilledIcon.UL * ScaleUI,
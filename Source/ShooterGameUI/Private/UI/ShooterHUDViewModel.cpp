@@ -0,0 +1,147 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "UI/ShooterHUDViewModel.h"
+#include "Weapons/ShooterWeapon.h"
+#include "Online/ShooterPlayerState.h"
+#include "NoesisTypeClass.h"
+
+UShooterWeaponViewModel::UShooterWeaponViewModel(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	AmmoInClip = 0;
+	AmmoInPocket = 0;
+}
+
+void UShooterWeaponViewModel::Update(const AShooterWeapon* Weapon)
+{
+	const int32 NewAmmoInClip = Weapon ? Weapon->GetCurrentAmmoInClip() : 0;
+	SetValue(AmmoInClip, NewAmmoInClip, GET_MEMBER_NAME_CHECKED(UShooterWeaponViewModel, AmmoInClip));
+	SetValue(AmmoInPocket, Weapon ? Weapon->GetCurrentAmmo() - NewAmmoInClip : 0, GET_MEMBER_NAME_CHECKED(UShooterWeaponViewModel, AmmoInPocket));
+
+	// same fading as the canvas HUD: full icons are opaque, the partially used one fades to half
+	TArray<float, TInlineAllocator<16>> NewAlphas;
+	if (Weapon && Weapon->AmmoIconsCount > 0)
+	{
+		const float AmmoPerIcon = (float)Weapon->GetAmmoPerClip() / Weapon->AmmoIconsCount;
+		for (int32 i = 0; i < Weapon->AmmoIconsCount; i++)
+		{
+			float Alpha = 1.0f;
+			if ((i + 1) * AmmoPerIcon > NewAmmoInClip)
+			{
+				const float UsedPerIcon = (i + 1) * AmmoPerIcon - NewAmmoInClip;
+				const float PercentLeftInIcon = UsedPerIcon < AmmoPerIcon ? (AmmoPerIcon - UsedPerIcon) / AmmoPerIcon : 0.0f;
+				Alpha = (128 + 128 * PercentLeftInIcon) / 255.0f;
+			}
+			NewAlphas.Add(Alpha);
+		}
+	}
+
+	if (AmmoIconAlphas.Num() != NewAlphas.Num() || FMemory::Memcmp(AmmoIconAlphas.GetData(), NewAlphas.GetData(), NewAlphas.Num() * sizeof(float)) != 0)
+	{
+		AmmoIconAlphas = NewAlphas;
+		NoesisNotifyArrayPropertyChanged(this, GET_MEMBER_NAME_CHECKED(UShooterWeaponViewModel, AmmoIconAlphas));
+	}
+}
+
+UShooterHUDViewModel::UShooterHUDViewModel(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	PlayerKills = 0;
+	PlayerTeamPos = 0;
+	NumTeams = 0;
+	PlayerHealthAmount = 0;
+	PlayerIsLowHealth = false;
+	PlayerIsAlive = false;
+	ShowCrosshair = false;
+	ShowRecentlyKilledPlayer = false;
+	PrimaryWeapon = ObjectInitializer.CreateDefaultSubobject<UShooterWeaponViewModel>(this, TEXT("PrimaryWeapon"));
+}
+
+void UShooterHUDViewModel::UpdateWeapon(const AShooterWeapon* Weapon)
+{
+	const AShooterCharacter* WeaponOwner = Weapon ? Weapon->GetPawnOwner() : NULL;
+	if (Weapon == NULL || (WeaponOwner && WeaponOwner->GetWeapon() == Weapon))
+	{
+		PrimaryWeapon->Update(Weapon);
+	}
+}
+
+void UShooterHUDViewModel::UpdatePawn(const AShooterCharacter* Pawn)
+{
+	const bool bIsAlive = Pawn && Pawn->IsAlive();
+	const float HealthPct = bIsAlive ? FMath::Clamp(Pawn->Health / Pawn->GetMaxHealth(), 0.0f, 1.0f) : 0.0f;
+
+	SetValue(PlayerIsAlive, bIsAlive, GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, PlayerIsAlive));
+	SetValue(PlayerHealthAmount, FMath::RoundToInt(HealthPct * 100.0f), GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, PlayerHealthAmount));
+	SetValue(PlayerIsLowHealth, bIsAlive && HealthPct < Pawn->GetLowHealthPercentage(), GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, PlayerIsLowHealth));
+
+	UpdateCrosshair(Pawn);
+	PrimaryWeapon->Update(bIsAlive ? Pawn->GetWeapon() : NULL);
+}
+
+void UShooterHUDViewModel::UpdateCrosshair(const AShooterCharacter* Pawn)
+{
+	// same rules as AShooterHUD::DrawCrosshair
+	const AShooterWeapon* Weapon = (Pawn && Pawn->IsAlive()) ? Pawn->GetWeapon() : NULL;
+	const bool bShowCrosshair = Weapon && !Pawn->IsRunning() && (Pawn->IsTargeting() || !Weapon->bHideCrosshairWhileNotAiming);
+	SetValue(ShowCrosshair, bShowCrosshair, GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, ShowCrosshair));
+}
+
+void UShooterHUDViewModel::UpdateScore(const AShooterPlayerController* PC)
+{
+	const AShooterPlayerState* MyPlayerState = PC ? Cast<AShooterPlayerState>(PC->PlayerState) : NULL;
+	const AShooterGameState* MyGameState = PC ? PC->GetWorld()->GetGameState<AShooterGameState>() : NULL;
+	if (MyPlayerState == NULL || MyGameState == NULL)
+	{
+		return;
+	}
+
+	int32 NewTeamPos = 0;
+	int32 NewNumTeams = 0;
+	if (MyGameState->NumTeams > 1)
+	{
+		const int32 MyTeam = MyPlayerState->GetTeamNum();
+		NewTeamPos = FMath::Max(1, MyGameState->TeamScores.Num());
+		for (int32 i = 0; i < MyGameState->TeamScores.Num(); i++)
+		{
+			if (MyGameState->TeamScores.Num() > MyTeam && MyGameState->TeamScores[MyTeam] >= MyGameState->TeamScores[i] && MyTeam != i)
+			{
+				NewTeamPos--;
+			}
+		}
+		for (int32 i = 0; i < MyGameState->NumTeams; i++)
+		{
+			RankedPlayerMap PlayerStateMap;
+			MyGameState->GetRankedMap(i, PlayerStateMap);
+			if (PlayerStateMap.Num() > 0)
+			{
+				NewNumTeams++;
+			}
+		}
+	}
+	else
+	{
+		RankedPlayerMap PlayerStateMap;
+		MyGameState->GetRankedMap(0, PlayerStateMap);
+		const int32* MyRank = PlayerStateMap.FindKey(MyPlayerState);
+		NewTeamPos = MyRank ? *MyRank + 1 : 0;
+		NewNumTeams = PlayerStateMap.Num();
+	}
+
+	SetValue(PlayerKills, MyPlayerState->GetKills(), GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, PlayerKills));
+	SetValue(PlayerTeamPos, NewTeamPos, GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, PlayerTeamPos));
+	SetValue(NumTeams, NewNumTeams, GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, NumTeams));
+}
+
+void UShooterHUDViewModel::ShowRecentlyKilled(const FString& VictimName)
+{
+	SetValue(RecentlyKilledPlayerName, VictimName, GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, RecentlyKilledPlayerName));
+
+	// restart the animation even when the same player got killed again
+	ShowRecentlyKilledPlayer = true;
+	NotifyChanged(GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, ShowRecentlyKilledPlayer));
+}
+
+void UShooterHUDViewModel::HideRecentlyKilled()
+{
+	SetValue(ShowRecentlyKilledPlayer, false, GET_MEMBER_NAME_CHECKED(UShooterHUDViewModel, ShowRecentlyKilledPlayer));
+}
@@ -0,0 +1,277 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "UI/ShooterMainMenuViewModel.h"
+#include "ShooterGameInstance.h"
+#include "Online/ShooterGameSession.h"
+#include "Player/ShooterLocalPlayer.h"
+#include "Player/ShooterPersistentUser.h"
+#include "ShooterGameUserSettings.h"
+#include "ShooterOptions.h"
+#include "NoesisTypeClass.h"
+
+#define LOCTEXT_NAMESPACE "ShooterGame.HUD.Menu"
+
+static const FString MainMenuMapNames[] = { TEXT("Sanctuary"), TEXT("Highrise") };
+
+/** same range as the slate main menu */
+static const int32 MainMenuMaxBotCount = 8;
+
+/** sessions added to the list per frame, keeps the view responsive while large result sets stream in */
+static const int32 MaxServersAddedPerTick = 16;
+
+UShooterMainMenuViewModel::UShooterMainMenuViewModel(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	NumBots = 1;
+	IsRecordingDemo = false;
+	LANMatch = false;
+	DedicatedServer = false;
+	SelectedServerIndex = -1;
+	IsSearching = false;
+	SelectedResolutionIndex = 0;
+	SelectedQualityIndex = 0;
+	FullScreen = false;
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(MainMenuMapNames); ++i)
+	{
+		MapList.Add(MainMenuMapNames[i]);
+	}
+	SelectedMap = MapList[0];
+
+	for (int32 i = 0; i <= MainMenuMaxBotCount; i++)
+	{
+		BotCountList.Add(i);
+	}
+
+	QualityPresets.Add(LOCTEXT("Low", "LOW").ToString());
+	QualityPresets.Add(LOCTEXT("High", "HIGH").ToString());
+}
+
+void UShooterMainMenuViewModel::Init(UShooterGameInstance* InGameInstance)
+{
+	GameInstance = InGameInstance;
+
+	UShooterPersistentUser* const PersistentUser = GetPersistentUser();
+	if (PersistentUser)
+	{
+		SetValue(NumBots, PersistentUser->GetBotsCount(), GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, NumBots));
+		SetValue(IsRecordingDemo, PersistentUser->IsRecordingDemos(), GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, IsRecordingDemo));
+	}
+
+	if (InGameInstance)
+	{
+		SetValue(LANMatch, InGameInstance->GetOnlineMode() == EOnlineMode::LAN, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, LANMatch));
+	}
+
+	// same list as FShooterOptions: the defaults that fit the primary display, plus the native resolution
+	FDisplayMetrics DisplayMetrics;
+	FSlateApplication::Get().GetInitialDisplayMetrics(DisplayMetrics);
+	const FIntPoint NativeResolution(DisplayMetrics.PrimaryDisplayWidth, DisplayMetrics.PrimaryDisplayHeight);
+
+	ResolutionValues.Empty(DefaultShooterResCount + 1);
+	for (int32 i = 0; i < DefaultShooterResCount; i++)
+	{
+		if (DefaultShooterResolutions[i].X <= NativeResolution.X && DefaultShooterResolutions[i].Y <= NativeResolution.Y)
+		{
+			ResolutionValues.Add(DefaultShooterResolutions[i]);
+		}
+	}
+	ResolutionValues.AddUnique(NativeResolution);
+
+	Resolutions.Empty(ResolutionValues.Num());
+	for (const FIntPoint& Resolution : ResolutionValues)
+	{
+		Resolutions.Add(FString::Printf(TEXT("%dx%d"), Resolution.X, Resolution.Y));
+	}
+	NoesisNotifyArrayPropertyChanged(this, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, Resolutions));
+
+	ReadVideoSettings();
+}
+
+void UShooterMainMenuViewModel::HostFFA()
+{
+	HostGame(LOCTEXT("FFA", "FFA").ToString());
+}
+
+void UShooterMainMenuViewModel::HostTDM()
+{
+	HostGame(LOCTEXT("TDM", "TDM").ToString());
+}
+
+void UShooterMainMenuViewModel::HostGame(const FString& GameType)
+{
+	UShooterGameInstance* const GI = GameInstance.Get();
+	ULocalPlayer* const PlayerOwner = GetPlayerOwner();
+	if (GI == nullptr || PlayerOwner == nullptr)
+	{
+		return;
+	}
+
+	UShooterPersistentUser* const PersistentUser = GetPersistentUser();
+	if (PersistentUser)
+	{
+		PersistentUser->SetBotsCount(NumBots);
+		PersistentUser->SetIsRecordingDemos(IsRecordingDemo);
+		PersistentUser->SaveIfDirty();
+	}
+
+	const FString MapName = MapList.Contains(SelectedMap) ? SelectedMap : MapList[0];
+	FString const StartURL = FString::Printf(TEXT("/Game/Maps/%s?game=%s%s%s?%s=%d%s"), *MapName, *GameType, GI->GetOnlineMode() != EOnlineMode::Offline ? TEXT("?listen") : TEXT(""), GI->GetOnlineMode() == EOnlineMode::LAN ? TEXT("?bIsLanMatch") : TEXT(""), *AShooterGameMode::GetBotsCountOptionName(), FMath::Clamp(NumBots, 0, MainMenuMaxBotCount), IsRecordingDemo ? TEXT("?DemoRec") : TEXT(""));
+
+	// Game instance will handle success, failure and dialogs
+	GI->HostGame(PlayerOwner, GameType, StartURL);
+}
+
+void UShooterMainMenuViewModel::SearchServer()
+{
+	UShooterGameInstance* const GI = GameInstance.Get();
+	ULocalPlayer* const PlayerOwner = GetPlayerOwner();
+	if (GI == nullptr || PlayerOwner == nullptr || IsSearching)
+	{
+		return;
+	}
+
+	ClearServerList();
+
+	if (GI->FindSessions(PlayerOwner, DedicatedServer, LANMatch))
+	{
+		SetValue(IsSearching, true, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, IsSearching));
+	}
+}
+
+void UShooterMainMenuViewModel::JoinGame()
+{
+	UShooterGameInstance* const GI = GameInstance.Get();
+	ULocalPlayer* const PlayerOwner = GetPlayerOwner();
+	if (GI == nullptr || PlayerOwner == nullptr || !ServerNames.IsValidIndex(SelectedServerIndex))
+	{
+		return;
+	}
+
+	// entries are only ever appended, so the list index is the search result index
+	SetValue(IsSearching, false, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, IsSearching));
+	GI->JoinSession(PlayerOwner, SelectedServerIndex);
+}
+
+void UShooterMainMenuViewModel::ApplyOptions()
+{
+	UShooterGameUserSettings* const UserSettings = Cast<UShooterGameUserSettings>(GEngine->GetGameUserSettings());
+	if (UserSettings == nullptr)
+	{
+		return;
+	}
+
+	if (ResolutionValues.IsValidIndex(SelectedResolutionIndex))
+	{
+		UserSettings->SetScreenResolution(ResolutionValues[SelectedResolutionIndex]);
+	}
+
+	static const auto CVarFullScreenMode = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("r.FullScreenMode"));
+	const EWindowMode::Type FullScreenMode = CVarFullScreenMode->GetValueOnGameThread() == 1 ? EWindowMode::WindowedFullscreen : EWindowMode::Fullscreen;
+	UserSettings->SetFullscreenMode(FullScreen ? FullScreenMode : EWindowMode::Windowed);
+	UserSettings->SetGraphicsQuality(FMath::Clamp(SelectedQualityIndex, 0, QualityPresets.Num() - 1));
+	UserSettings->ApplySettings(false);
+
+	// show what is actually in effect, ApplySettings may have adjusted the window mode or resolution
+	ReadVideoSettings();
+}
+
+void UShooterMainMenuViewModel::ReadVideoSettings()
+{
+	UShooterGameUserSettings* const UserSettings = Cast<UShooterGameUserSettings>(GEngine->GetGameUserSettings());
+	if (UserSettings == nullptr)
+	{
+		return;
+	}
+
+	// first valid resolution if the current one isn't in the list, like FShooterOptions
+	const int32 ResolutionIndex = ResolutionValues.Find(UserSettings->GetScreenResolution());
+	SetValue(SelectedResolutionIndex, FMath::Max(ResolutionIndex, 0), GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, SelectedResolutionIndex));
+	SetValue(SelectedQualityIndex, UserSettings->GetGraphicsQuality(), GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, SelectedQualityIndex));
+	SetValue(FullScreen, UserSettings->GetFullscreenMode() != EWindowMode::Windowed, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, FullScreen));
+}
+
+void UShooterMainMenuViewModel::Tick(float DeltaSeconds)
+{
+	if (!IsSearching)
+	{
+		return;
+	}
+
+	UShooterGameInstance* const GI = GameInstance.Get();
+	AShooterGameSession* const ShooterSession = GI ? GI->GetGameSession() : nullptr;
+	if (ShooterSession == nullptr)
+	{
+		SetValue(IsSearching, false, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, IsSearching));
+		return;
+	}
+
+	int32 CurrentSearchIdx, NumSearchResults;
+	const EOnlineAsyncTaskState::Type SearchState = ShooterSession->GetSearchResultStatus(CurrentSearchIdx, NumSearchResults);
+	if (SearchState == EOnlineAsyncTaskState::NotStarted)
+	{
+		return;
+	}
+
+	AddNewSearchResults();
+
+	// keep ticking after the search completed until every result made it into the list
+	if (SearchState != EOnlineAsyncTaskState::InProgress && ServerNames.Num() >= ShooterSession->GetSearchResults().Num())
+	{
+		UE_LOG(LogOnlineGame, Log, TEXT("Main menu server search finished with %d sessions"), ServerNames.Num());
+		SetValue(IsSearching, false, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, IsSearching));
+	}
+}
+
+void UShooterMainMenuViewModel::AddNewSearchResults()
+{
+	UShooterGameInstance* const GI = GameInstance.Get();
+	AShooterGameSession* const ShooterSession = GI ? GI->GetGameSession() : nullptr;
+	if (ShooterSession == nullptr)
+	{
+		return;
+	}
+
+	// the online subsystem appends to the live results array while the search is running
+	const TArray<FOnlineSessionSearchResult>& SearchResults = ShooterSession->GetSearchResults();
+	if (SearchResults.Num() < ServerNames.Num())
+	{
+		// results were replaced by a search started somewhere else
+		ClearServerList();
+	}
+
+	const int32 LastIdx = FMath::Min(SearchResults.Num(), ServerNames.Num() + MaxServersAddedPerTick);
+	for (int32 Idx = ServerNames.Num(); Idx < LastIdx; ++Idx)
+	{
+		const FOnlineSessionSearchResult& Result = SearchResults[Idx];
+		const int32 MaxPlayers = Result.Session.SessionSettings.NumPublicConnections + Result.Session.SessionSettings.NumPrivateConnections;
+		const int32 CurrentPlayers = MaxPlayers - Result.Session.NumOpenPublicConnections - Result.Session.NumOpenPrivateConnections;
+
+		ServerNames.Add(FString::Printf(TEXT("%s  %d/%d  %dms"), *Result.Session.OwningUserName, CurrentPlayers, MaxPlayers, Result.PingInMs));
+		NoesisNotifyArrayPropertyPostAdd(&ServerNames);
+	}
+}
+
+void UShooterMainMenuViewModel::ClearServerList()
+{
+	if (ServerNames.Num() > 0)
+	{
+		ServerNames.Empty();
+		NoesisNotifyArrayPropertyChanged(this, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, ServerNames));
+	}
+	SetValue(SelectedServerIndex, -1, GET_MEMBER_NAME_CHECKED(UShooterMainMenuViewModel, SelectedServerIndex));
+}
+
+ULocalPlayer* UShooterMainMenuViewModel::GetPlayerOwner() const
+{
+	UShooterGameInstance* const GI = GameInstance.Get();
+	return GI ? GI->GetFirstGamePlayer() : nullptr;
+}
+
+UShooterPersistentUser* UShooterMainMenuViewModel::GetPersistentUser() const
+{
+	UShooterLocalPlayer* const ShooterLocalPlayer = Cast<UShooterLocalPlayer>(GetPlayerOwner());
+	return ShooterLocalPlayer ? ShooterLocalPlayer->GetPersistentUser() : nullptr;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,214 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "ShooterPlayerUI.h"
+#include "ShooterIngameMenu.h"
+#include "UI/ShooterHUD.h"
+#include "UI/ShooterHUDViewModel.h"
+#include "Online/ShooterPlayerState.h"
+
+FShooterPlayerUI::FShooterPlayerUI(AShooterPlayerController* InPlayerController)
+	: PlayerController(InPlayerController)
+	, HUDViewModel(nullptr)
+	, FriendUpdateTimer(0.0f)
+{
+	//Build menu only after game is initialized
+	IngameMenu = MakeShareable(new FShooterIngameMenu());
+	IngameMenu->Construct(Cast<ULocalPlayer>(InPlayerController->Player));
+}
+
+UShooterHUDViewModel* FShooterPlayerUI::GetHUDViewModel()
+{
+	if (HUDViewModel == NULL && PlayerController.IsValid())
+	{
+		HUDViewModel = NewObject<UShooterHUDViewModel>(PlayerController.Get());
+		HUDViewModel->UpdatePawn(Cast<AShooterCharacter>(PlayerController->GetPawn()));
+		HUDViewModel->UpdateScore(PlayerController.Get());
+	}
+	return HUDViewModel;
+}
+
+AShooterHUD* FShooterPlayerUI::GetShooterHUD() const
+{
+	return PlayerController.IsValid() ? Cast<AShooterHUD>(PlayerController->GetHUD()) : nullptr;
+}
+
+void FShooterPlayerUI::Tick(float DeltaTime)
+{
+	if (IsGameMenuUp())
+	{
+		if (FriendUpdateTimer > 0)
+		{
+			FriendUpdateTimer -= DeltaTime;
+		}
+		else
+		{
+			TSharedPtr<class FShooterFriends> ShooterFriends = IngameMenu->GetShooterFriends();
+			ULocalPlayer* LocalPlayer = PlayerController.IsValid() ? Cast<ULocalPlayer>(PlayerController->Player) : nullptr;
+			if (ShooterFriends.IsValid() && LocalPlayer && LocalPlayer->GetControllerId() >= 0)
+			{
+				ShooterFriends->UpdateFriends(LocalPlayer->GetControllerId());
+			}
+			FriendUpdateTimer = 4; //make sure the time between calls is long enough that we won't trigger (0x80552C81) and not exceed the web api rate limit
+		}
+	}
+}
+
+void FShooterPlayerUI::ToggleGameMenu()
+{
+	IngameMenu->ToggleGameMenu();
+}
+
+bool FShooterPlayerUI::IsGameMenuUp() const
+{
+	return IngameMenu->GetIsGameMenuUp();
+}
+
+void FShooterPlayerUI::ShowScoreboard(bool bEnable, bool bFocus)
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->ShowScoreboard(bEnable, bFocus);
+	}
+}
+
+void FShooterPlayerUI::ToggleScoreboard()
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->ToggleScoreboard();
+	}
+}
+
+void FShooterPlayerUI::ConditionalCloseScoreboard()
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->ConditionalCloseScoreboard();
+	}
+}
+
+bool FShooterPlayerUI::IsMatchOver() const
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	return ShooterHUD && ShooterHUD->IsMatchOver();
+}
+
+void FShooterPlayerUI::SetMatchState(EShooterMatchState::Type NewState)
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->SetMatchState(NewState);
+	}
+}
+
+void FShooterPlayerUI::ShowDeathMessage(AShooterPlayerState* KillerPlayerState, AShooterPlayerState* VictimPlayerState, const UDamageType* KillerDamageType)
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->ShowDeathMessage(KillerPlayerState, VictimPlayerState, KillerDamageType);
+	}
+}
+
+void FShooterPlayerUI::ShowRecentlyKilled(const FString& VictimName)
+{
+	const float RecentlyKilledDisplayTime = 2.0f;
+
+	UShooterHUDViewModel* ViewModel = GetHUDViewModel();
+	if (ViewModel)
+	{
+		ViewModel->ShowRecentlyKilled(VictimName);
+		PlayerController->GetWorldTimerManager().SetTimer(TimerHandle_HideRecentlyKilled, ViewModel, &UShooterHUDViewModel::HideRecentlyKilled, RecentlyKilledDisplayTime);
+	}
+}
+
+void FShooterPlayerUI::NotifyWeaponHit(float DamageTaken, struct FDamageEvent const& DamageEvent, APawn* PawnInstigator)
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->NotifyWeaponHit(DamageTaken, DamageEvent, PawnInstigator);
+	}
+}
+
+void FShooterPlayerUI::NotifyEnemyHit()
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->NotifyEnemyHit();
+	}
+}
+
+void FShooterPlayerUI::NotifyOutOfAmmo()
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->NotifyOutOfAmmo();
+	}
+}
+
+void FShooterPlayerUI::ToggleChat()
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->ToggleChat();
+	}
+}
+
+void FShooterPlayerUI::AddChatLine(const FText& ChatString)
+{
+	AShooterHUD* ShooterHUD = GetShooterHUD();
+	if (ShooterHUD)
+	{
+		ShooterHUD->AddChatLine(ChatString, false);
+	}
+}
+
+void FShooterPlayerUI::UpdatePawn(const AShooterCharacter* Pawn)
+{
+	UShooterHUDViewModel* ViewModel = GetHUDViewModel();
+	if (ViewModel)
+	{
+		ViewModel->UpdatePawn(Pawn);
+	}
+}
+
+void FShooterPlayerUI::UpdateCrosshair(const AShooterCharacter* Pawn)
+{
+	UShooterHUDViewModel* ViewModel = GetHUDViewModel();
+	if (ViewModel)
+	{
+		ViewModel->UpdateCrosshair(Pawn);
+	}
+}
+
+void FShooterPlayerUI::UpdateWeapon(const AShooterWeapon* Weapon)
+{
+	UShooterHUDViewModel* ViewModel = GetHUDViewModel();
+	if (ViewModel)
+	{
+		ViewModel->UpdateWeapon(Weapon);
+	}
+}
+
+void FShooterPlayerUI::UpdateScore()
+{
+	UShooterHUDViewModel* ViewModel = GetHUDViewModel();
+	if (ViewModel)
+	{
+		ViewModel->UpdateScore(PlayerController.Get());
+	}
+}
+
+void FShooterPlayerUI::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObject(HUDViewModel);
+}
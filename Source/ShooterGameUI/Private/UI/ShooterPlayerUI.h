@@ -0,0 +1,65 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterGameUI.h"
+#include "UObject/GCObject.h"
+
+class AShooterHUD;
+class FShooterIngameMenu;
+class UShooterHUDViewModel;
+
+/** HUD, in-game menu and Noesis HUD data context of a local shooter player */
+class FShooterPlayerUI : public IShooterPlayerUI, public FGCObject
+{
+public:
+
+	FShooterPlayerUI(AShooterPlayerController* InPlayerController);
+
+	/** Returns the data context for the Noesis HUD, created on first use. */
+	UShooterHUDViewModel* GetHUDViewModel();
+
+	// IShooterPlayerUI interface
+	virtual void Tick(float DeltaTime) override;
+	virtual void ToggleGameMenu() override;
+	virtual bool IsGameMenuUp() const override;
+	virtual void ShowScoreboard(bool bEnable, bool bFocus = false) override;
+	virtual void ToggleScoreboard() override;
+	virtual void ConditionalCloseScoreboard() override;
+	virtual bool IsMatchOver() const override;
+	virtual void SetMatchState(EShooterMatchState::Type NewState) override;
+	virtual void ShowDeathMessage(AShooterPlayerState* KillerPlayerState, AShooterPlayerState* VictimPlayerState, const UDamageType* KillerDamageType) override;
+	virtual void ShowRecentlyKilled(const FString& VictimName) override;
+	virtual void NotifyWeaponHit(float DamageTaken, struct FDamageEvent const& DamageEvent, APawn* PawnInstigator) override;
+	virtual void NotifyEnemyHit() override;
+	virtual void NotifyOutOfAmmo() override;
+	virtual void ToggleChat() override;
+	virtual void AddChatLine(const FText& ChatString) override;
+	virtual void UpdatePawn(const AShooterCharacter* Pawn) override;
+	virtual void UpdateCrosshair(const AShooterCharacter* Pawn) override;
+	virtual void UpdateWeapon(const AShooterWeapon* Weapon) override;
+	virtual void UpdateScore() override;
+
+	// FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+private:
+
+	/** Returns the shooter HUD of the player. May return NULL. */
+	AShooterHUD* GetShooterHUD() const;
+
+	/** owning player controller */
+	TWeakObjectPtr<AShooterPlayerController> PlayerController;
+
+	/** shooter in-game menu */
+	TSharedPtr<FShooterIngameMenu> IngameMenu;
+
+	/** data context for the Noesis HUD */
+	UShooterHUDViewModel* HUDViewModel;
+
+	/** time left before the friends list in the in-game menu is refreshed */
+	float FriendUpdateTimer;
+
+	/** Handle for hiding the recently killed player in the HUD view model */
+	FTimerHandle TimerHandle_HideRecentlyKilled;
+};
@@ -0,0 +1,24 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "UI/ShooterUIBlueprintLibrary.h"
+#include "ShooterGameInstance.h"
+#include "ShooterGameInstanceUI.h"
+#include "ShooterPlayerUI.h"
+
+UShooterUIBlueprintLibrary::UShooterUIBlueprintLibrary(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+}
+
+UShooterHUDViewModel* UShooterUIBlueprintLibrary::GetHUDViewModel(AShooterPlayerController* PlayerController)
+{
+	// the UI module creates every player UI, so the interface is always an FShooterPlayerUI
+	FShooterPlayerUI* PlayerUI = PlayerController ? static_cast<FShooterPlayerUI*>(PlayerController->GetPlayerUI()) : nullptr;
+	return PlayerUI ? PlayerUI->GetHUDViewModel() : nullptr;
+}
+
+UShooterMainMenuViewModel* UShooterUIBlueprintLibrary::GetMainMenuViewModel(UShooterGameInstance* GameInstance)
+{
+	FShooterGameInstanceUI* GameInstanceUI = GameInstance ? static_cast<FShooterGameInstanceUI*>(GameInstance->GetUI()) : nullptr;
+	return GameInstanceUI ? GameInstanceUI->GetMainMenuViewModel() : nullptr;
+}
@@ -0,0 +1,14 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "UI/ShooterViewModel.h"
+#include "NoesisTypeClass.h"
+
+UShooterViewModel::UShooterViewModel(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+}
+
+void UShooterViewModel::NotifyChanged(FName PropertyName)
+{
+	NoesisNotifyPropertyChanged(this, PropertyName);
+}
@@ -8,6 +8,12 @@ TSharedPtr< FSlateStyleSet > FShooterStyle::ShooterStyleInstance = NULL;
 
 void FShooterStyle::Initialize()
 {
+	// dedicated servers never draw Slate, don't load the style assets
+	if ( IsRunningDedicatedServer() )
+	{
+		return;
+	}
+
 	if ( !ShooterStyleInstance.IsValid() )
 	{
 		ShooterStyleInstance = Create();
@@ -17,6 +23,11 @@ void FShooterStyle::Initialize()
 
 void FShooterStyle::Shutdown()
 {
+	if ( !ShooterStyleInstance.IsValid() )
+	{
+		return;
+	}
+
 	FSlateStyleRegistry::UnRegisterSlateStyle( *ShooterStyleInstance );
 	ensure( ShooterStyleInstance.IsUnique() );
 	ShooterStyleInstance.Reset();
@@ -19,6 +19,8 @@ void SChatWidget::Construct(const FArguments& InArgs, const FLocalPlayerContext&
 	bDismissAfterSay = InArgs._bDismissAfterSay;
 
 	ChatFadeTime = 10.0;
+	MaxChatLines = 64;
+	ChatHistory.Reserve(MaxChatLines);
 	LastChatLineTime = -1.0;
 	bVisibiltyNeedsFocus = true;
 
@@ -91,6 +93,11 @@ FSlateColor SChatWidget::GetChatLineColor() const
 	return GetStyleColor(ChatStyle->TextColor.GetSpecifiedColor());
 }
 
+FText SChatWidget::GetChatLineText(TSharedPtr<FChatLine> ChatLine) const
+{
+	return ChatLine->ChatString;
+}
+
 FSlateColor SChatWidget::GetStyleColor( const FLinearColor& InColor ) const
 {
 	const double EndTime =  LastChatLineTime + ChatFadeTime;
@@ -113,13 +120,23 @@ FSlateColor SChatWidget::GetStyleColor( const FLinearColor& InColor ) const
 
 void SChatWidget::AddChatLine(const FText& ChatString, bool SetFocus)
 {
-	ChatHistory.Add(MakeShareable(new FChatLine(ChatString)));
+	if (ChatHistory.Num() < MaxChatLines)
+	{
+		ChatHistory.Add(MakeShareable(new FChatLine(ChatString)));
+	}
+	else
+	{
+		// History is full, move the oldest line to the end and reuse it along with its row widget
+		TSharedPtr<FChatLine> RecycledLine = ChatHistory[0];
+		ChatHistory.RemoveAt(0, 1, false);
+		RecycledLine->ChatString = ChatString;
+		ChatHistory.Add(RecycledLine);
+	}
 
 	if(ChatHistoryListView.IsValid())
 	{
-		FChatLine* LastLine  = ChatHistory[ChatHistory.Num() - 1].Get();
-		UE_LOG(LogOnline, Warning, TEXT("request scroll last=%s"), *LastLine->ChatString.ToString());
-		ChatHistoryListView->RequestScrollIntoView(ChatHistory[ChatHistory.Num() - 1]);
+		ChatHistoryListView->RequestListRefresh();
+		ChatHistoryListView->RequestScrollIntoView(ChatHistory.Last());
 	}
 	
 	FSlateApplication::Get().PlaySound(ChatStyle->RxMessgeSound);
@@ -232,7 +249,7 @@ TSharedRef<ITableRow> SChatWidget::GenerateChatRow(TSharedPtr<FChatLine> ChatLin
 		SNew(STableRow< TSharedPtr< FChatLine> >, OwnerTable )
 		[
 			SNew(STextBlock)
-			.Text(ChatLine->ChatString)
+			.Text(this, &SChatWidget::GetChatLineText, ChatLine)
 			.Font(ChatFont)
 			.ColorAndOpacity(this, &SChatWidget::GetChatLineColor)
 			.WrapTextAt(CHAT_BOX_WIDTH - CHAT_BOX_PADDING)
@@ -83,6 +83,9 @@ protected:
 	/** Return the font color. */
 	FSlateColor GetChatLineColor() const;
 
+	/** Return the text of a chat line, lines are reused once the history is full. */
+	FText GetChatLineText(TSharedPtr<FChatLine> ChatLine) const;
+
 	/** 
 	 * Return the adjusted color based on whether the chatbox is visible
 	 * 
@@ -112,9 +115,12 @@ protected:
 	/** The chat history list view. */
 	TSharedPtr< SListView< TSharedPtr< FChatLine> > > ChatHistoryListView;
 
-	/** The array of chat history. */
+	/** The array of chat history, oldest first. Holds at most MaxChatLines, the oldest line is recycled for new ones. */
 	TArray< TSharedPtr< FChatLine> > ChatHistory;
 
+	/** Number of lines kept in the chat history. */
+	int32 MaxChatLines;
+
 	/** Should this chatbox be kept visible. */
 	uint32 bAlwaysVisible : 1;
 
@@ -5,6 +5,10 @@
 #include "Engine/DemoNetDriver.h"
 #include "ShooterStyle.h"
 #include "Styling/CoreStyle.h"
+#include "ShooterTypes.h"
+
+/** replay seconds shown before the event that was jumped to */
+static const float ReplayEventLeadTime = 2.0f;
 
 /** Widget to represent the main replay timeline bar */
 class SShooterReplayTimeline : public SCompoundWidget
@@ -12,10 +16,12 @@ class SShooterReplayTimeline : public SCompoundWidget
 public:
 	SLATE_BEGIN_ARGS(SShooterReplayTimeline)
 		: _DemoDriver(nullptr)
+		, _Events(nullptr)
 		, _BackgroundBrush( FCoreStyle::Get().GetDefaultBrush() )
 		, _IndicatorBrush( FCoreStyle::Get().GetDefaultBrush() )
 		{}
 	SLATE_ARGUMENT(TWeakObjectPtr<UDemoNetDriver>, DemoDriver)
+	SLATE_ARGUMENT(const TArray<FShooterReplayTimelineEvent>*, Events)
 	SLATE_ATTRIBUTE( FMargin, BackgroundPadding )
 	SLATE_ATTRIBUTE( const FSlateBrush*, BackgroundBrush )
 	SLATE_ATTRIBUTE( const FSlateBrush*, IndicatorBrush )
@@ -33,6 +39,9 @@ private:
 	/** The demo net driver underlying the current replay */
 	TWeakObjectPtr<UDemoNetDriver> DemoDriver;
 
+	/** Events marked on the bar, owned by the demo HUD */
+	const TArray<FShooterReplayTimelineEvent>* Events;
+
 	/** The FName of the image resource to show */
 	TAttribute< const FSlateBrush* > BackgroundBrush;
 
@@ -43,6 +52,7 @@ private:
 void SShooterReplayTimeline::Construct(const FArguments& InArgs)
 {
 	DemoDriver = InArgs._DemoDriver;
+	Events = InArgs._Events;
 	BackgroundBrush = InArgs._BackgroundBrush;
 	IndicatorBrush = InArgs._IndicatorBrush;
 
@@ -68,7 +78,31 @@ FVector2D SShooterReplayTimeline::ComputeDesiredSize(float LayoutScaleMultiplier
 
 int32 SShooterReplayTimeline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyClippingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
-	const int32 ParentLayerId = SCompoundWidget::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+	int32 ParentLayerId = SCompoundWidget::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+
+	// Event markers, below the position indicator
+	if (Events != nullptr && Events->Num() > 0 && DemoDriver.IsValid() && DemoDriver->GetDemoTotalTime() > 0.0f)
+	{
+		const FSlateBrush* MarkerBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
+		const FVector2D MarkerSize(2.0f, AllottedGeometry.GetLocalSize().Y);
+		const int32 MarkerLayerId = ParentLayerId + 1;
+
+		for (const FShooterReplayTimelineEvent& Event : *Events)
+		{
+			const float EventPercent = FMath::Clamp(Event.TimeInSeconds / DemoDriver->GetDemoTotalTime(), 0.0f, 1.0f);
+
+			FSlateDrawElement::MakeBox(
+				OutDrawElements,
+				MarkerLayerId,
+				AllottedGeometry.ToPaintGeometry(FVector2D(AllottedGeometry.GetLocalSize().X * EventPercent - MarkerSize.X * 0.5f, 0.0f), MarkerSize),
+				MarkerBrush,
+				ESlateDrawEffect::None,
+				Event.bRoundEvent ? FLinearColor::White : FLinearColor(0.8f, 0.1f, 0.1f, 0.8f)
+			);
+		}
+
+		ParentLayerId = MarkerLayerId;
+	}
 
 	// Manually draw the position indicator
 	const FSlateBrush* ImageBrush = IndicatorBrush.Get();
@@ -155,6 +189,7 @@ void SShooterDemoHUD::Construct(const FArguments& InArgs)
 				[
 					SNew(SShooterReplayTimeline)
 					.DemoDriver(PlayerOwner->GetWorld()->GetDemoNetDriver())
+					.Events(&Events)
 					.BackgroundBrush(FShooterStyle::Get().GetBrush("ShooterGame.ReplayTimelineBorder"))
 					.BackgroundPadding(FMargin(0.0f, 3.0))
 					.IndicatorBrush(FShooterStyle::Get().GetBrush("ShooterGame.ReplayTimelineIndicator"))
@@ -203,8 +238,101 @@ void SShooterDemoHUD::Construct(const FArguments& InArgs)
 			]
 
 			+SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Center)
+			[
+				SNew(STextBlock)
+				.Margin(3.0f)
+				.Text(this, &SShooterDemoHUD::GetLastEventText)
+			]
 		]
 	];
+
+	// the event list is stored in the replay header, no need to scrub the stream to find kills
+	UDemoNetDriver* DemoDriver = PlayerOwner->GetWorld()->GetDemoNetDriver();
+	if (DemoDriver != nullptr)
+	{
+		DemoDriver->EnumerateEvents(ShooterReplayEvents::Kill, FEnumerateEventsCallback::CreateSP(this, &SShooterDemoHUD::OnEnumerateEventsComplete, false));
+		DemoDriver->EnumerateEvents(ShooterReplayEvents::Round, FEnumerateEventsCallback::CreateSP(this, &SShooterDemoHUD::OnEnumerateEventsComplete, true));
+	}
+}
+
+void SShooterDemoHUD::OnEnumerateEventsComplete(const FEnumerateEventsResult& Result, bool bRoundEvents)
+{
+	if (!Result.WasSuccessful())
+	{
+		return;
+	}
+
+	for (const FReplayEventListItem& Item : Result.ReplayEventList.ReplayEvents)
+	{
+		FShooterReplayTimelineEvent Event;
+		Event.TimeInSeconds = Item.Time1 / 1000.0f;
+		Event.Description = Item.Metadata;
+		Event.bRoundEvent = bRoundEvents;
+		Events.Add(Event);
+	}
+
+	Events.Sort([](const FShooterReplayTimelineEvent& A, const FShooterReplayTimelineEvent& B) { return A.TimeInSeconds < B.TimeInSeconds; });
+}
+
+void SShooterDemoHUD::JumpToEvent(int32 Direction)
+{
+	UDemoNetDriver* DemoDriver = PlayerOwner.IsValid() ? PlayerOwner->GetWorld()->GetDemoNetDriver() : nullptr;
+	if (DemoDriver == nullptr || Events.Num() == 0)
+	{
+		return;
+	}
+
+	// playback resumes a little before the event, jumping again from there has to skip past it
+	const float CurrentTime = DemoDriver->GetDemoCurrentTime() + ReplayEventLeadTime;
+	const FShooterReplayTimelineEvent* Target = nullptr;
+	if (Direction > 0)
+	{
+		Target = Events.FindByPredicate([CurrentTime](const FShooterReplayTimelineEvent& Event) { return Event.TimeInSeconds > CurrentTime + 0.5f; });
+	}
+	else
+	{
+		for (int32 Idx = Events.Num() - 1; Idx >= 0; --Idx)
+		{
+			if (Events[Idx].TimeInSeconds < CurrentTime - 0.5f)
+			{
+				Target = &Events[Idx];
+				break;
+			}
+		}
+	}
+
+	if (Target != nullptr)
+	{
+		LastEventText = FText::Format(NSLOCTEXT("ShooterGame.HUD.Menu", "ReplayEventFmt", "{0} {1}"),
+			FText::AsTimespan(FTimespan::FromSeconds(Target->TimeInSeconds)),
+			Target->bRoundEvent ? FText::Format(NSLOCTEXT("ShooterGame.HUD.Menu", "ReplayRoundEventFmt", "Round {0}"), FText::FromString(Target->Description)) : FText::FromString(Target->Description));
+
+		DemoDriver->GotoTimeInSeconds(FMath::Max(0.0f, Target->TimeInSeconds - ReplayEventLeadTime));
+	}
+}
+
+FText SShooterDemoHUD::GetLastEventText() const
+{
+	return LastEventText;
+}
+
+FReply SShooterDemoHUD::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
+{
+	const FKey Key = InKeyEvent.GetKey();
+	if (Key == EKeys::PageUp || Key == EKeys::Gamepad_LeftShoulder)
+	{
+		JumpToEvent(-1);
+		return FReply::Handled();
+	}
+	else if (Key == EKeys::PageDown || Key == EKeys::Gamepad_RightShoulder)
+	{
+		JumpToEvent(1);
+		return FReply::Handled();
+	}
+
+	return SCompoundWidget::OnKeyDown(MyGeometry, InKeyEvent);
 }
 
 FText SShooterDemoHUD::GetCurrentReplayTime() const
@@ -0,0 +1,71 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "SlateBasics.h"
+#include "SlateExtras.h"
+#include "NetworkReplayStreaming.h"
+
+class APlayerController;
+
+/** kill or round boundary recorded in the replay */
+struct FShooterReplayTimelineEvent
+{
+	/** replay time of the event */
+	float TimeInSeconds;
+
+	/** recorded description, "Killer > Victim" for kills */
+	FString Description;
+
+	/** round start or end rather than a kill */
+	bool bRoundEvent;
+};
+
+/**
+ * Shows the replay timeline bar, current time and total time of the replay, current playback speed, and a pause toggle button.
+ * Kills and round boundaries recorded by the game mode are marked on the timeline, PAGE UP/DOWN or the shoulder buttons jump between them.
+ */
+class SShooterDemoHUD : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SShooterDemoHUD)
+		: _PlayerOwner(nullptr)
+		{}
+
+	SLATE_ARGUMENT(TWeakObjectPtr<APlayerController>, PlayerOwner)
+
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual bool SupportsKeyboardFocus() const override { return true; }
+
+	virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
+
+private:
+
+	TWeakObjectPtr<APlayerController> PlayerOwner;
+
+	/** recorded events, sorted by time */
+	TArray<FShooterReplayTimelineEvent> Events;
+
+	/** event last jumped to, shown until the next jump */
+	FText LastEventText;
+
+	/** adds events of a group read from the replay header */
+	void OnEnumerateEventsComplete(const FEnumerateEventsResult& Result, bool bRoundEvents);
+
+	/** seeks to the previous or next event */
+	void JumpToEvent(int32 Direction);
+
+	FText GetLastEventText() const;
+
+	FText GetCurrentReplayTime() const;
+	FText GetTotalReplayTime() const;
+	FText GetPlaybackSpeed() const;
+
+	ECheckBoxState IsPauseChecked() const;
+	void OnPauseCheckStateChanged(ECheckBoxState CheckState) const;
+};
+
+
@@ -0,0 +1,40 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "SShooterLoadingScreen.h"
+#include "Widgets/Layout/SSafeZone.h"
+#include "Widgets/Images/SThrobber.h"
+
+void SShooterLoadingScreen::Construct(const FArguments& InArgs)
+{
+	static const FName LoadingScreenName(TEXT("/Game/UI/Menu/LoadingScreen.LoadingScreen"));
+
+	//since we are not using game styles here, just load one image
+	LoadingScreenBrush = MakeShareable( new FShooterGameLoadingScreenBrush( LoadingScreenName, FVector2D(1920,1080) ) );
+
+	ChildSlot
+	[
+		SNew(SOverlay)
+		+SOverlay::Slot()
+		.HAlign(HAlign_Fill)
+		.VAlign(VAlign_Fill)
+		[
+			SNew(SImage)
+			.Image(LoadingScreenBrush.Get())
+		]
+		+SOverlay::Slot()
+		.HAlign(HAlign_Fill)
+		.VAlign(VAlign_Fill)
+		[
+			SNew(SSafeZone)
+			.VAlign(VAlign_Bottom)
+			.HAlign(HAlign_Right)
+			.Padding(10.0f)
+			.IsTitleSafe(true)
+			[
+				SNew(SThrobber)
+				.Visibility(this, &SShooterLoadingScreen::GetLoadIndicatorVisibility)
+			]
+		]
+	];
+}
@@ -0,0 +1,37 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "SlateBasics.h"
+#include "SlateExtras.h"
+
+struct FShooterGameLoadingScreenBrush : public FSlateDynamicImageBrush, public FGCObject
+{
+	FShooterGameLoadingScreenBrush( const FName InTextureName, const FVector2D& InImageSize )
+		: FSlateDynamicImageBrush( InTextureName, InImageSize )
+	{
+		SetResourceObject(LoadObject<UObject>( NULL, *InTextureName.ToString() ));
+	}
+
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+	{
+		FSlateBrush::AddReferencedObjects(Collector);
+	}
+};
+
+class SShooterLoadingScreen : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SShooterLoadingScreen) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	EVisibility GetLoadIndicatorVisibility() const
+	{
+		return EVisibility::Visible;
+	}
+
+	/** loading screen image brush */
+	TSharedPtr<FSlateDynamicImageBrush> LoadingScreenBrush;
+};
@@ -18,6 +18,17 @@
 
 #define	NORM_PADDING	(FMargin(5))
 
+// rows beyond this height are virtualized and scrolled
+#define	MAX_LIST_HEIGHT	(720.0f)
+
+SShooterScoreboardWidget::~SShooterScoreboardWidget()
+{
+	if (BoundGameState.IsValid())
+	{
+		BoundGameState->OnPlayerScoreChanged().Remove(PlayerScoreChangedHandle);
+	}
+}
+
 void SShooterScoreboardWidget::Construct(const FArguments& InArgs)
 {
 	ScoreboardStyle = &FShooterStyle::Get().GetWidgetStyle<FShooterScoreboardStyle>("DefaultShooterScoreboardStyle");
@@ -26,11 +37,21 @@ void SShooterScoreboardWidget::Construct(const FArguments& InArgs)
 	ScoreboardTint = FLinearColor(0.0f,0.0f,0.0f,0.4f);
 	ScoreBoxWidth = 140.0f;
 	ScoreCountUpTime = 2.0f;
+	bRowsDirty = false;
+	bSortDirty = false;
 
 	ScoreboardStartTime = FPlatformTime::Seconds();
 	MatchState = InArgs._MatchState.Get();
 
-	UpdatePlayerStateMaps();
+	RowStyle = FTableRowStyle()
+		.SetEvenRowBackgroundBrush(FSlateNoResource())
+		.SetEvenRowBackgroundHoveredBrush(FSlateNoResource())
+		.SetOddRowBackgroundBrush(FSlateNoResource())
+		.SetOddRowBackgroundHoveredBrush(FSlateNoResource())
+		.SetActiveBrush(FSlateNoResource())
+		.SetActiveHoveredBrush(FSlateNoResource())
+		.SetInactiveBrush(FSlateNoResource())
+		.SetInactiveHoveredBrush(FSlateNoResource());
 	
 	Columns.Add(FColumnData(LOCTEXT("KillsColumn", "Kills"),
 		ScoreboardStyle->KillStatColor,
@@ -107,9 +128,25 @@ void SShooterScoreboardWidget::Construct(const FArguments& InArgs)
 
 	ScoreboardGrid->AddSlot() .AutoHeight()
 	[
-		SAssignNew(ScoreboardData, SVerticalBox)
+		SNew(SBox)
+		.MaxDesiredHeight(MAX_LIST_HEIGHT)
+		[
+			SAssignNew(RowListWidget, SListView< TSharedPtr<FScoreboardRow> >)
+			.ListItemsSource(&Rows)
+			.SelectionMode(ESelectionMode::None)
+			.OnGenerateRow(this, &SShooterScoreboardWidget::MakeListViewWidget)
+		]
 	];
-	UpdateScoreboardGrid();
+
+	ScoreboardGrid->AddSlot() .AutoHeight()
+	[
+		SAssignNew(ScoreboardFooter, SVerticalBox)
+	];
+	UpdateScoreboardFooter();
+
+	// rows are only touched when the game state reports a change
+	BindToGameState();
+	RebuildRows();
 
 	SBorder::Construct(
 		SBorder::FArguments()
@@ -135,15 +172,20 @@ void SShooterScoreboardWidget::StoreTalkingPlayerData(const FUniqueNetId& Player
 	}
 	if (bIsFound && FoundIndex >= 0)
 	{
-		if (!bIsTalking)
-		{
-			PlayersTalkingThisFrame[FoundIndex].Value = bIsTalking;
-		}
 		PlayersTalkingThisFrame[FoundIndex].Value = bIsTalking;
 	}
 	else
 	{
-		PlayersTalkingThisFrame.Emplace(PlayerId.AsShared(), bIsTalking);
+		FoundIndex = PlayersTalkingThisFrame.Emplace(PlayerId.AsShared(), bIsTalking);
+	}
+
+	for (auto& PlayerRow : PlayerRows)
+	{
+		const AShooterPlayerState* PlayerState = PlayerRow.Key.Get();
+		if (PlayerState && PlayerState->GetUniqueId() == PlayersTalkingThisFrame[FoundIndex].Key)
+		{
+			PlayerRow.Value->bIsTalking = bIsTalking;
+		}
 	}
 }
 
@@ -184,36 +226,12 @@ FText SShooterScoreboardWidget::GetMatchOutcomeText() const
 	return OutcomeText;
 }
 
-void SShooterScoreboardWidget::UpdateScoreboardGrid()
+void SShooterScoreboardWidget::UpdateScoreboardFooter()
 {
-	ScoreboardData->ClearChildren();
-	for (uint8 TeamNum = 0; TeamNum < PlayerStateMaps.Num(); TeamNum++)
-	{
-		//Player rows from each team
-		ScoreboardData->AddSlot() .AutoHeight()
-			[
-				MakePlayerRows(TeamNum)
-			];
-		//If we have more than one team, we are playing team based game mode, add totals
-		if (PlayerStateMaps.Num() > 1 && PlayerStateMaps[TeamNum].Num() > 0)
-		{
-			// Horizontal Ruler
-			ScoreboardData->AddSlot() .AutoHeight() .Padding(NORM_PADDING)
-				[
-					SNew(SBorder)
-					.Padding(1)
-					.BorderImage(&ScoreboardStyle->ItemBorderBrush)
-				];
-			ScoreboardData->AddSlot() .AutoHeight()
-				[
-					MakeTotalsRow(TeamNum)
-				];
-		}
-	}
-
+	ScoreboardFooter->ClearChildren();
 	if (MatchState > EShooterMatchState::Playing)
 	{
-		ScoreboardData->AddSlot() .AutoHeight() .Padding(NORM_PADDING)
+		ScoreboardFooter->AddSlot() .AutoHeight() .Padding(NORM_PADDING)
 			[
 				SNew(SHorizontalBox)
 				+SHorizontalBox::Slot() .HAlign(HAlign_Fill)
@@ -228,7 +246,7 @@ void SShooterScoreboardWidget::UpdateScoreboardGrid()
 				]
 			];
 
-		ScoreboardData->AddSlot() .AutoHeight() .Padding(NORM_PADDING)
+		ScoreboardFooter->AddSlot() .AutoHeight() .Padding(NORM_PADDING)
 			[
 				SNew(SHorizontalBox)
 				+SHorizontalBox::Slot() .HAlign(HAlign_Fill)
@@ -243,7 +261,7 @@ void SShooterScoreboardWidget::UpdateScoreboardGrid()
 				]
 			];
 
-		ScoreboardData->AddSlot() .AutoHeight() .Padding(NORM_PADDING)
+		ScoreboardFooter->AddSlot() .AutoHeight() .Padding(NORM_PADDING)
 			[
 				SNew(SHorizontalBox)
 				+SHorizontalBox::Slot() .HAlign(HAlign_Right)
@@ -261,47 +279,232 @@ void SShooterScoreboardWidget::UpdateScoreboardGrid()
 	}
 }
 
-void SShooterScoreboardWidget::UpdatePlayerStateMaps()
+void SShooterScoreboardWidget::BindToGameState()
 {
-	if (PCOwner.IsValid())
+	AShooterGameState* const GameState = PCOwner.IsValid() && PCOwner->GetWorld() ? PCOwner->GetWorld()->GetGameState<AShooterGameState>() : nullptr;
+	if (GameState == BoundGameState.Get() && (GameState != nullptr || !BoundGameState.IsStale()))
 	{
-		AShooterGameState* const GameState = PCOwner->GetWorld()->GetGameState<AShooterGameState>();
-		if (GameState)
+		return;
+	}
+
+	// the game state replicates after the HUD is created on clients, and is replaced on seamless travel
+	if (BoundGameState.IsValid())
+	{
+		BoundGameState->OnPlayerScoreChanged().Remove(PlayerScoreChangedHandle);
+	}
+	PlayerScoreChangedHandle.Reset();
+
+	BoundGameState = GameState;
+	if (GameState)
+	{
+		PlayerScoreChangedHandle = GameState->OnPlayerScoreChanged().AddSP(this, &SShooterScoreboardWidget::OnPlayerScoreChanged);
+	}
+	bRowsDirty = true;
+}
+
+void SShooterScoreboardWidget::OnPlayerScoreChanged(AShooterPlayerState* PlayerState)
+{
+	if (bRowsDirty)
+	{
+		// everything is rebuilt next tick anyway
+		return;
+	}
+
+	const TSharedPtr<FScoreboardRow>* Row = PlayerState ? PlayerRows.Find(PlayerState) : nullptr;
+	if (Row == nullptr || (*Row)->TeamNum != PlayerState->GetTeamNum() || PlayerState->IsOnlyASpectator())
+	{
+		// players joined, left or moved to another team
+		bRowsDirty = true;
+		return;
+	}
+
+	// update the row in place, reorder only if the ranking changed
+	UpdateRow(*Row);
+	bSortDirty = bSortDirty || IsRowOutOfOrder(*Row);
+}
+
+void SShooterScoreboardWidget::RebuildRows()
+{
+	bRowsDirty = false;
+
+	Rows.Reset();
+	PlayerRows.Reset();
+	TotalsRows.Reset();
+
+	AShooterGameState* const GameState = BoundGameState.Get();
+	if (GameState)
+	{
+		const int32 NumTeams = FMath::Max(GameState->NumTeams, 1);
+		for (APlayerState* PlayerState : GameState->PlayerArray)
 		{
-			bool bRequiresWidgetUpdate = false;
-			const int32 NumTeams = FMath::Max(GameState->NumTeams, 1);
-			LastTeamPlayerCount.Reset();
-			LastTeamPlayerCount.AddZeroed(PlayerStateMaps.Num());
-			for (int32 i = 0; i < PlayerStateMaps.Num(); i++)
+			AShooterPlayerState* const ShooterPlayerState = Cast<AShooterPlayerState>(PlayerState);
+			if (ShooterPlayerState && !ShooterPlayerState->IsOnlyASpectator() && ShooterPlayerState->GetTeamNum() >= 0 && ShooterPlayerState->GetTeamNum() < NumTeams)
 			{
-				LastTeamPlayerCount[i] = PlayerStateMaps[i].Num();
-			}
+				TSharedPtr<FScoreboardRow> Row = MakeShareable(new FScoreboardRow());
+				Row->PlayerState = ShooterPlayerState;
+				Row->TeamNum = ShooterPlayerState->GetTeamNum();
+				Row->bIsOwner = PCOwner.IsValid() && PCOwner->PlayerState == ShooterPlayerState;
 
-			PlayerStateMaps.Reset();
-			PlayerStateMaps.AddZeroed(NumTeams);
-		
-			for (int32 i = 0; i < NumTeams; i++)
-			{
-				GameState->GetRankedMap(i, PlayerStateMaps[i]);
+				for (int32 i = 0; i < PlayersTalkingThisFrame.Num(); ++i)
+				{
+					if (ShooterPlayerState->GetUniqueId() == PlayersTalkingThisFrame[i].Key && PlayersTalkingThisFrame[i].Value)
+					{
+						Row->bIsTalking = true;
+					}
+				}
 
-				if (LastTeamPlayerCount.Num() > 0 && PlayerStateMaps[i].Num() != LastTeamPlayerCount[i])
+				Rows.Add(Row);
+				PlayerRows.Add(ShooterPlayerState, Row);
+
+				// If we have more than one team, we are playing team based game mode, add totals
+				if (NumTeams > 1 && !TotalsRows.Contains(Row->TeamNum))
 				{
-					bRequiresWidgetUpdate = true;
+					TSharedPtr<FScoreboardRow> TotalsRow = MakeShareable(new FScoreboardRow());
+					TotalsRow->TeamNum = Row->TeamNum;
+					TotalsRow->bTeamTotals = true;
+
+					Rows.Add(TotalsRow);
+					TotalsRows.Add(Row->TeamNum, TotalsRow);
 				}
 			}
-			if (bRequiresWidgetUpdate)
+		}
+	}
+
+	for (auto& PlayerRow : PlayerRows)
+	{
+		UpdateRow(PlayerRow.Value);
+	}
+
+	UpdateSelectedPlayer();
+	SortRows();
+}
+
+void SShooterScoreboardWidget::SortRows()
+{
+	bSortDirty = false;
+
+	const int32 ScoreColIdx = Columns.Num() - 1;
+	Rows.StableSort([ScoreColIdx](const TSharedPtr<FScoreboardRow>& A, const TSharedPtr<FScoreboardRow>& B)
+	{
+		if (A->TeamNum != B->TeamNum)
+		{
+			return A->TeamNum < B->TeamNum;
+		}
+		if (A->bTeamTotals != B->bTeamTotals)
+		{
+			return B->bTeamTotals;
+		}
+		return A->StatValues[ScoreColIdx] > B->StatValues[ScoreColIdx];
+	});
+
+	// existing row widgets are reused, only rows scrolled into view are generated
+	if (RowListWidget.IsValid())
+	{
+		RowListWidget->RequestListRefresh();
+	}
+}
+
+void SShooterScoreboardWidget::UpdateRow(const TSharedPtr<FScoreboardRow>& Row)
+{
+	AShooterPlayerState* const PlayerState = Row->PlayerState.Get();
+	if (PlayerState)
+	{
+		Row->PlayerName = FText::FromString(PlayerState->GetShortPlayerName());
+
+		Row->StatValues.SetNum(Columns.Num());
+		for (int32 ColIdx = 0; ColIdx < Columns.Num(); ColIdx++)
+		{
+			Row->StatValues[ColIdx] = Columns[ColIdx].AttributeGetter.Execute(PlayerState);
+		}
+		UpdateRowTexts(*Row);
+	}
+
+	UpdateTotalsRow(Row->TeamNum);
+}
+
+void SShooterScoreboardWidget::UpdateTotalsRow(uint8 TeamNum)
+{
+	const TSharedPtr<FScoreboardRow> TotalsRow = TotalsRows.FindRef(TeamNum);
+	if (TotalsRow.IsValid())
+	{
+		TotalsRow->StatValues.Reset();
+		TotalsRow->StatValues.AddZeroed(Columns.Num());
+		for (const auto& PlayerRow : PlayerRows)
+		{
+			if (PlayerRow.Value->TeamNum == TeamNum && PlayerRow.Value->StatValues.Num() == Columns.Num())
 			{
-				UpdateScoreboardGrid();
+				for (int32 ColIdx = 0; ColIdx < Columns.Num(); ColIdx++)
+				{
+					TotalsRow->StatValues[ColIdx] += PlayerRow.Value->StatValues[ColIdx];
+				}
 			}
 		}
+		UpdateRowTexts(*TotalsRow);
 	}
+}
 
-	UpdateSelectedPlayer();
+void SShooterScoreboardWidget::UpdateRowTexts(FScoreboardRow& Row) const
+{
+	Row.StatTexts.SetNum(Row.StatValues.Num());
+	for (int32 ColIdx = 0; ColIdx < Row.StatValues.Num(); ColIdx++)
+	{
+		Row.StatTexts[ColIdx] = FText::AsNumber(LerpForCountup(Row.StatValues[ColIdx]));
+	}
+}
+
+bool SShooterScoreboardWidget::IsRowOutOfOrder(const TSharedPtr<FScoreboardRow>& Row) const
+{
+	const int32 ScoreColIdx = Columns.Num() - 1;
+	const int32 RowIdx = Rows.IndexOfByKey(Row);
+	if (RowIdx == INDEX_NONE)
+	{
+		return true;
+	}
+
+	const int32 Score = Row->StatValues[ScoreColIdx];
+	if (Rows.IsValidIndex(RowIdx - 1))
+	{
+		const FScoreboardRow& Prev = *Rows[RowIdx - 1];
+		if (Prev.TeamNum == Row->TeamNum && !Prev.bTeamTotals && Prev.StatValues[ScoreColIdx] < Score)
+		{
+			return true;
+		}
+	}
+	if (Rows.IsValidIndex(RowIdx + 1))
+	{
+		const FScoreboardRow& Next = *Rows[RowIdx + 1];
+		if (Next.TeamNum == Row->TeamNum && !Next.bTeamTotals && Next.StatValues[ScoreColIdx] > Score)
+		{
+			return true;
+		}
+	}
+	return false;
 }
 
 void SShooterScoreboardWidget::Tick( const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime )
 {
-	UpdatePlayerStateMaps();
+	SHOOTER_SCOPE_CYCLE_COUNTER(ScoreboardTick);
+
+	BindToGameState();
+
+	// changes are collected from events and applied once per frame
+	if (bRowsDirty)
+	{
+		RebuildRows();
+	}
+	else if (bSortDirty)
+	{
+		SortRows();
+	}
+
+	// count up animation at the end of the match, the last update lands on the final values
+	if (MatchState > EShooterMatchState::Playing && FPlatformTime::Seconds() - ScoreboardStartTime <= ScoreCountUpTime + InDeltaTime)
+	{
+		for (const TSharedPtr<FScoreboardRow>& Row : Rows)
+		{
+			UpdateRowTexts(*Row);
+		}
+	}
 }
 
 bool SShooterScoreboardWidget::SupportsKeyboardFocus() const
@@ -369,12 +572,12 @@ void SShooterScoreboardWidget::PlaySound(const FSlateSound& SoundToPlay) const
 	}
 }
 
-FReply SShooterScoreboardWidget::OnMouseOverPlayer(const FGeometry& Geometry, const FPointerEvent& Event, const FTeamPlayer TeamPlayer)
+FReply SShooterScoreboardWidget::OnMouseOverPlayer(const FGeometry& Geometry, const FPointerEvent& Event, TSharedPtr<FScoreboardRow> Row)
 {
 #if INTERACTIVE_SCOREBOARD
-	if( !(SelectedPlayer == TeamPlayer) )
+	if( SelectedRow != Row )
 	{
-		SelectedPlayer = TeamPlayer;
+		SelectedRow = Row;
 		PlaySound(ScoreboardStyle->PlayerChangeSound);
 	}
 #endif
@@ -383,103 +586,50 @@ FReply SShooterScoreboardWidget::OnMouseOverPlayer(const FGeometry& Geometry, co
 
 void SShooterScoreboardWidget::OnSelectedPlayerPrev()
 {
-	// Make sure we have a valid index to start with
-	if( !SelectedPlayer.IsValid() && !SetSelectedPlayerUs())
-	{
-		return;
-	}
-
-	// We don't want to decrease the player Id, we want to find the current one in the list and then select the one before it
-	int32 PrevPlayerId = -1;
-	for (RankedPlayerMap::TConstIterator PlayerIt(PlayerStateMaps[SelectedPlayer.TeamNum]); PlayerIt; ++PlayerIt)	// This would be easier with a .ReverseIterator call
-	{
-		const int32 PlayerId = PlayerIt.Key();
-		if( PlayerId == SelectedPlayer.PlayerId )
-		{
-			break;
-		}
-		PrevPlayerId = PlayerId;
-	}
-
-	if( PrevPlayerId == -1 )
-	{
-		// If the id is still invalid, that means the current selection was first in their team, try the previous team...
-		SelectedPlayer.TeamNum--;
-		if (!PlayerStateMaps.IsValidIndex(SelectedPlayer.TeamNum))
-		{
-			// If there isn't a previous team, move to the last team
-			SelectedPlayer.TeamNum = PlayerStateMaps.Num() - 1;
-			check(PlayerStateMaps.IsValidIndex(SelectedPlayer.TeamNum));
-		}
-
-		// We want the last player in the team
-		for (RankedPlayerMap::TConstIterator PlayerIt(PlayerStateMaps[SelectedPlayer.TeamNum]); PlayerIt; ++PlayerIt)	// This would be easier with a .Last call
-		{
-			const int32 PlayerId = PlayerIt.Key();
-			PrevPlayerId = PlayerId;
-		}
-	}
-
-	check( SelectedPlayer.PlayerId != -1 );
-	SelectedPlayer.PlayerId = PrevPlayerId;
-	PlaySound(ScoreboardStyle->PlayerChangeSound);
+	SelectPlayerRow(-1);
 }
 
 void SShooterScoreboardWidget::OnSelectedPlayerNext()
+{
+	SelectPlayerRow(1);
+}
+
+void SShooterScoreboardWidget::SelectPlayerRow(int32 Direction)
 {
 	// Make sure we have a valid index to start with
-	if( !SelectedPlayer.IsValid() && !SetSelectedPlayerUs())
+	if( !SelectedRow.IsValid() && !SetSelectedPlayerUs())
 	{
 		return;
 	}
 
-	// We don't want to increase the player Id, we want to find the current one in the list and then select the one after
-	bool bNext = false;
-	for (RankedPlayerMap::TConstIterator PlayerIt(PlayerStateMaps[SelectedPlayer.TeamNum]); PlayerIt; ++PlayerIt)
+	// Rows are already in display order, skip team totals and wrap around at both ends
+	const int32 NumRows = Rows.Num();
+	int32 RowIdx = Rows.IndexOfByKey(SelectedRow);
+	for (int32 Step = 0; Step < NumRows && RowIdx != INDEX_NONE; Step++)
 	{
-		const int32 PlayerId = PlayerIt.Key();
-		if( PlayerId == SelectedPlayer.PlayerId )
+		RowIdx = (RowIdx + Direction + NumRows) % NumRows;
+		if (!Rows[RowIdx]->bTeamTotals)
 		{
-			bNext = true;
-		}
-		else if( bNext == true )
-		{
-			SelectedPlayer.PlayerId = PlayerId;
+			SelectedRow = Rows[RowIdx];
+			RowListWidget->RequestScrollIntoView(SelectedRow);
 			PlaySound(ScoreboardStyle->PlayerChangeSound);
-
-			bNext = false;
-			break;
+			return;
 		}
 	}
-
-	if( bNext == true )
-	{
-		// If next is still true, our current selection was last in their team, try the next team...
-		SelectedPlayer.TeamNum++;
-		if (!PlayerStateMaps.IsValidIndex(SelectedPlayer.TeamNum))
-		{
-			// If there isn't a next team, move to the first team
-			SelectedPlayer.TeamNum = 0;
-			check(PlayerStateMaps.IsValidIndex(SelectedPlayer.TeamNum));
-		}
-
-		SelectedPlayer.PlayerId = 0;
-		PlaySound(ScoreboardStyle->PlayerChangeSound);
-	}
 }
 
 void SShooterScoreboardWidget::ResetSelectedPlayer()
 {
-	SelectedPlayer = FTeamPlayer();
+	SelectedRow.Reset();
 }
 
 void SShooterScoreboardWidget::UpdateSelectedPlayer()
 {
-	// Make sure the selected player is still valid...
-	if( SelectedPlayer.IsValid() )
+	// Make sure the selected player is still valid, rows are recreated when players join or leave
+	if( SelectedRow.IsValid() )
 	{
-		const AShooterPlayerState* PlayerState = GetSortedPlayerState(SelectedPlayer);
-		if( !PlayerState )
+		SelectedRow = PlayerRows.FindRef(SelectedRow->PlayerState);
+		if( !SelectedRow.IsValid() || !SelectedRow->PlayerState.IsValid() )
 		{
 			// Player is no longer valid, reset (note: reset implies 'us' in IsSelectedPlayer and IsPlayerSelectedAndValid)
 			ResetSelectedPlayer();
@@ -492,45 +642,31 @@ bool SShooterScoreboardWidget::SetSelectedPlayerUs()
 	ResetSelectedPlayer();
 
 	// Set the owner player to be the default focused one
-	if( APlayerController* const PC = PCOwner.Get() )
+	for (const TSharedPtr<FScoreboardRow>& Row : Rows)
 	{
-		for (uint8 TeamNum = 0; TeamNum < PlayerStateMaps.Num(); TeamNum++)
+		if( Row->bIsOwner && Row->PlayerState.IsValid() )
 		{
-			for (RankedPlayerMap::TConstIterator PlayerIt(PlayerStateMaps[TeamNum]); PlayerIt; ++PlayerIt)
-			{
-				const TWeakObjectPtr<AShooterPlayerState> PlayerState = PlayerIt.Value();
-				if( PlayerState.IsValid() && PC->PlayerState && PC->PlayerState == PlayerState.Get() )
-				{
-					SelectedPlayer = FTeamPlayer(TeamNum, PlayerIt.Key());
-					return true;
-				}
-			}
+			SelectedRow = Row;
+			return true;
 		}
 	}
 	return false;
 }
 
-bool SShooterScoreboardWidget::IsSelectedPlayer(const FTeamPlayer& TeamPlayer) const
+bool SShooterScoreboardWidget::IsSelectedPlayer(const TSharedPtr<FScoreboardRow>& Row) const
 {
-	if( !SelectedPlayer.IsValid() )
+	if( !SelectedRow.IsValid() )
 	{
 		// If not explicitly set, test to see if the owner player was passed.
-		if( IsOwnerPlayer(TeamPlayer) )
-		{
-			return true;
-		}
+		return Row->bIsOwner;
 	}
-	else if( SelectedPlayer == TeamPlayer )
-	{
-		return true;
-	}
-	return false;
+	return SelectedRow == Row;
 }
 
 bool SShooterScoreboardWidget::IsPlayerSelectedAndValid() const
 {
 #if INTERACTIVE_SCOREBOARD
-	if( !SelectedPlayer.IsValid() )
+	if( !SelectedRow.IsValid() )
 	{
 		// Nothing is selected, default to the player
 		if( PCOwner.IsValid() && PCOwner->PlayerState )
@@ -539,7 +675,7 @@ bool SShooterScoreboardWidget::IsPlayerSelectedAndValid() const
 			return OwnerNetId.IsValid();
 		}
 	}
-	else if( const AShooterPlayerState* PlayerState = GetSortedPlayerState(SelectedPlayer) ) 
+	else if( const AShooterPlayerState* PlayerState = SelectedRow->PlayerState.Get() ) 
 	{
 		const TSharedPtr<const FUniqueNetId>& PlayerId = PlayerState->UniqueId.GetUniqueNetId();
 		return PlayerId.IsValid();
@@ -561,67 +697,38 @@ bool SShooterScoreboardWidget::ProfileUIOpened() const
 		const TSharedPtr<const FUniqueNetId>& OwnerNetId = PCOwner->PlayerState->GetUniqueId().GetUniqueNetId();
 		check( OwnerNetId.IsValid() );
 
-		const TSharedPtr<const FUniqueNetId>& PlayerId = ( !SelectedPlayer.IsValid() ? OwnerNetId : GetSortedPlayerState(SelectedPlayer)->GetUniqueId().GetUniqueNetId() );
+		const TSharedPtr<const FUniqueNetId>& PlayerId = ( !SelectedRow.IsValid() ? OwnerNetId : SelectedRow->PlayerState->GetUniqueId().GetUniqueNetId() );
 		check( PlayerId.IsValid() );
 		return ShooterUIHelpers::Get().ProfileOpenedUI(*OwnerNetId.Get(), *PlayerId.Get(), NULL);
 	}
 	return false;
 }
 
-EVisibility SShooterScoreboardWidget::PlayerPresenceToItemVisibility(const FTeamPlayer TeamPlayer) const
-{
-	return GetSortedPlayerState(TeamPlayer) ? EVisibility::Visible : EVisibility::Collapsed;
-}
-
-EVisibility SShooterScoreboardWidget::SpeakerIconVisibility(const FTeamPlayer TeamPlayer) const
+EVisibility SShooterScoreboardWidget::SpeakerIconVisibility(TSharedPtr<FScoreboardRow> Row) const
 {
-	AShooterPlayerState* PlayerState = GetSortedPlayerState(TeamPlayer);
-	if (PlayerState)
-	{
-		for (int32 i = 0; i < PlayersTalkingThisFrame.Num(); ++i)
-		{
-			if (PlayerState->GetUniqueId() == PlayersTalkingThisFrame[i].Key && PlayersTalkingThisFrame[i].Value)
-			{
-				return EVisibility::Visible;
-			}
-		}
-	}
-	return EVisibility::Hidden;
+	return Row->bIsTalking ? EVisibility::Visible : EVisibility::Hidden;
 }
 
-FSlateColor SShooterScoreboardWidget::GetScoreboardBorderColor(const FTeamPlayer TeamPlayer) const
+FSlateColor SShooterScoreboardWidget::GetScoreboardBorderColor(TSharedPtr<FScoreboardRow> Row) const
 {
-	const bool bIsSelected = IsSelectedPlayer(TeamPlayer);
+	const bool bIsSelected = IsSelectedPlayer(Row);
 	const int32 RedTeam = 0;
 	const float BaseValue = bIsSelected == true ? 0.15f : 0.0f;
 	const float AlphaValue = bIsSelected == true ? 1.0f : 0.3f;
-	float RedValue = TeamPlayer.TeamNum == RedTeam ? 0.25f : 0.0f;
-	float BlueValue = TeamPlayer.TeamNum != RedTeam ? 0.25f : 0.0f;
+	float RedValue = Row->TeamNum == RedTeam ? 0.25f : 0.0f;
+	float BlueValue = Row->TeamNum != RedTeam ? 0.25f : 0.0f;
 	return FLinearColor(BaseValue + RedValue, BaseValue, BaseValue + BlueValue, AlphaValue);
 }
 
-FText SShooterScoreboardWidget::GetPlayerName(const FTeamPlayer TeamPlayer) const
-{
-	const AShooterPlayerState* PlayerState = GetSortedPlayerState(TeamPlayer);
-	if (PlayerState)
-	{
-		return FText::FromString(PlayerState->GetShortPlayerName());
-	}
-
-	return FText::GetEmpty();
-}
-
-bool SShooterScoreboardWidget::ShouldPlayerBeDisplayed(const FTeamPlayer TeamPlayer) const
+FText SShooterScoreboardWidget::GetPlayerName(TSharedPtr<FScoreboardRow> Row) const
 {
-	const AShooterPlayerState* PlayerState = GetSortedPlayerState(TeamPlayer);
-	
-	return PlayerState != nullptr && !PlayerState->IsOnlyASpectator();
+	return Row->PlayerName;
 }
 
-FSlateColor SShooterScoreboardWidget::GetPlayerColor(const FTeamPlayer TeamPlayer) const
+FSlateColor SShooterScoreboardWidget::GetPlayerColor(TSharedPtr<FScoreboardRow> Row) const
 {
 	// If this is the owner players row, tint the text color to show ourselves more clearly
-	if( IsOwnerPlayer(TeamPlayer) )
+	if( Row->bIsOwner )
 	{
 		return FSlateColor(FLinearColor::Yellow);
 	}
@@ -630,10 +737,10 @@ FSlateColor SShooterScoreboardWidget::GetPlayerColor(const FTeamPlayer TeamPlaye
 	return TextStyle.ColorAndOpacity;
 }
 
-FSlateColor SShooterScoreboardWidget::GetColumnColor(const FTeamPlayer TeamPlayer, uint8 ColIdx) const
+FSlateColor SShooterScoreboardWidget::GetColumnColor(TSharedPtr<FScoreboardRow> Row, uint8 ColIdx) const
 {
 	// If this is the owner players row, tint the text color to show ourselves more clearly
-	if( IsOwnerPlayer(TeamPlayer) )
+	if( Row->bIsOwner )
 	{
 		return FSlateColor(FLinearColor::Yellow);
 	}
@@ -642,35 +749,9 @@ FSlateColor SShooterScoreboardWidget::GetColumnColor(const FTeamPlayer TeamPlaye
 	return Columns[ColIdx].Color;
 }
 
-bool SShooterScoreboardWidget::IsOwnerPlayer(const FTeamPlayer& TeamPlayer) const
+FText SShooterScoreboardWidget::GetStat(TSharedPtr<FScoreboardRow> Row, uint8 ColIdx) const
 {
-	return ( PCOwner.IsValid() && PCOwner->PlayerState && PCOwner->PlayerState == GetSortedPlayerState(TeamPlayer) );
-}
-
-FText SShooterScoreboardWidget::GetStat(FOnGetPlayerStateAttribute Getter, const FTeamPlayer TeamPlayer) const
-{
-	int32 StatTotal = 0;
-	if (TeamPlayer.PlayerId != SpecialPlayerIndex::All)
-	{
-		AShooterPlayerState* PlayerState = GetSortedPlayerState(TeamPlayer);
-		if (PlayerState)
-		{
-			StatTotal = Getter.Execute(PlayerState);
-		}
-	} 
-	else
-	{
-		for (RankedPlayerMap::TConstIterator PlayerIt(PlayerStateMaps[TeamPlayer.TeamNum]); PlayerIt; ++PlayerIt)
-		{
-			AShooterPlayerState* PlayerState = PlayerIt.Value().Get();
-			if (PlayerState)
-			{
-				StatTotal += Getter.Execute(PlayerState);
-			}
-		}
-	}
-
-	return FText::AsNumber(LerpForCountup(StatTotal));
+	return Row->StatTexts.IsValidIndex(ColIdx) ? Row->StatTexts[ColIdx] : FText::GetEmpty();
 }
 
 int32 SShooterScoreboardWidget::LerpForCountup(int32 ScoreValue) const
@@ -686,7 +767,17 @@ int32 SShooterScoreboardWidget::LerpForCountup(int32 ScoreValue) const
 	}
 }
 
-TSharedRef<SWidget> SShooterScoreboardWidget::MakeTotalsRow(uint8 TeamNum) const
+TSharedRef<ITableRow> SShooterScoreboardWidget::MakeListViewWidget(TSharedPtr<FScoreboardRow> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow< TSharedPtr<FScoreboardRow> >, OwnerTable)
+		.Style(&RowStyle)
+		.ShowSelection(false)
+		[
+			Item->bTeamTotals ? MakeTotalsRow(Item) : MakePlayerRow(Item)
+		];
+}
+
+TSharedRef<SWidget> SShooterScoreboardWidget::MakeTotalsRow(TSharedPtr<FScoreboardRow> Row) const
 {
 	TSharedPtr<SHorizontalBox> TotalsRow;
 
@@ -739,36 +830,27 @@ TSharedRef<SWidget> SShooterScoreboardWidget::MakeTotalsRow(uint8 TeamNum) const
 			.HAlign(HAlign_Center)
 			[
 				SNew(STextBlock)
-				.Text(this, &SShooterScoreboardWidget::GetStat, Columns.Last().AttributeGetter, FTeamPlayer(TeamNum, SpecialPlayerIndex::All))
+				.Text(this, &SShooterScoreboardWidget::GetStat, Row, (uint8)(Columns.Num() - 1))
 				.TextStyle(FShooterStyle::Get(), "ShooterGame.DefaultScoreboard.Row.HeaderTextStyle")
 			]
 		]
 	];
 
-	return TotalsRow.ToSharedRef();
-}
-
-TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRows(uint8 TeamNum) const
-{
-	TSharedRef<SVerticalBox> PlayerRows = SNew(SVerticalBox);
-
-	for (int32 PlayerIndex=0; PlayerIndex < PlayerStateMaps[TeamNum].Num(); PlayerIndex++ )
-	{
-		FTeamPlayer TeamPlayer(TeamNum, PlayerIndex);
-
-		if (ShouldPlayerBeDisplayed(TeamPlayer))
-		{
-			PlayerRows->AddSlot().AutoHeight()
-				[
-					MakePlayerRow(TeamPlayer)
-				];
-		}
-	}
-
-	return PlayerRows;
+	// Horizontal Ruler above the team totals
+	return SNew(SVerticalBox)
+		+SVerticalBox::Slot() .AutoHeight() .Padding(NORM_PADDING)
+		[
+			SNew(SBorder)
+			.Padding(1)
+			.BorderImage(&ScoreboardStyle->ItemBorderBrush)
+		]
+		+SVerticalBox::Slot() .AutoHeight()
+		[
+			TotalsRow.ToSharedRef()
+		];
 }
 
-TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRow(const FTeamPlayer& TeamPlayer) const
+TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRow(TSharedPtr<FScoreboardRow> Row) const
 {
 	// Make the padding here slightly smaller than NORM_PADDING, to fit in more players
 	const FMargin Pad = FMargin(5,1);
@@ -780,7 +862,7 @@ TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRow(const FTeamPlayer& T
 	[
 		SNew(SImage)
 		.Image(FShooterStyle::Get().GetBrush("ShooterGame.Speaker"))
-		.Visibility(this, &SShooterScoreboardWidget::SpeakerIconVisibility, TeamPlayer)
+		.Visibility(this, &SShooterScoreboardWidget::SpeakerIconVisibility, Row)
 	];
 
 	//first autosized row with player name
@@ -790,15 +872,14 @@ TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRow(const FTeamPlayer& T
 		.Padding(Pad)
 		.HAlign(HAlign_Right)
 		.VAlign(VAlign_Center)
-		.Visibility(this, &SShooterScoreboardWidget::PlayerPresenceToItemVisibility, TeamPlayer)
-		.OnMouseMove((SShooterScoreboardWidget*)this, &SShooterScoreboardWidget::OnMouseOverPlayer, TeamPlayer)
-		.BorderBackgroundColor(this, &SShooterScoreboardWidget::GetScoreboardBorderColor, TeamPlayer)
+		.OnMouseMove((SShooterScoreboardWidget*)this, &SShooterScoreboardWidget::OnMouseOverPlayer, Row)
+		.BorderBackgroundColor(this, &SShooterScoreboardWidget::GetScoreboardBorderColor, Row)
 		.BorderImage(&ScoreboardStyle->ItemBorderBrush)
 		[
 			SNew(STextBlock)
-			.Text(this, &SShooterScoreboardWidget::GetPlayerName, TeamPlayer)
+			.Text(this, &SShooterScoreboardWidget::GetPlayerName, Row)
 			.TextStyle(FShooterStyle::Get(), "ShooterGame.DefaultScoreboard.Row.StatTextStyle")
-			.ColorAndOpacity(this, &SShooterScoreboardWidget::GetPlayerColor, TeamPlayer)
+			.ColorAndOpacity(this, &SShooterScoreboardWidget::GetPlayerColor, Row)
 		]
 	];
 	//attributes rows (kills, deaths, score/captures)
@@ -811,9 +892,8 @@ TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRow(const FTeamPlayer& T
 			.Padding(Pad)
 			.VAlign(VAlign_Center)
 			.HAlign(HAlign_Center)
-			.Visibility(this, &SShooterScoreboardWidget::PlayerPresenceToItemVisibility, TeamPlayer)
-			.OnMouseMove((SShooterScoreboardWidget*)this, &SShooterScoreboardWidget::OnMouseOverPlayer, TeamPlayer)
-			.BorderBackgroundColor(this, &SShooterScoreboardWidget::GetScoreboardBorderColor, TeamPlayer)
+				.OnMouseMove((SShooterScoreboardWidget*)this, &SShooterScoreboardWidget::OnMouseOverPlayer, Row)
+			.BorderBackgroundColor(this, &SShooterScoreboardWidget::GetScoreboardBorderColor, Row)
 			.BorderImage(&ScoreboardStyle->ItemBorderBrush)
 			[
 				SNew(SBox)
@@ -821,9 +901,9 @@ TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRow(const FTeamPlayer& T
 				.HAlign(HAlign_Center)
 				[
 					SNew(STextBlock)
-					.Text(this, &SShooterScoreboardWidget::GetStat, Columns[ColIdx].AttributeGetter, TeamPlayer)
+					.Text(this, &SShooterScoreboardWidget::GetStat, Row, ColIdx)
 					.TextStyle(FShooterStyle::Get(), "ShooterGame.DefaultScoreboard.Row.StatTextStyle")
-					.ColorAndOpacity(this, &SShooterScoreboardWidget::GetColumnColor, TeamPlayer, ColIdx)
+					.ColorAndOpacity(this, &SShooterScoreboardWidget::GetColumnColor, Row, ColIdx)
 				]
 			]
 		];
@@ -831,16 +911,6 @@ TSharedRef<SWidget> SShooterScoreboardWidget::MakePlayerRow(const FTeamPlayer& T
 	return PlayerRow.ToSharedRef();
 }
 
-AShooterPlayerState* SShooterScoreboardWidget::GetSortedPlayerState(const FTeamPlayer& TeamPlayer) const
-{
-	if (PlayerStateMaps.IsValidIndex(TeamPlayer.TeamNum) && PlayerStateMaps[TeamPlayer.TeamNum].Contains(TeamPlayer.PlayerId))
-	{
-		return PlayerStateMaps[TeamPlayer.TeamNum].FindRef(TeamPlayer.PlayerId).Get();
-	}
-	
-	return NULL;
-}
-
 int32 SShooterScoreboardWidget::GetAttributeValue_Kills(AShooterPlayerState* PlayerState) const
 {
 	return PlayerState->GetKills();
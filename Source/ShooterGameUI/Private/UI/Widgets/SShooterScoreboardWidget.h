@@ -7,11 +7,6 @@
 
 DECLARE_DELEGATE_RetVal_OneParam(int32, FOnGetPlayerStateAttribute, AShooterPlayerState*);
 
-namespace SpecialPlayerIndex
-{
-	const int32 All = -1;
-}
-
 struct FColumnData
 {
 	/** Column name */
@@ -37,41 +32,43 @@ struct FColumnData
 	}
 };
 
-struct FTeamPlayer
+/** one line of the scoreboard list: a player, or the totals of a team */
+struct FScoreboardRow
 {
-	/** The team the player belongs to */
+	/** player shown in this row, not set for team totals */
+	TWeakObjectPtr<AShooterPlayerState> PlayerState;
+
+	/** the team the player belongs to */
 	uint8 TeamNum;
-		
-	/** The number within that team */
-	int32 PlayerId;
 
-	/** defaults */
-	FTeamPlayer()
-		: TeamNum(0)
-		, PlayerId(SpecialPlayerIndex::All)
-	{
-	}
+	/** row holds the totals of TeamNum */
+	bool bTeamTotals;
 
-	FTeamPlayer(uint8 InTeamNum, int32 InPlayerId)
-		: TeamNum(InTeamNum)
-		, PlayerId(InPlayerId)
-	{
-	}
+	/** row belongs to the owning player */
+	bool bIsOwner;
 
-	/** comparator */
-	bool operator==( const FTeamPlayer& Other ) const
-	{
-		return (TeamNum == Other.TeamNum && PlayerId == Other.PlayerId);
-	}
+	/** player is talking */
+	bool bIsTalking;
+
+	/** player name, cached when the row is updated */
+	FText PlayerName;
+
+	/** stat value for each column, cached when the row is updated */
+	TArray<int32> StatValues;
 
-	/** check to see if we have valid player data */
-	bool IsValid() const
+	/** stat text for each column, cached when the row is updated */
+	TArray<FText> StatTexts;
+
+	/** defaults */
+	FScoreboardRow()
+		: TeamNum(0)
+		, bTeamTotals(false)
+		, bIsOwner(false)
+		, bIsTalking(false)
 	{
-		return !(*this == FTeamPlayer());
 	}
 };
 
-
 //class declare
 class SShooterScoreboardWidget : public SBorder
 {
@@ -85,10 +82,13 @@ class SShooterScoreboardWidget : public SBorder
 
 	SLATE_END_ARGS()
 
+	/** stop listening to scoreboard changes */
+	virtual ~SShooterScoreboardWidget();
+
 	/** needed for every widget */
 	void Construct(const FArguments& InArgs);
 
-	/** update PlayerState maps with every tick when scoreboard is shown */
+	/** applies the scoreboard changes received since the last frame */
 	virtual void Tick( const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime ) override;
 
 	/** if we want to receive focus */
@@ -105,53 +105,59 @@ class SShooterScoreboardWidget : public SBorder
 
 protected:
 
-	/** updates widgets when players leave or join */
-	void UpdateScoreboardGrid();
+	/** makes the match outcome lines below the list */
+	void UpdateScoreboardFooter();
 
-	/** makes total row widget */
-	TSharedRef<SWidget> MakeTotalsRow(uint8 TeamNum) const;
+	/** makes row widget for the list */
+	TSharedRef<ITableRow> MakeListViewWidget(TSharedPtr<FScoreboardRow> Item, const TSharedRef<STableViewBase>& OwnerTable);
 
-	/** makes player rows */
-	TSharedRef<SWidget> MakePlayerRows(uint8 TeamNum) const;
+	/** makes total row widget */
+	TSharedRef<SWidget> MakeTotalsRow(TSharedPtr<FScoreboardRow> Row) const;
 
 	/** makes player row */
-	TSharedRef<SWidget> MakePlayerRow(const FTeamPlayer& TeamPlayer) const;
+	TSharedRef<SWidget> MakePlayerRow(TSharedPtr<FScoreboardRow> Row) const;
+
+	/** (re)binds the change event when the game state shows up or is replaced */
+	void BindToGameState();
+
+	/** scoreboard change event from the game state */
+	void OnPlayerScoreChanged(AShooterPlayerState* PlayerState);
 
-	/** updates PlayerState maps to display accurate scores */
-	void UpdatePlayerStateMaps();
+	/** recreates the rows from the game state, when players join, leave or change teams */
+	void RebuildRows();
 
-	/** gets ranked map for specific team */
-	void GetRankedMap(int32 TeamIndex, RankedPlayerMap& OutRankedMap) const;
+	/** sorts players by score within their team, keeping each team's totals row last */
+	void SortRows();
 
-	/** gets PlayerState for specific team and player */
-	AShooterPlayerState* GetSortedPlayerState(const FTeamPlayer& TeamPlayer) const;
+	/** refreshes cached name and stats of a player row and the totals row of its team */
+	void UpdateRow(const TSharedPtr<FScoreboardRow>& Row);
 
-	/** get player visibility */
-	EVisibility PlayerPresenceToItemVisibility(const FTeamPlayer TeamPlayer) const;
+	/** refreshes cached stats of a team totals row */
+	void UpdateTotalsRow(uint8 TeamNum);
+
+	/** formats cached stat values, applies the count up animation at the end of a match */
+	void UpdateRowTexts(FScoreboardRow& Row) const;
+
+	/** checks if a player row is out of order with its neighbours */
+	bool IsRowOutOfOrder(const TSharedPtr<FScoreboardRow>& Row) const;
 
 	/** get speaker icon visibility */
-	EVisibility SpeakerIconVisibility(const FTeamPlayer TeamPlayer) const;
+	EVisibility SpeakerIconVisibility(TSharedPtr<FScoreboardRow> Row) const;
 
 	/** get scoreboard border color */
-	FSlateColor GetScoreboardBorderColor(const FTeamPlayer TeamPlayer) const;
+	FSlateColor GetScoreboardBorderColor(TSharedPtr<FScoreboardRow> Row) const;
 
 	/** get player name */
-	FText GetPlayerName(const FTeamPlayer TeamPlayer) const;
-
-	/** get whether or not the player should be displayed on the scoreboard */
-	bool ShouldPlayerBeDisplayed(const FTeamPlayer TeamPlayer) const;
+	FText GetPlayerName(TSharedPtr<FScoreboardRow> Row) const;
 
 	/** get player color */
-	FSlateColor GetPlayerColor(const FTeamPlayer TeamPlayer) const;
+	FSlateColor GetPlayerColor(TSharedPtr<FScoreboardRow> Row) const;
 
 	/** get the column color */
-	FSlateColor GetColumnColor(const FTeamPlayer TeamPlayer, uint8 ColIdx) const;
-
-	/** checks to see if the specified player is the owner */
-	bool IsOwnerPlayer(const FTeamPlayer& TeamPlayer) const;
+	FSlateColor GetColumnColor(TSharedPtr<FScoreboardRow> Row, uint8 ColIdx) const;
 
-	/** get specific stat for team number and optionally player */
-	FText GetStat(FOnGetPlayerStateAttribute Getter, const FTeamPlayer TeamPlayer) const;
+	/** get cached stat text of a row */
+	FText GetStat(TSharedPtr<FScoreboardRow> Row, uint8 ColIdx) const;
 
 	/** linear interpolated score for match outcome animation */
 	int32 LerpForCountup(int32 ScoreValue) const;
@@ -175,7 +181,7 @@ protected:
 	void PlaySound(const FSlateSound& SoundToPlay) const;
 
 	/** handle the mouse moving over scoreboard entry */
-	FReply OnMouseOverPlayer(const FGeometry& Geometry, const FPointerEvent& Event, const FTeamPlayer TeamPlayer);
+	FReply OnMouseOverPlayer(const FGeometry& Geometry, const FPointerEvent& Event, TSharedPtr<FScoreboardRow> Row);
 
 	/** called when the previous player wants to be selected */
 	void OnSelectedPlayerPrev();
@@ -183,6 +189,9 @@ protected:
 	/** called when the next player wants to be selected */
 	void OnSelectedPlayerNext();
 
+	/** moves the selection by one player row in the given direction, wrapping around */
+	void SelectPlayerRow(int32 Direction);
+
 	/** resets the selected player to be that of the local user */
 	void ResetSelectedPlayer();
 
@@ -192,8 +201,8 @@ protected:
 	/** sets the currently selected player to be ourselves */
 	bool SetSelectedPlayerUs();
 
-	/** checks to see if the specified player is the selected one */
-	bool IsSelectedPlayer(const FTeamPlayer& TeamPlayer) const;
+	/** checks to see if the specified row is the selected one */
+	bool IsSelectedPlayer(const TSharedPtr<FScoreboardRow>& Row) const;
 
 	/** is there a valid selected item */
 	bool IsPlayerSelectedAndValid() const;
@@ -216,20 +225,35 @@ protected:
 	/** when the scoreboard was brought up. */
 	double ScoreboardStartTime;
 
-	/** the player currently selected in the scoreboard */
-	FTeamPlayer SelectedPlayer;
+	/** the player row currently selected in the scoreboard, the owner's row if not set */
+	TSharedPtr<FScoreboardRow> SelectedRow;
+
+	/** rows in display order: players of each team ranked by score, followed by the team totals in team games */
+	TArray<TSharedPtr<FScoreboardRow>> Rows;
+
+	/** player rows by player */
+	TMap<TWeakObjectPtr<AShooterPlayerState>, TSharedPtr<FScoreboardRow>> PlayerRows;
+
+	/** team totals rows by team */
+	TMap<uint8, TSharedPtr<FScoreboardRow>> TotalsRows;
 
-	/** the Ranked PlayerState map...cleared every frame */
-	TArray<RankedPlayerMap> PlayerStateMaps;
+	/** players joined, left or changed teams since the last tick */
+	bool bRowsDirty;
 
-	/** player count in each team in the last tick */
-	TArray<int32> LastTeamPlayerCount;
+	/** a score changed the ranking since the last tick */
+	bool bSortDirty;
 
 	/** holds talking player data */
 	TArray<TPair<TSharedRef<const FUniqueNetId>, bool>> PlayersTalkingThisFrame;
 
-	/** holds player info rows */
-	TSharedPtr<SVerticalBox> ScoreboardData;
+	/** virtualized list of rows */
+	TSharedPtr<SListView<TSharedPtr<FScoreboardRow>>> RowListWidget;
+
+	/** holds the match outcome lines */
+	TSharedPtr<SVerticalBox> ScoreboardFooter;
+
+	/** row style without background or highlight, borders are drawn by the cells */
+	FTableRowStyle RowStyle;
 
 	/** stat columns data */
 	TArray<FColumnData> Columns;
@@ -240,6 +264,12 @@ protected:
 	/** pointer to our parent HUD */
 	TWeakObjectPtr<class APlayerController> PCOwner;
 
+	/** game state the change event is bound to */
+	TWeakObjectPtr<AShooterGameState> BoundGameState;
+
+	/** handle of the scoreboard change event */
+	FDelegateHandle PlayerScoreChangedHandle;
+
 	/** style for the scoreboard */
 	const struct FShooterScoreboardStyle *ScoreboardStyle;
 };
@@ -0,0 +1,55 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterGame.h"
+#include "SShooterWaitDialog.h"
+#include "ShooterStyle.h"
+#include "ShooterMenuItemWidgetStyle.h"
+
+void SShooterWaitDialog::Construct(const FArguments& InArgs)
+{
+	const FShooterMenuItemStyle* ItemStyle = &FShooterStyle::Get().GetWidgetStyle<FShooterMenuItemStyle>("DefaultShooterMenuItemStyle");
+	const FButtonStyle* ButtonStyle = &FShooterStyle::Get().GetWidgetStyle<FButtonStyle>("DefaultShooterButtonStyle");
+	ChildSlot
+		.VAlign(VAlign_Center)
+		.HAlign(HAlign_Center)
+		[
+			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(20.0f)
+			.VAlign(VAlign_Center)
+			.HAlign(HAlign_Center)
+			[
+				SNew(SBorder)
+				.Padding(50.0f)
+				.VAlign(VAlign_Center)
+				.HAlign(HAlign_Center)
+				.BorderImage(&ItemStyle->BackgroundBrush)
+				.BorderBackgroundColor(FLinearColor(1.0f, 1.0f, 1.0f, 1.0f))
+				[
+					SNew(STextBlock)
+					.TextStyle(FShooterStyle::Get(), "ShooterGame.MenuHeaderTextStyle")
+					.ColorAndOpacity(this, &SShooterWaitDialog::GetTextColor)
+					.Text(InArgs._MessageText)
+					.WrapTextAt(500.0f)
+				]
+			]
+		];
+
+	//Setup a curve
+	const float StartDelay = 0.0f;
+	const float SecondDelay = 0.0f;
+	const float AnimDuration = 2.0f;
+
+	WidgetAnimation = FCurveSequence();
+	TextColorCurve = WidgetAnimation.AddCurve(StartDelay + SecondDelay, AnimDuration, ECurveEaseFunction::QuadInOut);
+	WidgetAnimation.Play(this->AsShared(), true);
+}
+
+FSlateColor SShooterWaitDialog::GetTextColor() const
+{
+	//instead of going from black -> white, go from white -> grey.
+	float fAlpha = 1.0f - TextColorCurve.GetLerp();
+	fAlpha = fAlpha * 0.5f + 0.5f;
+	return FLinearColor(FColor(155, 164, 182, FMath::Clamp((int32)(fAlpha * 255.0f), 0, 255)));
+}
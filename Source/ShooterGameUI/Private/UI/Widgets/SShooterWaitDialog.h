@@ -0,0 +1,27 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+#pragma once
+
+#include "SlateBasics.h"
+#include "SlateExtras.h"
+
+class SShooterWaitDialog : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SShooterWaitDialog)
+	{}
+	SLATE_ARGUMENT(FText, MessageText)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+
+	/** our curve sequence and the related handles */
+	FCurveSequence WidgetAnimation;
+
+	/** used for animating the text color. */
+	FCurveHandle TextColorCurve;
+
+	/** Gets the animated text color */
+	FSlateColor GetTextColor() const;
+};
@@ -0,0 +1,6 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterGame.h"
+#include "ShooterGameUIInterface.h"
@@ -21,6 +21,36 @@ struct FHitData
 	}
 };
 
+/** Text drawn by the canvas HUD, formatted and measured only when the value it shows changes. */
+struct FShooterHUDText
+{
+	/** Formatted text. */
+	FText Text;
+
+	/** Unscaled size of the text in the font it was measured with. */
+	FVector2D Size;
+
+	/** Value the text was built from. */
+	int64 Value;
+
+	/** Text and size are up to date. */
+	bool bValid;
+
+	/** Initialise defaults. */
+	FShooterHUDText()
+		: Size(FVector2D::ZeroVector)
+		, Value(0)
+		, bValid(false)
+	{
+	}
+
+	/** Returns true if the text has to be rebuilt to show NewValue. */
+	bool NeedsUpdate(int64 NewValue) const
+	{
+		return !bValid || Value != NewValue;
+	}
+};
+
 struct FDeathMessage
 {
 	/** Name of player scoring kill. */
@@ -307,6 +337,41 @@ protected:
 	/** Array of information strings to render (Waiting to respawn etc) */
 	TArray<FCanvasTextItem> InfoItems;
 
+	/** Unscaled text size of each entry in InfoItems. */
+	TArray<FVector2D> InfoItemSizes;
+
+	/** ScaleUI the cached texts were built for. */
+	float CachedScaleUI;
+
+	/** Cached texts, rebuilt only when the value they show changes. */
+	FShooterHUDText KillsLabelText;
+	FShooterHUDText KillsText;
+	FShooterHUDText MatchTimerText;
+	FShooterHUDText WarmupText;
+	FShooterHUDText PositionText;
+	FShooterHUDText AmmoInClipText;
+	FShooterHUDText AmmoInPocketText;
+	FShooterHUDText SecondaryAmmoText;
+	FShooterHUDText RespawnText;
+	FShooterHUDText NoAmmoText;
+	FShooterHUDText RecentlyKilledText;
+	FShooterHUDText NetModeText;
+
+	/** Game state the cached ranking listens to for score changes. */
+	TWeakObjectPtr<class AShooterGameState> BoundGameState;
+
+	/** Handle of the score change subscription on BoundGameState. */
+	FDelegateHandle PlayerScoreChangedHandle;
+
+	/** Place of the local player (FFA only) from the cached ranking. */
+	int32 CachedRankedPos;
+
+	/** Number of players (FFA) or teams with players (TDM) from the cached ranking. */
+	int32 CachedNumPositions;
+
+	/** Cached ranking has to be rebuilt before it is drawn. */
+	uint32 bRankingDirty:1;
+
 	/** Called every time game is started. */
 	virtual void PostInitializeComponents() override;
 
@@ -317,6 +382,28 @@ protected:
 	 */
 	FString GetTimeString(float TimeSeconds);
 
+	/**
+	 * Rebuilds a cached text if the value it shows changed.
+	 *
+	 * @param CachedText	Text to update.
+	 * @param NewValue		Value the text should show.
+	 * @param Font			Font used to measure the text.
+	 * @param FormatText	Builds the text for NewValue, only called when it changed.
+	 */
+	void UpdateCachedText(FShooterHUDText& CachedText, int64 NewValue, UFont* Font, TFunctionRef<FText()> FormatText);
+
+	/** Forces every cached text to be rebuilt the next time it is drawn. */
+	void InvalidateCachedTexts();
+
+	/** Listens to score changes of the current game state, it replicates after the HUD is spawned and is replaced on seamless travel. */
+	void BindToGameState();
+
+	/** Marks the cached ranking dirty. */
+	void OnPlayerScoreChanged(class AShooterPlayerState* PlayerState);
+
+	/** Rebuilds the cached ranking from the ranked maps of the game state, if it is dirty. */
+	void UpdateRanking(class AShooterGameState* MyGameState, class AShooterPlayerState* MyPlayerState);
+
 	/** Draws weapon HUD. */
 	void DrawWeaponHUD();
 
@@ -349,8 +436,8 @@ protected:
 	 */
 	float DrawRecentlyKilledPlayer();
 
-	/** Temporary helper for drawing text-in-a-box. */
-	void DrawDebugInfoString(const FString& Text, float PosX, float PosY, bool bAlignLeft, bool bAlignTop, const FColor& TextColor);
+	/** Temporary helper for drawing text-in-a-box, the text must have been measured with NormalFont. */
+	void DrawDebugInfoText(const FShooterHUDText& Text, float PosX, float PosY, bool bAlignLeft, bool bAlignTop, const FColor& TextColor);
 
 	/** helper for getting uv coords in normalized top,left, bottom, right format */
 	void MakeUV(FCanvasIcon& Icon, FVector2D& UV0, FVector2D& UV1, uint16 U, uint16 V, uint16 UL, uint16 VL);
@@ -366,8 +453,9 @@ protected:
 	 * Add information string that will be displayed on the hud. They are added as required and rendered together to prevent overlaps 
 	 * 
 	 * @param InInfoString	InInfoString
+	 * @param TextSize		Unscaled size of the text
 	*/
-	void AddMatchInfoString(const FCanvasTextItem InfoItem);
+	void AddMatchInfoString(const FCanvasTextItem& InfoItem, const FVector2D& TextSize);
 
 	/*
 	* Render the info messages.
@@ -0,0 +1,102 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "UI/ShooterViewModel.h"
+#include "ShooterHUDViewModel.generated.h"
+
+class AShooterWeapon;
+class AShooterCharacter;
+class AShooterPlayerController;
+
+/** ammo state of the weapon currently held by the local player, bound as PrimaryWeapon in HUD.xaml */
+UCLASS(BlueprintType)
+class UShooterWeaponViewModel : public UShooterViewModel
+{
+	GENERATED_UCLASS_BODY()
+
+	/** rounds left in the current clip */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	int32 AmmoInClip;
+
+	/** rounds left outside of the current clip */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	int32 AmmoInPocket;
+
+	/** opacity of each clip icon, partially used icons fade out */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	TArray<float> AmmoIconAlphas;
+
+	/** refresh from weapon, notifies only the values that changed */
+	void Update(const AShooterWeapon* Weapon);
+};
+
+/**
+ * Data context for HUD.xaml.
+ *
+ * Values are pushed from gameplay code when they change (ammo use and reload, kills, health, possession) instead
+ * of being polled every frame.
+ */
+UCLASS(BlueprintType)
+class UShooterHUDViewModel : public UShooterViewModel
+{
+	GENERATED_UCLASS_BODY()
+
+	/** kills scored by the local player */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	int32 PlayerKills;
+
+	/** place of the local player (FFA) or of their team (TDM) */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	int32 PlayerTeamPos;
+
+	/** number of players (FFA) or teams with players (TDM) */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	int32 NumTeams;
+
+	/** health of the local pawn in percent */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	int32 PlayerHealthAmount;
+
+	/** local pawn is below the low health threshold */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	bool PlayerIsLowHealth;
+
+	/** local player has a living pawn */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	bool PlayerIsAlive;
+
+	/** crosshair should be visible for the current weapon and movement */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	bool ShowCrosshair;
+
+	/** name of the last player killed by the local player */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	FString RecentlyKilledPlayerName;
+
+	/** kill message is being displayed */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	bool ShowRecentlyKilledPlayer;
+
+	/** weapon currently held */
+	UPROPERTY(BlueprintReadOnly, Category=HUD)
+	UShooterWeaponViewModel* PrimaryWeapon;
+
+	/** refresh ammo state, ignored for weapons not held by the local pawn */
+	void UpdateWeapon(const AShooterWeapon* Weapon);
+
+	/** refresh health, alive state and crosshair visibility */
+	void UpdatePawn(const AShooterCharacter* Pawn);
+
+	/** refresh crosshair visibility only, it depends on movement */
+	void UpdateCrosshair(const AShooterCharacter* Pawn);
+
+	/** refresh kills and ranking of the owning player */
+	void UpdateScore(const AShooterPlayerController* PC);
+
+	/** show the kill message for a victim */
+	void ShowRecentlyKilled(const FString& VictimName);
+
+	/** hide the kill message */
+	void HideRecentlyKilled();
+};
@@ -0,0 +1,134 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "UI/ShooterViewModel.h"
+#include "ShooterMainMenuViewModel.generated.h"
+
+class UShooterGameInstance;
+class UShooterPersistentUser;
+
+/**
+ * Data context for the host, join and video option panels of MainMenu.xaml.
+ *
+ * Server search is polled from the game instance tick while it is in flight. Sessions found by the online
+ * subsystem (the Null LAN search reports them as beacon replies arrive) are appended to ServerNames a few per
+ * frame, so the list grows in place and the view never rebuilds it, even with hundreds of results.
+ */
+UCLASS(BlueprintType)
+class UShooterMainMenuViewModel : public UShooterViewModel
+{
+	GENERATED_UCLASS_BODY()
+
+	/** maps that can be hosted */
+	UPROPERTY(BlueprintReadOnly, Category=Menu)
+	TArray<FString> MapList;
+
+	/** map to host */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	FString SelectedMap;
+
+	/** choices for the number of bots */
+	UPROPERTY(BlueprintReadOnly, Category=Menu)
+	TArray<int32> BotCountList;
+
+	/** number of bots in hosted matches */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	int32 NumBots;
+
+	/** record a demo of hosted matches */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	bool IsRecordingDemo;
+
+	/** search for LAN sessions */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	bool LANMatch;
+
+	/** search for dedicated servers instead of listen servers */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	bool DedicatedServer;
+
+	/** sessions found so far, in search result order */
+	UPROPERTY(BlueprintReadOnly, Category=Menu)
+	TArray<FString> ServerNames;
+
+	/** session to join, -1 if none */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	int32 SelectedServerIndex;
+
+	/** server search is in flight */
+	UPROPERTY(BlueprintReadOnly, Category=Menu)
+	bool IsSearching;
+
+	/** screen resolutions that fit the primary display, same choices as the slate options menu */
+	UPROPERTY(BlueprintReadOnly, Category=Menu)
+	TArray<FString> Resolutions;
+
+	/** resolution to apply */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	int32 SelectedResolutionIndex;
+
+	/** graphics quality presets, the index is UShooterGameUserSettings::GraphicsQuality */
+	UPROPERTY(BlueprintReadOnly, Category=Menu)
+	TArray<FString> QualityPresets;
+
+	/** quality preset to apply */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	int32 SelectedQualityIndex;
+
+	/** run in fullscreen instead of a window */
+	UPROPERTY(BlueprintReadWrite, Category=Menu)
+	bool FullScreen;
+
+	/** read defaults from the persistent user of the first local player */
+	void Init(UShooterGameInstance* InGameInstance);
+
+	/** host a free for all match on the selected map */
+	UFUNCTION(BlueprintCallable, Category=Menu)
+	void HostFFA();
+
+	/** host a team deathmatch on the selected map */
+	UFUNCTION(BlueprintCallable, Category=Menu)
+	void HostTDM();
+
+	/** clear the server list and start a new search */
+	UFUNCTION(BlueprintCallable, Category=Menu)
+	void SearchServer();
+
+	/** join the selected session */
+	UFUNCTION(BlueprintCallable, Category=Menu)
+	void JoinGame();
+
+	/** apply and save the selected resolution, quality preset and window mode */
+	UFUNCTION(BlueprintCallable, Category=Menu)
+	void ApplyOptions();
+
+	/** pick up newly found sessions, called from the game instance tick */
+	void Tick(float DeltaSeconds);
+
+private:
+
+	/** save host settings and travel to the selected map */
+	void HostGame(const FString& GameType);
+
+	/** append up to MaxServersAddedPerTick entries from the current search results */
+	void AddNewSearchResults();
+
+	/** empty the server list and selection */
+	void ClearServerList();
+
+	/** select the current user settings in the video option panel */
+	void ReadVideoSettings();
+
+	/** player owning the menu */
+	ULocalPlayer* GetPlayerOwner() const;
+
+	/** persistent user of the player owning the menu */
+	UShooterPersistentUser* GetPersistentUser() const;
+
+	/** owning game instance */
+	TWeakObjectPtr<UShooterGameInstance> GameInstance;
+
+	/** resolution of each entry in Resolutions */
+	TArray<FIntPoint> ResolutionValues;
+};
@@ -0,0 +1,26 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ShooterUIBlueprintLibrary.generated.h"
+
+class AShooterPlayerController;
+class UShooterGameInstance;
+class UShooterHUDViewModel;
+class UShooterMainMenuViewModel;
+
+/** gives blueprints and Noesis views the data contexts owned by the UI module */
+UCLASS()
+class UShooterUIBlueprintLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Returns the data context for the Noesis HUD of a local player, created on first use. */
+	UFUNCTION(BlueprintCallable, Category=HUD)
+	static UShooterHUDViewModel* GetHUDViewModel(AShooterPlayerController* PlayerController);
+
+	/** Returns the data context for the Noesis main menu, created on first use. */
+	UFUNCTION(BlueprintCallable)
+	static UShooterMainMenuViewModel* GetMainMenuViewModel(UShooterGameInstance* GameInstance);
+};
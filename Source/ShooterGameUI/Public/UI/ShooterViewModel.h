@@ -0,0 +1,28 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "ShooterViewModel.generated.h"
+
+/** base of the Noesis data contexts, the view is notified only for properties whose value is actually different */
+UCLASS(Abstract)
+class UShooterViewModel : public UObject
+{
+	GENERATED_UCLASS_BODY()
+
+protected:
+
+	/** notify the view about a changed property */
+	void NotifyChanged(FName PropertyName);
+
+	/** assign and notify, if the value is different */
+	template<typename T>
+	void SetValue(T& Value, const T& NewValue, FName PropertyName)
+	{
+		if (Value != NewValue)
+		{
+			Value = NewValue;
+			NotifyChanged(PropertyName);
+		}
+	}
+};
@@ -0,0 +1,53 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+// Menus, HUD and Slate/Noesis widgets. This module is "ClientOnly" in the .uproject file, dedicated servers never build or load it
+// and the game module only talks to it through IShooterGameUIModule.
+
+public class ShooterGameUI : ModuleRules
+{
+	public ShooterGameUI(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.NoSharedPCHs;
+		PrivatePCHHeaderFile = "Public/ShooterGameUI.h";
+
+		PrivateIncludePaths.AddRange(
+			new string[] {
+				"ShooterGameUI/Private",
+				"ShooterGameUI/Private/UI",
+				"ShooterGameUI/Private/UI/Menu",
+				"ShooterGameUI/Private/UI/Style",
+				"ShooterGameUI/Private/UI/Widgets",
+			}
+		);
+
+		PublicDependencyModuleNames.AddRange(
+			new string[] {
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"ShooterGame"
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[] {
+				"OnlineSubsystem",
+				"OnlineSubsystemUtils",
+				"InputCore",
+				"Slate",
+				"SlateCore",
+				"ApplicationCore",
+				"NoesisRuntime",
+				"ShooterGameLoadingScreen"
+			}
+		);
+
+		PrivateIncludePathModuleNames.AddRange(
+			new string[] {
+				"NetworkReplayStreaming"
+			}
+		);
+	}
+}
@@ -0,0 +1,107 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#include "ShooterReplayStreaming.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+DEFINE_LOG_CATEGORY(LogShooterReplay);
+
+IMPLEMENT_MODULE(FShooterReplayStreamingFactory, ShooterReplayStreaming)
+
+namespace ShooterReplayStreaming
+{
+	/** LZ4 trades some ratio for speed, replays are written while the match is running */
+	static const FName CompressionFormat = NAME_LZ4;
+}
+
+FShooterReplayStreamer::FShooterReplayStreamer()
+{
+}
+
+FShooterReplayStreamer::~FShooterReplayStreamer()
+{
+	// the factory releases streamers once their queued requests are done, so the totals are final here
+	const int64 Raw = RawBytes.GetValue();
+	const int64 Compressed = CompressedBytes.GetValue();
+	if (Raw > 0)
+	{
+		UE_LOG(LogShooterReplay, Log, TEXT("Replay chunks: %.2f MB raw, %.2f MB compressed (%.1f%%), %.1f ms compressing off the game thread"),
+			Raw / (1024.0 * 1024.0), Compressed / (1024.0 * 1024.0), Compressed * 100.0 / Raw, FPlatformTime::ToMilliseconds64(CompressCycles.GetValue()));
+	}
+}
+
+bool FShooterReplayStreamer::SupportsCompression() const
+{
+	return true;
+}
+
+bool FShooterReplayStreamer::CompressBuffer(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed) const
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(ShooterReplayStreaming::CompressionFormat, InBuffer.Num());
+	TArray<uint8> CompressedData;
+	CompressedData.SetNumUninitialized(CompressedSize);
+
+	if (!FCompression::CompressMemory(ShooterReplayStreaming::CompressionFormat, CompressedData.GetData(), CompressedSize, InBuffer.GetData(), InBuffer.Num()))
+	{
+		UE_LOG(LogShooterReplay, Error, TEXT("Failed to compress %d bytes of replay data"), InBuffer.Num());
+		return false;
+	}
+
+	// chunk layout: uncompressed size, compressed size, compressed data
+	int32 UncompressedSize = InBuffer.Num();
+	OutCompressed.Reset(CompressedSize + 2 * sizeof(int32));
+
+	FMemoryWriter Writer(OutCompressed);
+	Writer << UncompressedSize;
+	Writer << CompressedSize;
+	Writer.Serialize(CompressedData.GetData(), CompressedSize);
+
+	RawBytes.Add(InBuffer.Num());
+	CompressedBytes.Add(OutCompressed.Num());
+	CompressCycles.Add(FPlatformTime::Cycles64() - StartCycles);
+
+	return true;
+}
+
+bool FShooterReplayStreamer::DecompressBuffer(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer) const
+{
+	FMemoryReader Reader(InCompressed);
+
+	int32 UncompressedSize = 0;
+	int32 CompressedSize = 0;
+	Reader << UncompressedSize;
+	Reader << CompressedSize;
+
+	if (Reader.IsError() || UncompressedSize < 0 || CompressedSize < 0 || CompressedSize > InCompressed.Num() - Reader.Tell())
+	{
+		UE_LOG(LogShooterReplay, Error, TEXT("Corrupt replay chunk: %d bytes, header claims %d compressed"), InCompressed.Num(), CompressedSize);
+		return false;
+	}
+
+	OutBuffer.SetNumUninitialized(UncompressedSize);
+	if (!FCompression::UncompressMemory(ShooterReplayStreaming::CompressionFormat, OutBuffer.GetData(), UncompressedSize, InCompressed.GetData() + Reader.Tell(), CompressedSize))
+	{
+		UE_LOG(LogShooterReplay, Error, TEXT("Failed to decompress replay chunk of %d bytes"), CompressedSize);
+		OutBuffer.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+int32 FShooterReplayStreamer::GetDecompressedSizeBackCompat(FArchive& InCompressed) const
+{
+	// only needed for replays written before the size was stored in the chunk header, none of ours are
+	return INDEX_NONE;
+}
+
+TSharedPtr<INetworkReplayStreamer> FShooterReplayStreamingFactory::CreateReplayStreamer()
+{
+	// the base factory ticks every streamer in LocalFileReplayStreamers
+	TSharedPtr<FShooterReplayStreamer> Streamer = MakeShared<FShooterReplayStreamer>();
+	LocalFileReplayStreamers.Add(Streamer);
+	return Streamer;
+}
@@ -0,0 +1,49 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "LocalFileNetworkReplayStreaming.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogShooterReplay, Log, All);
+
+/**
+ * Local file replay streamer with LZ4 compressed chunks.
+ *
+ * The local file format is already chunked and indexed (header, stream chunks, checkpoints and events each have
+ * their own entry), so playback reads only the chunks it needs and writes are queued to a background task instead
+ * of happening on the game thread. This adds compression of the stream and checkpoint chunks, which the base
+ * streamer leaves disabled, and keeps track of the raw and compressed sizes for comparison.
+ */
+class FShooterReplayStreamer : public FLocalFileNetworkReplayStreamer
+{
+public:
+
+	FShooterReplayStreamer();
+	virtual ~FShooterReplayStreamer();
+
+	// FLocalFileNetworkReplayStreamer interface
+	virtual bool SupportsCompression() const override;
+	virtual bool CompressBuffer(const TArray<uint8>& InBuffer, TArray<uint8>& OutCompressed) const override;
+	virtual bool DecompressBuffer(const TArray<uint8>& InCompressed, TArray<uint8>& OutBuffer) const override;
+	virtual int32 GetDecompressedSizeBackCompat(FArchive& InCompressed) const override;
+
+private:
+
+	/** bytes handed to CompressBuffer, compression runs on the request queue thread */
+	mutable FThreadSafeCounter64 RawBytes;
+
+	/** bytes CompressBuffer wrote */
+	mutable FThreadSafeCounter64 CompressedBytes;
+
+	/** time spent compressing */
+	mutable FThreadSafeCounter64 CompressCycles;
+};
+
+/** Replay streaming factory for FShooterReplayStreamer, selected with DefaultFactoryName=ShooterReplayStreaming */
+class FShooterReplayStreamingFactory : public FLocalFileNetworkReplayStreamingFactory
+{
+public:
+
+	virtual TSharedPtr<INetworkReplayStreamer> CreateReplayStreamer() override;
+};
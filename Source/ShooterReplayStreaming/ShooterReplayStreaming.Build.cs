@@ -0,0 +1,26 @@
+// Copyright 1998-2017 Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+// Loaded by name through FNetworkReplayStreaming, see [NetworkReplayStreaming] in DefaultEngine.ini
+
+public class ShooterReplayStreaming : ModuleRules
+{
+	public ShooterReplayStreaming(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.NoSharedPCHs;
+		PrivatePCHHeaderFile = "Public/ShooterReplayStreaming.h";
+
+		PrivateIncludePaths.Add("ShooterReplayStreaming/Private");
+
+		PublicDependencyModuleNames.AddRange(
+			new string[] {
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"NetworkReplayStreaming",
+				"LocalFileNetworkReplayStreaming"
+			}
+		);
+	}
+}